@@ -0,0 +1,374 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Data/RealtimeMeshCollisionCookScheduler.h"
+
+#include "RealtimeMeshCore.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/LazySingleton.h"
+#include "Misc/QueuedThreadPool.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("RealtimeMeshCollision - Cook Queue Depth"), STAT_RealtimeMeshCollision_CookQueueDepth, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("RealtimeMeshCollision - Cooks In Flight"), STAT_RealtimeMeshCollision_CooksInFlight, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Coalesced Cook Requests"), STAT_RealtimeMeshCollision_CoalescedCooks, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Cancelled Cooks"), STAT_RealtimeMeshCollision_CancelledCooks, STATGROUP_RealtimeMesh);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("RealtimeMeshCollision - Cook Latency (ms)"), STAT_RealtimeMeshCollision_CookLatency, STATGROUP_RealtimeMesh);
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshMaxConcurrentCollisionCooks(
+	TEXT("RealtimeMesh.Collision.MaxConcurrentCooks"),
+	2,
+	TEXT("Maximum number of async collision cooks that run at the same time across all realtime meshes."),
+	ECVF_Default);
+
+namespace RealtimeMesh
+{
+	class FRealtimeMeshCollisionCookScheduler::FCookWork : public IQueuedWork
+	{
+		FRealtimeMeshCollisionCookScheduler& Scheduler;
+		const void* Owner;
+		FRequest Request;
+		TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> Cancelled;
+	public:
+		FCookWork(FRealtimeMeshCollisionCookScheduler& InScheduler, const void* InOwner, FRequest&& InRequest,
+			const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& InCancelled)
+			: Scheduler(InScheduler)
+			, Owner(InOwner)
+			, Request(MoveTemp(InRequest))
+			, Cancelled(InCancelled)
+		{
+		}
+
+		virtual void DoThreadedWork() override
+		{
+			TFuture<ERealtimeMeshCollisionUpdateResult> Result = Request.CookFunction(FRealtimeMeshCollisionCookToken(Cancelled));
+			Scheduler.OnCookReturned(Owner, MoveTemp(Request), Cancelled, MoveTemp(Result));
+			delete this;
+		}
+
+		virtual void Abandon() override
+		{
+			Cancelled->store(true, std::memory_order_relaxed);
+			Scheduler.OnCookFinished(Owner, MoveTemp(Request), Cancelled,
+				MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Ignored).GetFuture());
+			delete this;
+		}
+	};
+
+	FRealtimeMeshCollisionCookScheduler::FRealtimeMeshCollisionCookScheduler()
+		: AliveHandle(MakeShared<uint8, ESPMode::ThreadSafe>(0))
+	{
+		if (FPlatformProcess::SupportsMultithreading())
+		{
+			ThreadPool = TUniquePtr<FQueuedThreadPool>(FQueuedThreadPool::Allocate());
+			ThreadPool->Create(FMath::Clamp(FPlatformMisc::NumberOfCores() / 2, 2, 8), 256 * 1024, TPri_BelowNormal, TEXT("RealtimeMeshCollisionCookPool"));
+		}
+	}
+
+	FRealtimeMeshCollisionCookScheduler::~FRealtimeMeshCollisionCookScheduler()
+	{
+		TArray<TSharedRef<TPromise<ERealtimeMeshCollisionUpdateResult>>> DroppedWaiters;
+		{
+			FScopeLock ScopeLock(&Lock);
+			bShuttingDown = true;
+			for (auto& OwnerEntry : Owners)
+			{
+				if (OwnerEntry.Value.Pending.IsSet())
+				{
+					DroppedWaiters.Append(MoveTemp(OwnerEntry.Value.Pending->Waiters));
+					OwnerEntry.Value.Pending.Reset();
+				}
+				if (OwnerEntry.Value.InFlightCancelled.IsValid())
+				{
+					OwnerEntry.Value.InFlightCancelled->store(true, std::memory_order_relaxed);
+				}
+			}
+			Queue.Empty();
+		}
+
+		for (const auto& Waiter : DroppedWaiters)
+		{
+			Waiter->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+		}
+
+		// Waits for running cooks and abandons queued ones
+		if (ThreadPool.IsValid())
+		{
+			ThreadPool->Destroy();
+			ThreadPool.Reset();
+		}
+	}
+
+	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMeshCollisionCookScheduler::Schedule(const void* Owner, FCookFunction&& CookFunction)
+	{
+		const auto Promise = MakeShared<TPromise<ERealtimeMeshCollisionUpdateResult>>();
+		TFuture<ERealtimeMeshCollisionUpdateResult> Future = Promise->GetFuture();
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (!bShuttingDown)
+			{
+				Stats.NumScheduled++;
+
+				FOwnerState& State = Owners.FindOrAdd(Owner);
+				if (State.Pending.IsSet())
+				{
+					// Only the latest state of the mesh is worth cooking
+					State.Pending->CookFunction = MoveTemp(CookFunction);
+					State.Pending->Waiters.Add(Promise);
+					Stats.NumCoalesced++;
+					INC_DWORD_STAT(STAT_RealtimeMeshCollision_CoalescedCooks);
+				}
+				else
+				{
+					FRequest& Request = State.Pending.Emplace();
+					Request.CookFunction = MoveTemp(CookFunction);
+					Request.Waiters.Add(Promise);
+					Request.FirstScheduledTime = FPlatformTime::Seconds();
+				}
+
+				// Whatever is cooking for this owner is now out of date
+				if (State.InFlightCancelled.IsValid())
+				{
+					State.InFlightCancelled->store(true, std::memory_order_relaxed);
+				}
+
+				if (!State.bQueued)
+				{
+					Queue.Add(Owner);
+					State.bQueued = true;
+				}
+				UpdateStatCounters();
+			}
+			else
+			{
+				Promise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+				return Future;
+			}
+		}
+
+		DispatchQueuedCooks();
+		return Future;
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::Cancel(const void* Owner)
+	{
+		TArray<TSharedRef<TPromise<ERealtimeMeshCollisionUpdateResult>>> DroppedWaiters;
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (FOwnerState* State = Owners.Find(Owner))
+			{
+				if (State->Pending.IsSet())
+				{
+					DroppedWaiters = MoveTemp(State->Pending->Waiters);
+					State->Pending.Reset();
+				}
+				if (State->bQueued)
+				{
+					Queue.Remove(Owner);
+					State->bQueued = false;
+				}
+				if (State->InFlightCancelled.IsValid())
+				{
+					State->InFlightCancelled->store(true, std::memory_order_relaxed);
+				}
+				else
+				{
+					Owners.Remove(Owner);
+				}
+				UpdateStatCounters();
+			}
+		}
+
+		for (const auto& Waiter : DroppedWaiters)
+		{
+			Waiter->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+		}
+	}
+
+	FRealtimeMeshCollisionCookStats FRealtimeMeshCollisionCookScheduler::GetStats() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		FRealtimeMeshCollisionCookStats Result = Stats;
+		Result.QueueDepth = Queue.Num();
+		return Result;
+	}
+
+	int32 FRealtimeMeshCollisionCookScheduler::GetMaxConcurrentCooks()
+	{
+		return FMath::Max(1, CVarRealtimeMeshMaxConcurrentCollisionCooks.GetValueOnAnyThread());
+	}
+
+	FRealtimeMeshCollisionCookScheduler& FRealtimeMeshCollisionCookScheduler::Get()
+	{
+		return TLazySingleton<FRealtimeMeshCollisionCookScheduler>::Get();
+	}
+
+	FRealtimeMeshCollisionCookScheduler* FRealtimeMeshCollisionCookScheduler::TryGet()
+	{
+		return TLazySingleton<FRealtimeMeshCollisionCookScheduler>::TryGet();
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::TearDown()
+	{
+		TLazySingleton<FRealtimeMeshCollisionCookScheduler>::TearDown();
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::DispatchQueuedCooks()
+	{
+		while (true)
+		{
+			const void* Owner = nullptr;
+			FRequest Request;
+			TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Cancelled;
+			{
+				FScopeLock ScopeLock(&Lock);
+				if (bShuttingDown || Stats.NumInFlight >= GetMaxConcurrentCooks())
+				{
+					return;
+				}
+
+				// Owners that are still cooking have to wait for that cook to finish or bail out
+				const int32 QueueIndex = Queue.IndexOfByPredicate([&](const void* QueuedOwner)
+				{
+					return !Owners.FindChecked(QueuedOwner).InFlightCancelled.IsValid();
+				});
+				if (QueueIndex == INDEX_NONE)
+				{
+					return;
+				}
+
+				Owner = Queue[QueueIndex];
+				Queue.RemoveAt(QueueIndex);
+
+				FOwnerState& State = Owners.FindChecked(Owner);
+				State.bQueued = false;
+				Request = MoveTemp(State.Pending.GetValue());
+				State.Pending.Reset();
+
+				Cancelled = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+				State.InFlightCancelled = Cancelled;
+
+				Stats.NumInFlight++;
+				Stats.MaxInFlight = FMath::Max(Stats.MaxInFlight, Stats.NumInFlight);
+				UpdateStatCounters();
+			}
+
+			StartCook(Owner, MoveTemp(Request), Cancelled.ToSharedRef());
+		}
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::StartCook(const void* Owner, FRequest&& Request, const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& Cancelled)
+	{
+		FCookWork* Work = new FCookWork(*this, Owner, MoveTemp(Request), Cancelled);
+		if (ThreadPool.IsValid())
+		{
+			ThreadPool->AddQueuedWork(Work);
+		}
+		else
+		{
+			Work->DoThreadedWork();
+		}
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::OnCookReturned(const void* Owner, FRequest&& Request, const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& Cancelled,
+		TFuture<ERealtimeMeshCollisionUpdateResult>&& Result)
+	{
+		if (!Result.IsValid() || Result.IsReady())
+		{
+			OnCookFinished(Owner, MoveTemp(Request), Cancelled, MoveTemp(Result));
+			return;
+		}
+
+		// The cook stays in flight until its result is applied on the game thread, so a newer request can still stop that apply
+		Result.Then([this, WeakAliveHandle = TWeakPtr<uint8, ESPMode::ThreadSafe>(AliveHandle), Owner, Request = MoveTemp(Request), Cancelled]
+			(TFuture<ERealtimeMeshCollisionUpdateResult>&& AppliedResult) mutable
+		{
+			const ERealtimeMeshCollisionUpdateResult Value = AppliedResult.Get();
+			if (WeakAliveHandle.IsValid())
+			{
+				OnCookFinished(Owner, MoveTemp(Request), Cancelled, MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(Value).GetFuture());
+			}
+			else
+			{
+				// Applied after the scheduler was torn down
+				for (const auto& Waiter : Request.Waiters)
+				{
+					Waiter->SetValue(Value);
+				}
+			}
+		});
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::OnCookFinished(const void* Owner, FRequest&& Request, const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& Cancelled,
+		TFuture<ERealtimeMeshCollisionUpdateResult>&& Result)
+	{
+		bool bWaitersTransferred = false;
+		{
+			FScopeLock ScopeLock(&Lock);
+			Stats.NumInFlight--;
+
+			FOwnerState* State = Owners.Find(Owner);
+			if (State && State->InFlightCancelled == Cancelled)
+			{
+				State->InFlightCancelled.Reset();
+			}
+
+			if (Cancelled->load(std::memory_order_relaxed))
+			{
+				Stats.NumCancelled++;
+				INC_DWORD_STAT(STAT_RealtimeMeshCollision_CancelledCooks);
+
+				// Whoever waited on the cancelled cook gets the result of the request that superseded it
+				if (State && State->Pending.IsSet())
+				{
+					Request.Waiters.Append(MoveTemp(State->Pending->Waiters));
+					State->Pending->Waiters = MoveTemp(Request.Waiters);
+					State->Pending->FirstScheduledTime = FMath::Min(State->Pending->FirstScheduledTime, Request.FirstScheduledTime);
+					bWaitersTransferred = true;
+				}
+			}
+			else
+			{
+				Stats.NumCompleted++;
+				Stats.LastLatencySeconds = FPlatformTime::Seconds() - Request.FirstScheduledTime;
+				Stats.MaxLatencySeconds = FMath::Max(Stats.MaxLatencySeconds, Stats.LastLatencySeconds);
+				SET_FLOAT_STAT(STAT_RealtimeMeshCollision_CookLatency, Stats.LastLatencySeconds * 1000.0);
+			}
+
+			if (State && !State->Pending.IsSet() && !State->InFlightCancelled.IsValid())
+			{
+				Owners.Remove(Owner);
+			}
+			UpdateStatCounters();
+		}
+
+		if (!bWaitersTransferred && Request.Waiters.Num() > 0)
+		{
+			if (Result.IsValid())
+			{
+				Result.Then([Waiters = MoveTemp(Request.Waiters)](TFuture<ERealtimeMeshCollisionUpdateResult>&& FinalResult)
+				{
+					const ERealtimeMeshCollisionUpdateResult Value = FinalResult.Get();
+					for (const auto& Waiter : Waiters)
+					{
+						Waiter->SetValue(Value);
+					}
+				});
+			}
+			else
+			{
+				for (const auto& Waiter : Request.Waiters)
+				{
+					Waiter->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+				}
+			}
+		}
+
+		DispatchQueuedCooks();
+	}
+
+	void FRealtimeMeshCollisionCookScheduler::UpdateStatCounters() const
+	{
+		SET_DWORD_STAT(STAT_RealtimeMeshCollision_CookQueueDepth, Queue.Num());
+		SET_DWORD_STAT(STAT_RealtimeMeshCollision_CooksInFlight, Stats.NumInFlight);
+	}
+}
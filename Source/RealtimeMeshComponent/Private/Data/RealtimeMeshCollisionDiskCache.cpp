@@ -0,0 +1,266 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Data/RealtimeMeshCollisionDiskCache.h"
+
+#include "RealtimeMeshCore.h"
+#include "RealtimeMeshComponentModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/LazySingleton.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Disk Cache Hits"), STAT_RealtimeMeshCollision_DiskCacheHits, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Disk Cache Misses"), STAT_RealtimeMeshCollision_DiskCacheMisses, STATGROUP_RealtimeMesh);
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCollisionDiskCacheEnable(
+	TEXT("RealtimeMesh.Collision.DiskCache.Enable"),
+	0,
+	TEXT("Store cooked complex collision on disk and reuse it instead of cooking identical meshes again."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarRealtimeMeshCollisionDiskCacheDirectory(
+	TEXT("RealtimeMesh.Collision.DiskCache.Directory"),
+	TEXT(""),
+	TEXT("Directory for the cooked collision cache, relative paths are relative to the project directory.\n")
+	TEXT("Empty uses Saved/RealtimeMesh/CollisionCache."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCollisionDiskCacheMaxSizeMB(
+	TEXT("RealtimeMesh.Collision.DiskCache.MaxSizeMB"),
+	512,
+	TEXT("Size the cooked collision cache is trimmed to by evicting the least recently used entries."),
+	ECVF_Default);
+
+namespace RealtimeMesh
+{
+	namespace CollisionDiskCache
+	{
+		static constexpr uint32 FileMagic = 0x43434D52; // RMCC
+		static constexpr int32 FileVersion = 1;
+		static const TCHAR* FileExtension = TEXT(".rmcc");
+	}
+
+	FRealtimeMeshCollisionDiskCache::FRealtimeMeshCollisionDiskCache(const FString& InDirectory, int64 InMaxSizeBytes)
+		: Directory(InDirectory)
+		, MaxSizeBytes(InMaxSizeBytes)
+		, CurrentSizeBytes(INDEX_NONE)
+	{
+	}
+
+	bool FRealtimeMeshCollisionDiskCache::TryLoad(uint64 Key, TSharedPtr<FRealtimeMeshCookedTriMeshData>& OutCooked)
+	{
+		const FString Path = GetEntryPath(Key);
+
+		TArray<uint8> FileData;
+		if (!FFileHelper::LoadFileToArray(FileData, *Path, FILEREAD_Silent))
+		{
+			FScopeLock ScopeLock(&Lock);
+			Stats.Misses++;
+			INC_DWORD_STAT(STAT_RealtimeMeshCollision_DiskCacheMisses);
+			return false;
+		}
+
+		FMemoryReader Reader(FileData);
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		uint64 StoredKey = 0;
+		FCustomVersionContainer CustomVersions;
+		int64 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+		Reader << Magic;
+		Reader << Version;
+		Reader << StoredKey;
+		if (!Reader.IsError() && Magic == CollisionDiskCache::FileMagic && Version == CollisionDiskCache::FileVersion && StoredKey == Key)
+		{
+			CustomVersions.Serialize(Reader);
+			Reader << PayloadSize;
+			Reader << PayloadCrc;
+		}
+
+		const int64 PayloadOffset = Reader.Tell();
+		bool bValid = !Reader.IsError() && Magic == CollisionDiskCache::FileMagic && Version == CollisionDiskCache::FileVersion && StoredKey == Key &&
+			PayloadSize > 0 && PayloadOffset + PayloadSize == FileData.Num() &&
+			FCrc::MemCrc32(FileData.GetData() + PayloadOffset, static_cast<int32>(PayloadSize)) == PayloadCrc;
+
+		// Only deserialize payloads that passed the checksum, chaos doesn't cope well with garbage
+		TSharedPtr<FRealtimeMeshCookedTriMeshData> Cooked;
+		if (bValid)
+		{
+			Reader.SetCustomVersions(CustomVersions);
+			Cooked = MakeShared<FRealtimeMeshCookedTriMeshData>();
+			Reader << *Cooked;
+			bValid = !Reader.IsError() && Reader.Tell() == FileData.Num() && Cooked->HasMesh();
+		}
+
+		if (!bValid)
+		{
+			UE_LOG(LogRealtimeMesh, Warning, TEXT("Deleting corrupt cooked collision cache entry %s"), *Path);
+			IFileManager::Get().Delete(*Path, false, false, true);
+
+			FScopeLock ScopeLock(&Lock);
+			Stats.Corrupt++;
+			Stats.Misses++;
+			INC_DWORD_STAT(STAT_RealtimeMeshCollision_DiskCacheMisses);
+			if (CurrentSizeBytes != INDEX_NONE)
+			{
+				CurrentSizeBytes = FMath::Max<int64>(0, CurrentSizeBytes - FileData.Num());
+			}
+			return false;
+		}
+
+		// Keep recently used entries from being evicted
+		IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+
+		OutCooked = MoveTemp(Cooked);
+
+		FScopeLock ScopeLock(&Lock);
+		Stats.Hits++;
+		INC_DWORD_STAT(STAT_RealtimeMeshCollision_DiskCacheHits);
+		return true;
+	}
+
+	void FRealtimeMeshCollisionDiskCache::Store(uint64 Key, FRealtimeMeshCookedTriMeshData& Cooked)
+	{
+		if (!Cooked.HasMesh())
+		{
+			return;
+		}
+
+		TArray<uint8> Payload;
+		FMemoryWriter PayloadWriter(Payload);
+		PayloadWriter << Cooked;
+		if (PayloadWriter.IsError() || Payload.Num() == 0)
+		{
+			return;
+		}
+
+		uint32 Magic = CollisionDiskCache::FileMagic;
+		int32 Version = CollisionDiskCache::FileVersion;
+		FCustomVersionContainer CustomVersions = PayloadWriter.GetCustomVersions();
+		int64 PayloadSize = Payload.Num();
+		uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+		TArray<uint8> FileData;
+		FMemoryWriter Writer(FileData);
+		Writer << Magic;
+		Writer << Version;
+		Writer << Key;
+		CustomVersions.Serialize(Writer);
+		Writer << PayloadSize;
+		Writer << PayloadCrc;
+		FileData.Append(Payload);
+
+		// Write to a temp file first so readers never see a partial entry
+		const FString Path = GetEntryPath(Key);
+		const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(FileData, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true, false, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			return;
+		}
+
+		FScopeLock ScopeLock(&Lock);
+		Stats.Writes++;
+		if (CurrentSizeBytes != INDEX_NONE)
+		{
+			CurrentSizeBytes += FileData.Num();
+		}
+		if (CurrentSizeBytes == INDEX_NONE || CurrentSizeBytes > MaxSizeBytes)
+		{
+			EvictToSizeLimit();
+		}
+	}
+
+	FString FRealtimeMeshCollisionDiskCache::GetEntryPath(uint64 Key) const
+	{
+		return FPaths::Combine(Directory, FString::Printf(TEXT("%016llx"), Key) + CollisionDiskCache::FileExtension);
+	}
+
+	FRealtimeMeshCollisionDiskCacheStats FRealtimeMeshCollisionDiskCache::GetStats() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return Stats;
+	}
+
+	FRealtimeMeshCollisionDiskCache* FRealtimeMeshCollisionDiskCache::Get()
+	{
+		if (CVarRealtimeMeshCollisionDiskCacheEnable.GetValueOnAnyThread() == 0)
+		{
+			return nullptr;
+		}
+
+		FString CacheDirectory = CVarRealtimeMeshCollisionDiskCacheDirectory.GetValueOnAnyThread();
+		if (CacheDirectory.IsEmpty())
+		{
+			CacheDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RealtimeMesh"), TEXT("CollisionCache"));
+		}
+		else if (FPaths::IsRelative(CacheDirectory))
+		{
+			CacheDirectory = FPaths::Combine(FPaths::ProjectDir(), CacheDirectory);
+		}
+		const int64 MaxSize = FMath::Max<int64>(0, CVarRealtimeMeshCollisionDiskCacheMaxSizeMB.GetValueOnAnyThread()) * 1024 * 1024;
+
+		FRealtimeMeshCollisionDiskCache& Cache = TLazySingleton<FRealtimeMeshCollisionDiskCache>::Get();
+		Cache.Configure(CacheDirectory, MaxSize);
+		return &Cache;
+	}
+
+	void FRealtimeMeshCollisionDiskCache::Configure(const FString& InDirectory, int64 InMaxSizeBytes)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Directory != InDirectory)
+		{
+			Directory = InDirectory;
+			CurrentSizeBytes = INDEX_NONE;
+		}
+		MaxSizeBytes = InMaxSizeBytes;
+	}
+
+	void FRealtimeMeshCollisionDiskCache::EvictToSizeLimit()
+	{
+		struct FEntry
+		{
+			FString Path;
+			int64 Size;
+			FDateTime AccessTime;
+		};
+
+		// Rescanning keeps the size right when several processes share a cache directory
+		TArray<FEntry> Entries;
+		int64 TotalSize = 0;
+		IFileManager::Get().IterateDirectoryStat(*Directory, [&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			if (!StatData.bIsDirectory && FStringView(FilenameOrDirectory).EndsWith(CollisionDiskCache::FileExtension))
+			{
+				Entries.Add({ FilenameOrDirectory, StatData.FileSize, StatData.ModificationTime });
+				TotalSize += StatData.FileSize;
+			}
+			return true;
+		});
+
+		if (TotalSize > MaxSizeBytes)
+		{
+			Entries.Sort([](const FEntry& A, const FEntry& B) { return A.AccessTime < B.AccessTime; });
+
+			for (const FEntry& Entry : Entries)
+			{
+				if (TotalSize <= MaxSizeBytes)
+				{
+					break;
+				}
+				if (IFileManager::Get().Delete(*Entry.Path, false, false, true))
+				{
+					TotalSize -= Entry.Size;
+					Stats.Evictions++;
+				}
+			}
+		}
+
+		CurrentSizeBytes = TotalSize;
+	}
+}
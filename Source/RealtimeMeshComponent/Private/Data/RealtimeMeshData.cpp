@@ -64,7 +64,8 @@ namespace RealtimeMesh
 		return Bounds.Get();
 	}
 
-	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMesh::UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey)
+	TFuture<ERealtimeMeshCollisionUpdateResult> FRealtimeMesh::UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey,
+		const FRealtimeMeshCollisionCookToken& CookToken)
 	{
 		// TODO: We can skip cook based on simpleascomplex or complexassimple
 		TArray<int32> MeshesNeedingCook = InCollisionData.ComplexGeometry.GetMeshIDsNeedingCook();
@@ -74,8 +75,13 @@ namespace RealtimeMesh
 		// Cook all meshes/convex's that need to be cooked.
 		if (bNeedsCookAnything)
 		{
-			ParallelForTemplate(MeshesNeedingCook.Num() + ConvexObjectsNeedingCook.Num(), [&InCollisionData, &MeshesNeedingCook, &ConvexObjectsNeedingCook](int32 Index)
+			ParallelForTemplate(MeshesNeedingCook.Num() + ConvexObjectsNeedingCook.Num(), [&InCollisionData, &MeshesNeedingCook, &ConvexObjectsNeedingCook, &CookToken](int32 Index)
 			{
+				if (CookToken.IsCancelled())
+				{
+					return;
+				}
+				
 				if (Index < MeshesNeedingCook.Num())
 				{
 					URealtimeMeshCollisionTools::CookComplexMesh(InCollisionData.ComplexGeometry.GetByIndex(MeshesNeedingCook[Index]));
@@ -87,13 +93,20 @@ namespace RealtimeMesh
 			});
 		}
 
-		return DoOnGameThread([ThisWeak = this->AsWeak(), CollisionData = MoveTemp(InCollisionData), NewCollisionKey]() mutable
+		// A newer update superseded this one, so what we have may be partially cooked
+		if (CookToken.IsCancelled())
+		{
+			return MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Ignored).GetFuture();
+		}
+
+		return DoOnGameThread([ThisWeak = this->AsWeak(), CollisionData = MoveTemp(InCollisionData), NewCollisionKey, CookToken]() mutable
 		{
 			check(IsInGameThread());
 
 			auto Pinned = ThisWeak.Pin();
 
-			if (!Pinned)
+			// Superseded while waiting for the game thread, the newer update applies its own collision
+			if (!Pinned || CookToken.IsCancelled())
 			{
 				return ERealtimeMeshCollisionUpdateResult::Ignored;
 			}
@@ -94,6 +94,8 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshSection::UpdateStreamRange(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamRange& InRange)
 	{
+		// An unchanged range leaves the proxy's draw commands as they are
+		const bool bRangeChanged = StreamRange != InRange;
 		StreamRange = InRange;
 
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
@@ -101,7 +103,7 @@ namespace RealtimeMesh
 			ProxyBuilder->AddSectionTask(Key, [StreamRange = StreamRange](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionProxy& Proxy)
 			{
 				Proxy.UpdateStreamRange(StreamRange);
-			}, ShouldRecreateProxyOnChange(UpdateContext));
+			}, bRangeChanged && ShouldRecreateProxyOnChange(UpdateContext));
 		}
 
 		UpdateContext.GetState().StreamRangeDirtyTree.Flag(Key);
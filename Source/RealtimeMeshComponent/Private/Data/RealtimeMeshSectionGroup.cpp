@@ -7,6 +7,7 @@
 #include "RenderProxy/RealtimeMeshGPUBuffer.h"
 #include "RenderProxy/RealtimeMeshProxyCommandBatch.h"
 #include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
+#include "RenderProxy/RealtimeMeshVertexFactory.h"
 #include "Logging/MessageLog.h"
 
 #define LOCTEXT_NAMESPACE "RealtimeMesh"
@@ -83,6 +84,7 @@ namespace RealtimeMesh
 	{
 		Config = InConfig;
 		Streams.Empty();
+		ProxyStreamShapes.Empty();
 		Sections.Empty();
 		Bounds.Reset();
 
@@ -143,10 +145,17 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshSectionGroup::UpdateConfig(FRealtimeMeshUpdateContext& UpdateContext, TFunction<void(FRealtimeMeshSectionGroupConfig&)> EditFunc)
 	{
+		const FRealtimeMeshSectionGroupConfig OldConfig = Config;
 		bool bShouldRecreateProxy = ShouldRecreateProxyOnChange(UpdateContext);
 		EditFunc(Config);
 		bShouldRecreateProxy |= ShouldRecreateProxyOnChange(UpdateContext);
 
+		// Config changes can move streams between buffers, so the next upload of each stream rebuilds the proxy's bindings
+		if (Config != OldConfig)
+		{
+			ProxyStreamShapes.Empty();
+		}
+
 		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
 		{
 			ProxyBuilder->AddSectionGroupTask(Key, [Config = Config](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
@@ -167,27 +176,21 @@ namespace RealtimeMesh
 		Streams.FindOrAdd(StreamKey, &bAlreadyExisted);
 
 		// Create the update data for the GPU
-		if (SharedResources->WantsStreamOnGPU(StreamKey))
+		if (ShouldSendStreamToProxy(StreamKey))
 		{
-			if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+			if (UpdateContext.GetProxyBuilder())
 			{
 				if (Stream.Num() > 0)
 				{
-					FRealtimeMeshStream StreamCopy(Stream);
-					const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(StreamCopy), EBufferUsageFlags::Static);
-					UpdateData->CreateBufferAsyncIfPossible(UpdateContext);
+					DecodeStreamForProxy(Stream);
+					const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(Stream), EBufferUsageFlags::Static);
 
-					ProxyBuilder->AddSectionGroupTask(Key, [UpdateData = UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.CreateOrUpdateStream(RHICmdList, UpdateData);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+					// The proxy writes a matching update over its existing buffer, so there's no new buffer to create or draw commands to invalidate.
+					SendStreamToProxy(UpdateContext, UpdateData, UpdateProxyStreamShape(*UpdateData));
 				}
 				else
 				{
-					ProxyBuilder->AddSectionGroupTask(Key, [StreamKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.RemoveStream(StreamKey);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+					RemoveStreamFromProxy(UpdateContext, StreamKey);
 				}
 			}
 		}
@@ -195,19 +198,51 @@ namespace RealtimeMesh
 		UpdateContext.GetState().StreamDirtyTree.Flag(Key, StreamKey);
 	}
 
+	void FRealtimeMeshSectionGroup::DecodeStreamForProxy(FRealtimeMeshStream& Stream) const
+	{
+		FRealtimeMeshLocalVertexFactory::DecodeStreamForFetch(Stream, Config.PositionQuantization);
+	}
+
+	void FRealtimeMeshSectionGroup::UpdateStreamRange(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& RangeData, int32 DestinationIndex)
+	{
+		const auto StreamKey = RangeData.GetStreamKey();
+
+		if (!Streams.Contains(StreamKey) || DestinationIndex < 0)
+		{
+			FMessageLog("RealtimeMesh").Error(
+				FText::Format(LOCTEXT("UpdateStreamRange_InvalidStream", "Unable to update range of stream {0} in mesh {1}. Stream does not exist or destination is invalid."),
+							  FText::FromString(StreamKey.ToString()), FText::FromName(SharedResources->GetMeshName())));
+			return;
+		}
+
+		// Only the changed rows are sent, the existing buffer is written in place so the proxy doesn't need recreating
+		if (ShouldSendStreamToProxy(StreamKey) && RangeData.Num() > 0)
+		{
+			if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+			{
+				DecodeStreamForProxy(RangeData);
+				const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(RangeData), DestinationIndex);
+
+				ProxyBuilder->AddSectionGroupStreamTask(Key, StreamKey, UpdateData->GetStream().GetResourceDataSize(),
+					[UpdateData = UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+				{
+					Proxy.UpdateStreamRange(RHICmdList, UpdateData);
+				}, false, false);
+			}
+		}
+
+		UpdateContext.GetState().StreamDirtyTree.Flag(Key, StreamKey);
+	}
+
 	void FRealtimeMeshSectionGroup::RemoveStream(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey)
 	{
 		if (Streams.Remove(StreamKey))
 		{
-			if (SharedResources->WantsStreamOnGPU(StreamKey))
+			ProxyStreamShapes.Remove(StreamKey);
+
+			if (ShouldSendStreamToProxy(StreamKey))
 			{
-				if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
-				{
-					ProxyBuilder->AddSectionGroupTask(Key, [StreamKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.RemoveStream(StreamKey);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
-				}
+				RemoveStreamFromProxy(UpdateContext, StreamKey);
 			}
 		}
 
@@ -340,6 +375,60 @@ namespace RealtimeMesh
 		}
 	}
 
+	bool FRealtimeMeshSectionGroup::UpdateProxyStreamShape(const FRealtimeMeshSectionGroupStreamUpdateData& UpdateData)
+	{
+		const FRealtimeMeshProxyStreamShape NewShape { UpdateData.GetBufferLayout(), UpdateData.GetNumElements(), UpdateData.GetInterleavedLayout() };
+
+		FRealtimeMeshProxyStreamShape* ExistingShape = ProxyStreamShapes.Find(UpdateData.GetStreamKey());
+		if (ExistingShape && *ExistingShape == NewShape)
+		{
+			return FRealtimeMeshGPUBuffer::ShouldReuseBuffersInPlace();
+		}
+
+		ProxyStreamShapes.Add(UpdateData.GetStreamKey(), NewShape);
+		return false;
+	}
+
+	void FRealtimeMeshSectionGroup::SendStreamToProxy(FRealtimeMeshUpdateContext& UpdateContext, const TSharedRef<FRealtimeMeshSectionGroupStreamUpdateData>& UpdateData, bool bUpdatesInPlace)
+	{
+		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+		{
+			const FRealtimeMeshStreamKey StreamKey = UpdateData->GetStreamKey();
+
+			// An upload still waiting on the render thread gets dropped in favor of this one. Updates are coming in faster than the
+			// render thread takes them, so leave the buffer for the render thread to create once it knows which upload is the last.
+			// Ring backed streams are written into the proxy's ring instead.
+			const bool bReplacesQueuedUpload = PendingProxyUploads.FindRef(StreamKey).IsValid();
+			if (!bUpdatesInPlace && !bReplacesQueuedUpload && !FRealtimeMeshGPUBuffer::ShouldUseRingBuffer(Config.DrawType, StreamKey))
+			{
+				UpdateData->CreateBufferAsyncIfPossible(UpdateContext);
+			}
+			PendingProxyUploads.Add(StreamKey, UpdateData);
+
+			ProxyBuilder->AddSectionGroupStreamTask(Key, StreamKey, UpdateData->GetStream().GetResourceDataSize(),
+				[UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+			{
+				// The game thread may be writing rows this upload still shares with its stored stream, see FRealtimeMeshSectionGroupSimple::EditMeshDataRanges
+				FScopeLock StreamDataLock(&UpdateData->GetStreamDataLock());
+				Proxy.CreateOrUpdateStream(RHICmdList, UpdateData);
+			}, true, !bUpdatesInPlace && ShouldRecreateProxyOnChange(UpdateContext));
+		}
+	}
+
+	void FRealtimeMeshSectionGroup::RemoveStreamFromProxy(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey)
+	{
+		ProxyStreamShapes.Remove(StreamKey);
+		PendingProxyUploads.Remove(StreamKey);
+
+		if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+		{
+			ProxyBuilder->AddSectionGroupStreamTask(Key, StreamKey, 0, [StreamKey](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+			{
+				Proxy.RemoveStream(StreamKey);
+			}, true, ShouldRecreateProxyOnChange(UpdateContext));
+		}
+	}
+
 	void FRealtimeMeshSectionGroup::FinalizeUpdate(FRealtimeMeshUpdateContext& UpdateContext)
 	{
 		for (const auto& Section : Sections)
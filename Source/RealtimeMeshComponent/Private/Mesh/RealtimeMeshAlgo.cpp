@@ -6,6 +6,7 @@
 #include "Core/RealtimeMeshBuilder.h"
 #include "Core/RealtimeMeshDataStream.h"
 #include "Core/RealtimeMeshDataTypes.h"
+#include "Async/ParallelFor.h"
 
 using namespace RealtimeMesh;
 
@@ -282,235 +283,794 @@ TOptional<TMap<int32, FRealtimeMeshStreamRange>> RealtimeMeshAlgo::GetStreamRang
 }
 
 
-void RealtimeMeshAlgo::GenerateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bComputeSmoothNormals)
+namespace RealtimeMeshAlgo
 {
-	if (!StreamSet.Contains(FRealtimeMeshStreams::Triangles) || !StreamSet.Contains(FRealtimeMeshStreams::Position))
+	namespace Private
 	{
-		return;
-	}
+		static constexpr int32 TangentsParallelBatchSize = 4096;
 
-	TRealtimeMeshStreamBuilder<FVector3f> Positions(StreamSet.FindChecked(FRealtimeMeshStreams::Position));
-	TRealtimeMeshStreamBuilder<TIndex3<uint32>> Triangles(StreamSet.FindChecked(FRealtimeMeshStreams::Triangles));
-	TOptional<TRealtimeMeshStridedStreamBuilder<FVector2f, void>> TexCoords;
+		// Runs Func for [0, Num) in fixed size batches, single threaded when there's only one batch
+		template <typename FuncType>
+		static void ParallelForBatched(int32 Num, const FuncType& Func)
+		{
+			const int32 NumBatches = FMath::DivideAndRoundUp(Num, TangentsParallelBatchSize);
+			ParallelFor(NumBatches, [&](int32 BatchIndex)
+			{
+				const int32 Start = BatchIndex * TangentsParallelBatchSize;
+				const int32 End = FMath::Min(Start + TangentsParallelBatchSize, Num);
+				for (int32 Index = Start; Index < End; Index++)
+				{
+					Func(Index);
+				}
+			}, NumBatches > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+		}
 
-	if (StreamSet.Contains(FRealtimeMeshStreams::TexCoords))
-	{
-		TexCoords = TRealtimeMeshStridedStreamBuilder<FVector2f, void>(StreamSet.FindChecked(FRealtimeMeshStreams::TexCoords));
-	}
+		/*
+		 * Spatial hash of vertex positions used to find vertices that are FVector3f::Equals to each other.
+		 * Cells are larger than the tolerance so a match can only be in the neighbouring cells when the
+		 * position is within tolerance of a cell boundary, which is rare, so most queries only look at one cell.
+		 */
+		class FPositionHashGrid
+		{
+			static constexpr double Tolerance = KINDA_SMALL_NUMBER;
+			static constexpr double CellSize = KINDA_SMALL_NUMBER * 4.0;
 
-	StreamSet.Remove(FRealtimeMeshStreams::Tangents);
-	TRealtimeMeshStreamBuilder<FRealtimeMeshTangentsNormalPrecision> Tangents(StreamSet.AddStream<FRealtimeMeshTangentsNormalPrecision>(FRealtimeMeshStreams::Tangents));
-	Tangents.SetNumZeroed(Positions.Num());
-	
-	uint32 NumIndices = Triangles.Num() * 3;
-	uint32 NumVertices = Positions.Num();
+			TConstArrayView<const FVector3f> Vertices;
+			TMap<FInt64Vector, int32> CellHeads;
+			TArray<int32> NextInCell;
 
-	// Calculate the duplicate vertices map if we're wanting smooth normals.  Don't find duplicates if we don't want smooth normals
-	// that will cause it to only smooth across faces sharing a common vertex, not across faces with vertices of common position
-	TMultiMap<uint32, uint32> DuplicateVertexMap;
+			static FInt64Vector GetCell(const FVector3f& Position)
+			{
+				return FInt64Vector(
+					static_cast<int64>(FMath::FloorToDouble(Position.X / CellSize)),
+					static_cast<int64>(FMath::FloorToDouble(Position.Y / CellSize)),
+					static_cast<int64>(FMath::FloorToDouble(Position.Z / CellSize)));
+			}
 
-	if (bComputeSmoothNormals)
-	{
-		using namespace Private;
+			static void GetSearchOffsets(float Value, int64& OutMin, int64& OutMax)
+			{
+				const double Scaled = Value / CellSize;
+				const double Frac = Scaled - FMath::FloorToDouble(Scaled);
+				OutMin = Frac * CellSize <= Tolerance ? -1 : 0;
+				OutMax = (1.0 - Frac) * CellSize <= Tolerance ? 1 : 0;
+			}
+
+		public:
+			FPositionHashGrid(TConstArrayView<const FVector3f> InVertices)
+				: Vertices(InVertices)
+			{
+				CellHeads.Reserve(Vertices.Num());
+				NextInCell.SetNumUninitialized(Vertices.Num());
+
+				for (int32 VertIdx = 0; VertIdx < Vertices.Num(); VertIdx++)
+				{
+					int32& Head = CellHeads.FindOrAdd(GetCell(Vertices[VertIdx]), INDEX_NONE);
+					NextInCell[VertIdx] = Head;
+					Head = VertIdx;
+				}
+			}
+
+			template <typename FuncType>
+			void ForEachDuplicate(int32 VertIdx, const FuncType& Func) const
+			{
+				const FVector3f& Position = Vertices[VertIdx];
+				const FInt64Vector Cell = GetCell(Position);
+
+				int64 MinX, MaxX, MinY, MaxY, MinZ, MaxZ;
+				GetSearchOffsets(Position.X, MinX, MaxX);
+				GetSearchOffsets(Position.Y, MinY, MaxY);
+				GetSearchOffsets(Position.Z, MinZ, MaxZ);
+
+				for (int64 X = MinX; X <= MaxX; X++)
+				{
+					for (int64 Y = MinY; Y <= MaxY; Y++)
+					{
+						for (int64 Z = MinZ; Z <= MaxZ; Z++)
+						{
+							if (const int32* Head = CellHeads.Find(Cell + FInt64Vector(X, Y, Z)))
+							{
+								for (int32 OtherIdx = *Head; OtherIdx != INDEX_NONE; OtherIdx = NextInCell[OtherIdx])
+								{
+									if (OtherIdx != VertIdx && Position.Equals(Vertices[OtherIdx]))
+									{
+										Func(OtherIdx);
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		};
 
-		TArray<FRealtimeMeshVertexSortElement> VertexSorter;
-		VertexSorter.Empty(NumVertices);
-		for (uint32 Index = 0; Index < NumVertices; Index++)
+		static void ComputeFaceTangents(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices, TConstArrayView<const FVector2f> UVs,
+		                                int32 TriIdx, FVector3f& OutTangentX, FVector3f& OutTangentY, FVector3f& OutTangentZ)
 		{
-			new(VertexSorter)FRealtimeMeshVertexSortElement(Index, Positions[Index]);
+			const uint32 CornerIndex[3] = { Indices[TriIdx * 3 + 0], Indices[TriIdx * 3 + 1], Indices[TriIdx * 3 + 2] };
+			const FVector3f P[3] = { Vertices[CornerIndex[0]], Vertices[CornerIndex[1]], Vertices[CornerIndex[2]] };
+
+			// Calculate triangle edge vectors and normal
+			const FVector3f Edge21 = P[1] - P[2];
+			const FVector3f Edge20 = P[0] - P[2];
+			const FVector3f TriNormal = (Edge21 ^ Edge20).GetSafeNormal();
+
+			// If we have UVs, use those to calculate
+			if (UVs.Num() > 0)
+			{
+				const FVector2f T1 = UVs[CornerIndex[0]];
+				const FVector2f T2 = UVs[CornerIndex[1]];
+				const FVector2f T3 = UVs[CornerIndex[2]];
+
+				FMatrix44f ParameterToLocal(
+					FPlane4f(P[1].X - P[0].X, P[1].Y - P[0].Y, P[1].Z - P[0].Z, 0),
+					FPlane4f(P[2].X - P[0].X, P[2].Y - P[0].Y, P[2].Z - P[0].Z, 0),
+					FPlane4f(P[0].X, P[0].Y, P[0].Z, 0),
+					FPlane4f(0, 0, 0, 1)
+				);
+
+				FMatrix44f ParameterToTexture(
+					FPlane4f(T2.X - T1.X, T2.Y - T1.Y, 0, 0),
+					FPlane4f(T3.X - T1.X, T3.Y - T1.Y, 0, 0),
+					FPlane4f(T1.X, T1.Y, 1, 0),
+					FPlane4f(0, 0, 0, 1)
+				);
+
+				const FMatrix44f TextureToLocal = ParameterToTexture.Inverse() * ParameterToLocal;
+
+				OutTangentX = TextureToLocal.TransformVector(FVector3f(1, 0, 0)).GetSafeNormal();
+				OutTangentY = TextureToLocal.TransformVector(FVector3f(0, 1, 0)).GetSafeNormal();
+			}
+			else
+			{
+				OutTangentX = Edge20.GetSafeNormal();
+				OutTangentY = (OutTangentX ^ TriNormal).GetSafeNormal();
+			}
+
+			OutTangentZ = TriNormal;
+		}
+
+		static void FinalizeVertexTangents(FVector3f& TangentX, FVector3f& TangentY, FVector3f& TangentZ)
+		{
+			TangentX.Normalize();
+			TangentZ.Normalize();
+
+			// Use Gram-Schmidt orthogonalization to make sure X is orthonormal with Z
+			TangentX -= TangentZ * (TangentZ | TangentX);
+			TangentX.Normalize();
+			TangentY.Normalize();
+		}
+
+		struct FMikkTSpaceFace
+		{
+			// Normalized UV derivative along U
+			FVector3f Tangent;
+			bool bOrientationPreserving;
+			bool bValid;
+		};
+
+		static FMikkTSpaceFace ComputeMikkTSpaceFace(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices,
+		                                             TConstArrayView<const FVector2f> UVs, int32 TriIdx)
+		{
+			const uint32 CornerIndex[3] = { Indices[TriIdx * 3 + 0], Indices[TriIdx * 3 + 1], Indices[TriIdx * 3 + 2] };
+			const FVector3f P[3] = { Vertices[CornerIndex[0]], Vertices[CornerIndex[1]], Vertices[CornerIndex[2]] };
+
+			const FVector3f Edge1 = P[1] - P[0];
+			const FVector3f Edge2 = P[2] - P[0];
+			const FVector2f UVEdge1 = UVs[CornerIndex[1]] - UVs[CornerIndex[0]];
+			const FVector2f UVEdge2 = UVs[CornerIndex[2]] - UVs[CornerIndex[0]];
+
+			FMikkTSpaceFace Face;
+			Face.Tangent = FVector3f::ZeroVector;
+			Face.bOrientationPreserving = true;
+			Face.bValid = false;
+
+			// Triangles with no UV area have no defined tangent, MikkTSpace leaves them out of the vertex average
+			const float SignedUVAreaX2 = UVEdge1.X * UVEdge2.Y - UVEdge1.Y * UVEdge2.X;
+			const FVector3f TriNormal = (P[1] - P[2]) ^ (P[0] - P[2]);
+			if (FMath::Abs(SignedUVAreaX2) <= UE_SMALL_NUMBER || TriNormal.IsNearlyZero(UE_SMALL_NUMBER))
+			{
+				return Face;
+			}
+
+			// Both derivatives are scaled by the signed area, the sign cancels out once normalized
+			const FVector3f ScaledTangent = Edge1 * UVEdge2.Y - Edge2 * UVEdge1.Y;
+			const FVector3f ScaledBinormal = Edge2 * UVEdge1.X - Edge1 * UVEdge2.X;
+			const float Sign = SignedUVAreaX2 > 0.0f ? 1.0f : -1.0f;
+
+			Face.Tangent = (ScaledTangent * Sign).GetSafeNormal();
+			Face.bValid = !Face.Tangent.IsZero();
+
+			// Measured against our winding rather than the raw UV area so the binormal lands on +V like the face averaged path
+			Face.bOrientationPreserving = ((TriNormal ^ ScaledTangent) | ScaledBinormal) >= 0.0f;
+			return Face;
 		}
 
-		// Sort the list
-		VertexSorter.Sort(FRuntimeMeshVertexSortingFunction());
+		static FVector3f ProjectOntoPlane(const FVector3f& Vector, const FVector3f& Normal)
+		{
+			return (Vector - Normal * (Normal | Vector)).GetSafeNormal();
+		}
 
-		// Map out the duplicates.
-		for (uint32 Index = 0; Index < NumVertices; Index++)
+		// Reads the positions directly when they're already FVector3f, otherwise converts them into OutStorage
+		static TConstArrayView<const FVector3f> GetPositions(const FRealtimeMeshStream& PositionStream, TArray<FVector3f>& OutStorage)
 		{
-			uint32 SrcVertIdx = VertexSorter[Index].Index;
-			float Value = VertexSorter[Index].Value;
+			if (PositionStream.GetLayout() == GetRealtimeMeshBufferLayout<FVector3f>())
+			{
+				return PositionStream.GetArrayView<FVector3f>();
+			}
+
+			const TRealtimeMeshStreamBuilder<const FVector3f, void> Positions(PositionStream);
+			OutStorage.SetNumUninitialized(PositionStream.Num());
+			for (int32 VertIdx = 0; VertIdx < OutStorage.Num(); VertIdx++)
+			{
+				OutStorage[VertIdx] = Positions.GetValue(VertIdx);
+			}
+			return OutStorage;
+		}
 
-			// Search forward adding pairs both ways
-			for (uint32 SubIndex = Index + 1; SubIndex < NumVertices; SubIndex++)
+		static void GetClampedIndices(const FRealtimeMeshStream& TrianglesStream, int32 NumVertices, TArray<uint32>& OutIndices)
+		{
+			OutIndices.Reset();
+			if (NumVertices > 0)
 			{
-				if (FMath::Abs(VertexSorter[SubIndex].Value - Value) > THRESH_POINTS_ARE_SAME * 4.01f)
+				const TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> Triangles(TrianglesStream);
+				OutIndices.SetNumUninitialized(Triangles.Num() * 3);
+				for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
 				{
-					// No more possible duplicates
-					break;
+					for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
+					{
+						// Find vert index (clamped within range)
+						OutIndices[TriIdx * 3 + CornerIdx] = FMath::Min(Triangles.GetElementValue(TriIdx, CornerIdx), uint32(NumVertices - 1));
+					}
 				}
+			}
+		}
+	}
+}
+
+void RealtimeMeshAlgo::FRealtimeMeshVertexAdjacency::Build(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices, bool bFindDuplicates)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshVertexAdjacency::Build);
+
+	const int32 NumVerts = Vertices.Num();
+	const int32 NumTris = Indices.Num() / 3;
 
-				uint32 OtherVertIdx = VertexSorter[SubIndex].Index;
-				if (Positions.GetValue(SrcVertIdx).Equals(Positions.GetValue(OtherVertIdx)))
+	// A triangle is only added once to each vertex, even if it references it more than once
+	auto IsFirstUseInTriangle = [&Indices](int32 TriIdx, int32 CornerIdx)
+	{
+		const uint32 VertIdx = Indices[TriIdx * 3 + CornerIdx];
+		return (CornerIdx < 1 || Indices[TriIdx * 3 + 0] != VertIdx) && (CornerIdx < 2 || Indices[TriIdx * 3 + 1] != VertIdx);
+	};
+
+	VertexTriangleOffsets.Reset();
+	VertexTriangleOffsets.SetNumZeroed(NumVerts + 1);
+	for (int32 TriIdx = 0; TriIdx < NumTris; TriIdx++)
+	{
+		for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
+		{
+			if (IsFirstUseInTriangle(TriIdx, CornerIdx))
+			{
+				check(Indices[TriIdx * 3 + CornerIdx] < static_cast<uint32>(NumVerts));
+				VertexTriangleOffsets[Indices[TriIdx * 3 + CornerIdx] + 1]++;
+			}
+		}
+	}
+
+	for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+	{
+		VertexTriangleOffsets[VertIdx + 1] += VertexTriangleOffsets[VertIdx];
+	}
+
+	VertexTriangles.SetNumUninitialized(VertexTriangleOffsets[NumVerts]);
+	{
+		TArray<int32> WritePositions(VertexTriangleOffsets.GetData(), NumVerts);
+		for (int32 TriIdx = 0; TriIdx < NumTris; TriIdx++)
+		{
+			for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
+			{
+				if (IsFirstUseInTriangle(TriIdx, CornerIdx))
 				{
-					DuplicateVertexMap.AddUnique(SrcVertIdx, OtherVertIdx);
-					DuplicateVertexMap.AddUnique(OtherVertIdx, SrcVertIdx);
+					VertexTriangles[WritePositions[Indices[TriIdx * 3 + CornerIdx]]++] = TriIdx;
 				}
 			}
 		}
 	}
 
-	// Number of triangles
-	const uint32 NumTris = NumIndices / 3;
+	DuplicateOffsets.Reset();
+	Duplicates.Reset();
+
+	if (bFindDuplicates)
+	{
+		const Private::FPositionHashGrid Grid(Vertices);
+
+		DuplicateOffsets.SetNumZeroed(NumVerts + 1);
+		Private::ParallelForBatched(NumVerts, [&](int32 VertIdx)
+		{
+			int32 Count = 0;
+			Grid.ForEachDuplicate(VertIdx, [&Count](int32) { Count++; });
+			DuplicateOffsets[VertIdx + 1] = Count;
+		});
+
+		for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+		{
+			DuplicateOffsets[VertIdx + 1] += DuplicateOffsets[VertIdx];
+		}
+
+		Duplicates.SetNumUninitialized(DuplicateOffsets[NumVerts]);
+		Private::ParallelForBatched(NumVerts, [&](int32 VertIdx)
+		{
+			int32 WritePosition = DuplicateOffsets[VertIdx];
+			Grid.ForEachDuplicate(VertIdx, [&](int32 OtherIdx) { Duplicates[WritePosition++] = OtherIdx; });
+		});
+	}
+}
 
-	// Map of vertex to triangles in Triangles array
-	TMultiMap<uint32, uint32> VertToTriMap;
-	// Map of vertex to triangles to consider for normal calculation
-	TMultiMap<uint32, uint32> VertToTriSmoothMap;
+bool RealtimeMeshAlgo::FRealtimeMeshVertexAdjacency::Build(const RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bFindDuplicates)
+{
+	const FRealtimeMeshStream* PositionStream = StreamSet.Find(FRealtimeMeshStreams::Position);
+	const FRealtimeMeshStream* TrianglesStream = StreamSet.Find(FRealtimeMeshStreams::Triangles);
+	if (!PositionStream || !TrianglesStream)
+	{
+		return false;
+	}
+
+	TArray<FVector3f> PositionsData;
+	const TConstArrayView<const FVector3f> Positions = Private::GetPositions(*PositionStream, PositionsData);
+
+	TArray<uint32> Indices;
+	Private::GetClampedIndices(*TrianglesStream, Positions.Num(), Indices);
+
+	Build(Indices, Positions, bFindDuplicates);
+	return true;
+}
+
+void RealtimeMeshAlgo::GenerateTangentsFromAdjacency(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices,
+                                                     TConstArrayView<const FVector2f> UVs, const FRealtimeMeshVertexAdjacency& Adjacency,
+                                                     TArrayView<FVector3f> OutTangentX, TArrayView<FVector3f> OutTangentY, TArrayView<FVector3f> OutTangentZ)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::GenerateTangentsFromAdjacency);
+
+	const int32 NumVertices = Vertices.Num();
+	const int32 NumTris = Indices.Num() / 3;
+	check(Adjacency.NumVertices() == NumVertices);
+	check(UVs.Num() == 0 || UVs.Num() >= NumVertices);
+	check(OutTangentX.Num() >= NumVertices && OutTangentY.Num() >= NumVertices && OutTangentZ.Num() >= NumVertices);
 
 	// Normal/tangents for each face
 	TArray<FVector3f> FaceTangentX, FaceTangentY, FaceTangentZ;
-	FaceTangentX.AddUninitialized(NumTris);
-	FaceTangentY.AddUninitialized(NumTris);
-	FaceTangentZ.AddUninitialized(NumTris);
+	FaceTangentX.SetNumUninitialized(NumTris);
+	FaceTangentY.SetNumUninitialized(NumTris);
+	FaceTangentZ.SetNumUninitialized(NumTris);
 
-	// Iterate over triangles
-	for (uint32 TriIdx = 0; TriIdx < NumTris; TriIdx++)
+	Private::ParallelForBatched(NumTris, [&](int32 TriIdx)
 	{
-		uint32 CornerIndex[3];
-		FVector3f P[3];
+		Private::ComputeFaceTangents(Indices, Vertices, UVs, TriIdx, FaceTangentX[TriIdx], FaceTangentY[TriIdx], FaceTangentZ[TriIdx]);
+	});
 
-		for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
+	// Each vertex only reads the faces around it so they can be accumulated independently
+	Private::ParallelForBatched(NumVertices, [&](int32 VertIdx)
+	{
+		FVector3f TangentX = FVector3f::ZeroVector;
+		FVector3f TangentY = FVector3f::ZeroVector;
+		FVector3f TangentZ = FVector3f::ZeroVector;
+
+		for (const int32 TriIdx : Adjacency.GetVertexTriangles(VertIdx))
 		{
-			// Find vert index (clamped within range)
-			uint32 VertIndex = FMath::Min(Triangles.GetElementValue(TriIdx, CornerIdx), NumVertices - 1);
+			TangentX += FaceTangentX[TriIdx];
+			TangentY += FaceTangentY[TriIdx];
+			TangentZ += FaceTangentZ[TriIdx];
+		}
+
+		// Normals are also smoothed across the faces of vertices sharing our position (ie don't match UV, but do match smoothing)
+		for (const int32 OverlapVertIdx : Adjacency.GetDuplicates(VertIdx))
+		{
+			for (const int32 TriIdx : Adjacency.GetVertexTriangles(OverlapVertIdx))
+			{
+				TangentZ += FaceTangentZ[TriIdx];
+			}
+		}
+
+		Private::FinalizeVertexTangents(TangentX, TangentY, TangentZ);
+
+		OutTangentX[VertIdx] = TangentX;
+		OutTangentY[VertIdx] = TangentY;
+		OutTangentZ[VertIdx] = TangentZ;
+	});
+}
 
-			CornerIndex[CornerIdx] = VertIndex;
-			P[CornerIdx] = Positions.GetValue(VertIndex);
+void RealtimeMeshAlgo::GenerateMikkTSpaceTangentsFromAdjacency(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices,
+                                                               TConstArrayView<const FVector2f> UVs, TConstArrayView<const FVector3f> Normals,
+                                                               const FRealtimeMeshVertexAdjacency& Adjacency,
+                                                               TArrayView<FVector3f> OutTangentX, TArrayView<FVector3f> OutTangentY)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::GenerateMikkTSpaceTangentsFromAdjacency);
 
-			// Find/add this vert to index buffer
-			TArray<uint32> VertOverlaps;
-			DuplicateVertexMap.MultiFind(VertIndex, VertOverlaps);
+	const int32 NumVertices = Vertices.Num();
+	const int32 NumTris = Indices.Num() / 3;
+	check(Adjacency.NumVertices() == NumVertices);
+	check(UVs.Num() >= NumVertices && Normals.Num() >= NumVertices);
+	check(OutTangentX.Num() >= NumVertices && OutTangentY.Num() >= NumVertices);
 
-			// Remember which triangles map to this vert
-			VertToTriMap.AddUnique(VertIndex, TriIdx);
-			VertToTriSmoothMap.AddUnique(VertIndex, TriIdx);
+	TArray<Private::FMikkTSpaceFace> Faces;
+	Faces.SetNumUninitialized(NumTris);
 
-			// Also update map of triangles that 'overlap' this vert (ie don't match UV, but do match smoothing) and should be considered when calculating normal
-			for (int32 OverlapIdx = 0; OverlapIdx < VertOverlaps.Num(); OverlapIdx++)
-			{
-				// For each vert we overlap..
-				int32 OverlapVertIdx = VertOverlaps[OverlapIdx];
+	Private::ParallelForBatched(NumTris, [&](int32 TriIdx)
+	{
+		Faces[TriIdx] = Private::ComputeMikkTSpaceFace(Indices, Vertices, UVs, TriIdx);
+	});
+
+	Private::ParallelForBatched(NumVertices, [&](int32 VertIdx)
+	{
+		const FVector3f& Normal = Normals[VertIdx];
 
-				// Add this triangle to that vert
-				VertToTriSmoothMap.AddUnique(OverlapVertIdx, TriIdx);
+		// Accumulated separately for faces with preserved and mirrored UV orientation
+		FVector3f Tangent[2] = { FVector3f::ZeroVector, FVector3f::ZeroVector };
+		float Weight[2] = { 0.0f, 0.0f };
+
+		auto AccumulateVertex = [&](int32 SourceVertIdx)
+		{
+			for (const int32 TriIdx : Adjacency.GetVertexTriangles(SourceVertIdx))
+			{
+				const Private::FMikkTSpaceFace& Face = Faces[TriIdx];
+				if (!Face.bValid)
+				{
+					continue;
+				}
 
-				// And add all of its triangles to us
-				TArray<uint32> OverlapTris;
-				VertToTriMap.MultiFind(OverlapVertIdx, OverlapTris);
-				for (int32 OverlapTriIdx = 0; OverlapTriIdx < OverlapTris.Num(); OverlapTriIdx++)
+				int32 Corner = 0;
+				while (Corner < 2 && Indices[TriIdx * 3 + Corner] != uint32(SourceVertIdx))
 				{
-					VertToTriSmoothMap.AddUnique(VertIndex, OverlapTris[OverlapTriIdx]);
+					Corner++;
 				}
+
+				const FVector3f& Position = Vertices[SourceVertIdx];
+				const FVector3f EdgeA = Private::ProjectOntoPlane(Vertices[Indices[TriIdx * 3 + (Corner + 1) % 3]] - Position, Normal);
+				const FVector3f EdgeB = Private::ProjectOntoPlane(Vertices[Indices[TriIdx * 3 + (Corner + 2) % 3]] - Position, Normal);
+				const float CornerAngle = FMath::Acos(FMath::Clamp(EdgeA | EdgeB, -1.0f, 1.0f));
+
+				const int32 Group = Face.bOrientationPreserving ? 0 : 1;
+				Tangent[Group] += Private::ProjectOntoPlane(Face.Tangent, Normal) * CornerAngle;
+				Weight[Group] += CornerAngle;
+			}
+		};
+
+		AccumulateVertex(VertIdx);
+
+		// MikkTSpace welds vertices that match in position, normal and UV before generating
+		for (const int32 OverlapVertIdx : Adjacency.GetDuplicates(VertIdx))
+		{
+			if (UVs[OverlapVertIdx].Equals(UVs[VertIdx]) && Normals[OverlapVertIdx].Equals(Normal))
+			{
+				AccumulateVertex(OverlapVertIdx);
 			}
 		}
 
-		// Calculate triangle edge vectors and normal
-		const FVector3f Edge21 = P[1] - P[2];
-		const FVector3f Edge20 = P[0] - P[2];
-		const FVector3f TriNormal = (Edge21 ^ Edge20).GetSafeNormal();
-
-		// If we have UVs, use those to calculate
-		if (TexCoords.IsSet())
-		{
-			const FVector2f T1 = TexCoords->GetValue(CornerIndex[0]);
-			const FVector2f T2 = TexCoords->GetValue(CornerIndex[1]);
-			const FVector2f T3 = TexCoords->GetValue(CornerIndex[2]);
-
-			// 			float X1 = P[1].X - P[0].X;
-			// 			float X2 = P[2].X - P[0].X;
-			// 			float Y1 = P[1].Y - P[0].Y;
-			// 			float Y2 = P[2].Y - P[0].Y;
-			// 			float Z1 = P[1].Z - P[0].Z;
-			// 			float Z2 = P[2].Z - P[0].Z;
-			// 
-			// 			float S1 = U1.X - U0.X;
-			// 			float S2 = U2.X - U0.X;
-			// 			float T1 = U1.Y - U0.Y;
-			// 			float T2 = U2.Y - U0.Y;
-			// 
-			// 			float R = 1.0f / (S1 * T2 - S2 * T1);
-			// 			FaceTangentX[TriIdx] = FVector((T2 * X1 - T1 * X2) * R, (T2 * Y1 - T1 * Y2) * R,
-			// 				(T2 * Z1 - T1 * Z2) * R);
-			// 			FaceTangentY[TriIdx] = FVector((S1 * X2 - S2 * X1) * R, (S1 * Y2 - S2 * Y1) * R,
-			// 				(S1 * Z2 - S2 * Z1) * R);
-
-
-			FMatrix44f ParameterToLocal(
-				FPlane4f(P[1].X - P[0].X, P[1].Y - P[0].Y, P[1].Z - P[0].Z, 0),
-				FPlane4f(P[2].X - P[0].X, P[2].Y - P[0].Y, P[2].Z - P[0].Z, 0),
-				FPlane4f(P[0].X, P[0].Y, P[0].Z, 0),
-				FPlane4f(0, 0, 0, 1)
-			);
-
-			FMatrix44f ParameterToTexture(
-				FPlane4f(T2.X - T1.X, T2.Y - T1.Y, 0, 0),
-				FPlane4f(T3.X - T1.X, T3.Y - T1.Y, 0, 0),
-				FPlane4f(T1.X, T1.Y, 1, 0),
-				FPlane4f(0, 0, 0, 1)
-			);
-
-			// Use InverseSlow to catch singular matrices.  Inverse can miss this sometimes.
-			const FMatrix44f TextureToLocal = ParameterToTexture.Inverse() * ParameterToLocal;
-
-			FaceTangentX[TriIdx] = TextureToLocal.TransformVector(FVector3f(1, 0, 0)).GetSafeNormal();
-			FaceTangentY[TriIdx] = TextureToLocal.TransformVector(FVector3f(0, 1, 0)).GetSafeNormal();
+		const int32 Group = Weight[1] > Weight[0] ? 1 : 0;
+		FVector3f TangentX = Private::ProjectOntoPlane(Tangent[Group], Normal);
+		if (TangentX.IsZero())
+		{
+			// Only degenerate faces around this vertex, any tangent perpendicular to the normal will do
+			FVector3f Unused;
+			Normal.FindBestAxisVectors(TangentX, Unused);
+		}
+
+		OutTangentX[VertIdx] = TangentX;
+		OutTangentY[VertIdx] = (Normal ^ TangentX) * (Group == 0 ? 1.0f : -1.0f);
+	});
+}
+
+void RealtimeMeshAlgo::GenerateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bComputeSmoothNormals, ETangentGenerationMode Mode)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::GenerateTangents);
+
+	if (!StreamSet.Contains(FRealtimeMeshStreams::Triangles) || !StreamSet.Contains(FRealtimeMeshStreams::Position))
+	{
+		return;
+	}
+
+	const FRealtimeMeshStream& PositionStream = StreamSet.FindChecked(FRealtimeMeshStreams::Position);
+	const int32 NumVertices = PositionStream.Num();
+
+	// Read the source streams into flat arrays up front, reading through the builders isn't safe to do in parallel
+	TArray<FVector3f> PositionsData;
+	const TConstArrayView<const FVector3f> Positions = Private::GetPositions(PositionStream, PositionsData);
+
+	TArray<uint32> Indices;
+	Private::GetClampedIndices(StreamSet.FindChecked(FRealtimeMeshStreams::Triangles), NumVertices, Indices);
+
+	TArray<FVector2f> UVs;
+	if (StreamSet.Contains(FRealtimeMeshStreams::TexCoords))
+	{
+		TRealtimeMeshStridedStreamBuilder<FVector2f, void> TexCoords(StreamSet.FindChecked(FRealtimeMeshStreams::TexCoords));
+		UVs.SetNumUninitialized(NumVertices);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			UVs[VertIdx] = TexCoords.GetValue(VertIdx);
+		}
+	}
+
+	FRealtimeMeshVertexAdjacency Adjacency;
+	Adjacency.Build(Indices, Positions, bComputeSmoothNormals);
+
+	TArray<FVector3f> TangentX, TangentY, TangentZ;
+	TangentX.SetNumUninitialized(NumVertices);
+	TangentY.SetNumUninitialized(NumVertices);
+	TangentZ.SetNumUninitialized(NumVertices);
+
+	GenerateTangentsFromAdjacency(Indices, Positions, UVs, Adjacency, TangentX, TangentY, TangentZ);
+
+	// MikkTSpace rebuilds the tangent frame around the normals generated above
+	if (Mode == ETangentGenerationMode::MikkTSpace && UVs.Num() > 0)
+	{
+		GenerateMikkTSpaceTangentsFromAdjacency(Indices, Positions, UVs, TangentZ, Adjacency, TangentX, TangentY);
+	}
+
+	StreamSet.Remove(FRealtimeMeshStreams::Tangents);
+	FRealtimeMeshStream& TangentsStream = StreamSet.AddStream<FRealtimeMeshTangentsNormalPrecision>(FRealtimeMeshStreams::Tangents);
+	TangentsStream.SetNumUninitialized(NumVertices);
+
+	const TArrayView<FRealtimeMeshTangentsNormalPrecision> Tangents = TangentsStream.GetArrayView<FRealtimeMeshTangentsNormalPrecision>();
+	Private::ParallelForBatched(NumVertices, [&](int32 VertIdx)
+	{
+		Tangents[VertIdx] = FRealtimeMeshTangentsNormalPrecision(TangentZ[VertIdx], TangentY[VertIdx], TangentX[VertIdx]);
+	});
+}
+
+FInt32Range RealtimeMeshAlgo::UpdateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, const FRealtimeMeshVertexAdjacency& Adjacency,
+                                             TConstArrayView<const int32> DirtyVertices, ETangentGenerationMode Mode)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::UpdateTangents);
+
+	if (!StreamSet.Contains(FRealtimeMeshStreams::Triangles) || !StreamSet.Contains(FRealtimeMeshStreams::Position))
+	{
+		return FInt32Range::Empty();
+	}
+
+	const FRealtimeMeshStream& PositionStream = StreamSet.FindChecked(FRealtimeMeshStreams::Position);
+	const int32 NumVertices = PositionStream.Num();
+
+	const FRealtimeMeshStream* ExistingTangents = StreamSet.Find(FRealtimeMeshStreams::Tangents);
+	if (!ExistingTangents || ExistingTangents->Num() != NumVertices || Adjacency.NumVertices() != NumVertices)
+	{
+		GenerateTangents(StreamSet, Adjacency.HasDuplicates(), Mode);
+		if (NumVertices == 0)
+		{
+			return FInt32Range::Empty();
+		}
+
+		StreamSet.FindChecked(FRealtimeMeshStreams::Tangents).MarkRangeDirty(0, NumVertices);
+		return FInt32Range(0, NumVertices);
+	}
+
+	auto AddVertexTriangles = [&Adjacency](int32 VertIdx, TSet<int32>& OutTriangles)
+	{
+		for (const int32 TriIdx : Adjacency.GetVertexTriangles(VertIdx))
+		{
+			OutTriangles.Add(TriIdx);
+		}
+		for (const int32 OverlapVertIdx : Adjacency.GetDuplicates(VertIdx))
+		{
+			for (const int32 TriIdx : Adjacency.GetVertexTriangles(OverlapVertIdx))
+			{
+				OutTriangles.Add(TriIdx);
+			}
+		}
+	};
+
+	// Triangles whose shape changed
+	TSet<int32> DirtyTriangles;
+	for (const int32 VertIdx : DirtyVertices)
+	{
+		if (VertIdx >= 0 && VertIdx < NumVertices)
+		{
+			AddVertexTriangles(VertIdx, DirtyTriangles);
 		}
-		else
+	}
+
+	if (DirtyTriangles.Num() == 0)
+	{
+		return FInt32Range::Empty();
+	}
+
+	const TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> Triangles(StreamSet.FindChecked(FRealtimeMeshStreams::Triangles));
+	auto GetCorner = [&Triangles, NumVertices](int32 TriIdx, int32 CornerIdx)
+	{
+		return static_cast<int32>(FMath::Min(Triangles.GetElementValue(TriIdx, CornerIdx), uint32(NumVertices - 1)));
+	};
+
+	// Every vertex of those triangles needs updating, along with the vertices its normal is smoothed with
+	TSet<int32> UpdatedVertices;
+	for (const int32 TriIdx : DirtyTriangles)
+	{
+		for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
 		{
-			FaceTangentX[TriIdx] = Edge20.GetSafeNormal();
-			FaceTangentY[TriIdx] = (FaceTangentX[TriIdx] ^ TriNormal).GetSafeNormal();
+			const int32 VertIdx = GetCorner(TriIdx, CornerIdx);
+			UpdatedVertices.Add(VertIdx);
+			for (const int32 OverlapVertIdx : Adjacency.GetDuplicates(VertIdx))
+			{
+				UpdatedVertices.Add(OverlapVertIdx);
+			}
 		}
+	}
 
-		FaceTangentZ[TriIdx] = TriNormal;
+	// Which in turn depend on every triangle around them
+	TSet<int32> SourceTriangles;
+	for (const int32 VertIdx : UpdatedVertices)
+	{
+		AddVertexTriangles(VertIdx, SourceTriangles);
 	}
 
+	// Gather the source triangles into a compact mesh and generate that the same way as the full mesh
+	TMap<int32, int32> LocalVertexMap;
+	TArray<int32> LocalToGlobal;
+	TArray<uint32> LocalIndices;
+	LocalIndices.Reserve(SourceTriangles.Num() * 3);
+	for (const int32 TriIdx : SourceTriangles)
+	{
+		for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
+		{
+			const int32 VertIdx = GetCorner(TriIdx, CornerIdx);
+			int32& LocalVertIdx = LocalVertexMap.FindOrAdd(VertIdx, INDEX_NONE);
+			if (LocalVertIdx == INDEX_NONE)
+			{
+				LocalVertIdx = LocalToGlobal.Add(VertIdx);
+			}
+			LocalIndices.Add(LocalVertIdx);
+		}
+	}
 
-	// Arrays to accumulate tangents into
-	TArray<FVector3f> VertexTangentXSum, VertexTangentYSum, VertexTangentZSum;
-	VertexTangentXSum.AddZeroed(NumVertices);
-	VertexTangentYSum.AddZeroed(NumVertices);
-	VertexTangentZSum.AddZeroed(NumVertices);
+	const int32 NumLocalVertices = LocalToGlobal.Num();
 
-	// For each vertex..
-	for (uint32 VertxIdx = 0; VertxIdx < NumVertices; VertxIdx++)
+	TArray<FVector3f> Positions;
 	{
-		// Find relevant triangles for normal
-		TArray<uint32> SmoothTris;
-		VertToTriSmoothMap.MultiFind(VertxIdx, SmoothTris);
+		const TRealtimeMeshStreamBuilder<const FVector3f, void> PositionsBuilder(PositionStream);
+		Positions.SetNumUninitialized(NumLocalVertices);
+		for (int32 LocalVertIdx = 0; LocalVertIdx < NumLocalVertices; LocalVertIdx++)
+		{
+			Positions[LocalVertIdx] = PositionsBuilder.GetValue(LocalToGlobal[LocalVertIdx]);
+		}
+	}
 
-		for (int i = 0; i < SmoothTris.Num(); i++)
+	TArray<FVector2f> UVs;
+	if (const FRealtimeMeshStream* TexCoordsStream = StreamSet.Find(FRealtimeMeshStreams::TexCoords))
+	{
+		const TRealtimeMeshStridedStreamBuilder<const FVector2f, void> TexCoords(*TexCoordsStream);
+		UVs.SetNumUninitialized(NumLocalVertices);
+		for (int32 LocalVertIdx = 0; LocalVertIdx < NumLocalVertices; LocalVertIdx++)
 		{
-			uint32 TriIdx = SmoothTris[i];
-			VertexTangentZSum[VertxIdx] += FaceTangentZ[TriIdx];
+			UVs[LocalVertIdx] = TexCoords.GetValue(LocalToGlobal[LocalVertIdx]);
 		}
+	}
 
-		// Find relevant triangles for tangents
-		TArray<uint32> TangentTris;
-		VertToTriMap.MultiFind(VertxIdx, TangentTris);
+	FRealtimeMeshVertexAdjacency LocalAdjacency;
+	LocalAdjacency.Build(LocalIndices, Positions, Adjacency.HasDuplicates());
 
-		for (int i = 0; i < TangentTris.Num(); i++)
+	TArray<FVector3f> TangentX, TangentY, TangentZ;
+	TangentX.SetNumUninitialized(NumLocalVertices);
+	TangentY.SetNumUninitialized(NumLocalVertices);
+	TangentZ.SetNumUninitialized(NumLocalVertices);
+
+	GenerateTangentsFromAdjacency(LocalIndices, Positions, UVs, LocalAdjacency, TangentX, TangentY, TangentZ);
+
+	if (Mode == ETangentGenerationMode::MikkTSpace && UVs.Num() > 0)
+	{
+		GenerateMikkTSpaceTangentsFromAdjacency(LocalIndices, Positions, UVs, TangentZ, LocalAdjacency, TangentX, TangentY);
+	}
+
+	// Only the updated vertices have all their triangles in the compact mesh, the rest of it is left alone
+	FRealtimeMeshStream& TangentsStream = StreamSet.FindChecked(FRealtimeMeshStreams::Tangents);
+	TRealtimeMeshStreamBuilder<TRealtimeMeshTangents<FVector4f>, void> Tangents(TangentsStream);
+
+	int32 MinVertex = NumVertices;
+	int32 MaxVertex = INDEX_NONE;
+	for (const int32 VertIdx : UpdatedVertices)
+	{
+		if (const int32* LocalVertIdx = LocalVertexMap.Find(VertIdx))
 		{
-			uint32 TriIdx = TangentTris[i];
-			VertexTangentXSum[VertxIdx] += FaceTangentX[TriIdx];
-			VertexTangentYSum[VertxIdx] += FaceTangentY[TriIdx];
+			Tangents.Set(VertIdx, TRealtimeMeshTangents<FVector4f>(TangentZ[*LocalVertIdx], TangentY[*LocalVertIdx], TangentX[*LocalVertIdx]));
+			MinVertex = FMath::Min(MinVertex, VertIdx);
+			MaxVertex = FMath::Max(MaxVertex, VertIdx);
 		}
 	}
 
-	// Finally, normalize tangents and build output arrays	
-	for (uint32 VertxIdx = 0; VertxIdx < NumVertices; VertxIdx++)
+	if (MaxVertex < MinVertex)
 	{
-		FVector3f& TangentX = VertexTangentXSum[VertxIdx];
-		FVector3f& TangentY = VertexTangentYSum[VertxIdx];
-		FVector3f& TangentZ = VertexTangentZSum[VertxIdx];
+		return FInt32Range::Empty();
+	}
 
-		TangentX.Normalize();
-		//TangentY.Normalize();
-		TangentZ.Normalize();
+	TangentsStream.MarkRangeDirty(MinVertex, MaxVertex - MinVertex + 1);
+	return FInt32Range(MinVertex, MaxVertex + 1);
+}
+
+FInt32Range RealtimeMeshAlgo::UpdateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, const FRealtimeMeshVertexAdjacency& Adjacency,
+                                             const FRealtimeMeshStreamRange& DirtyRange, ETangentGenerationMode Mode)
+{
+	const int32 NumDirtyVertices = DirtyRange.NumVertices();
+	if (NumDirtyVertices <= 0)
+	{
+		return FInt32Range::Empty();
+	}
+
+	TArray<int32> DirtyVertices;
+	DirtyVertices.SetNumUninitialized(NumDirtyVertices);
+	for (int32 Index = 0; Index < NumDirtyVertices; Index++)
+	{
+		DirtyVertices[Index] = DirtyRange.GetMinVertex() + Index;
+	}
+
+	return UpdateTangents(StreamSet, Adjacency, DirtyVertices, Mode);
+}
+
+int32 RealtimeMeshAlgo::WeldVertices(TConstArrayView<const FVector3f> Vertices, float Tolerance, TArray<int32>& OutVertexMap, TArray<int32>& OutWeldedVertices)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeMeshAlgo::WeldVertices);
+
+	const int32 NumVerts = Vertices.Num();
+	OutVertexMap.SetNumUninitialized(NumVerts);
+	OutWeldedVertices.Reset();
+
+	// Cells are as large as the tolerance so anything within it is in the same or a neighbouring cell
+	const double CellSize = FMath::Max<double>(Tolerance, KINDA_SMALL_NUMBER);
+	const float ToleranceSquared = FMath::Square(FMath::Max(Tolerance, 0.0f));
+
+	TArray<FInt64Vector> Cells;
+	Cells.SetNumUninitialized(NumVerts);
+	Private::ParallelForBatched(NumVerts, [&](int32 VertIdx)
+	{
+		const FVector3f& Position = Vertices[VertIdx];
+		Cells[VertIdx] = FInt64Vector(
+			static_cast<int64>(FMath::FloorToDouble(Position.X / CellSize)),
+			static_cast<int64>(FMath::FloorToDouble(Position.Y / CellSize)),
+			static_cast<int64>(FMath::FloorToDouble(Position.Z / CellSize)));
+	});
+
+	// Inserted in reverse so each cell lists its vertices in ascending order
+	TMap<FInt64Vector, int32> CellHeads;
+	CellHeads.Reserve(NumVerts);
+	TArray<int32> NextInCell;
+	NextInCell.SetNumUninitialized(NumVerts);
+	for (int32 VertIdx = NumVerts - 1; VertIdx >= 0; VertIdx--)
+	{
+		int32& Head = CellHeads.FindOrAdd(Cells[VertIdx], INDEX_NONE);
+		NextInCell[VertIdx] = Head;
+		Head = VertIdx;
+	}
+
+	// Point each vertex at the lowest index vertex within the tolerance, which is never above the vertex itself
+	Private::ParallelForBatched(NumVerts, [&](int32 VertIdx)
+	{
+		const FVector3f& Position = Vertices[VertIdx];
+		int32 Target = VertIdx;
+
+		for (int64 X = -1; X <= 1; X++)
+		{
+			for (int64 Y = -1; Y <= 1; Y++)
+			{
+				for (int64 Z = -1; Z <= 1; Z++)
+				{
+					if (const int32* Head = CellHeads.Find(Cells[VertIdx] + FInt64Vector(X, Y, Z)))
+					{
+						for (int32 OtherIdx = *Head; OtherIdx != INDEX_NONE && OtherIdx < Target; OtherIdx = NextInCell[OtherIdx])
+						{
+							if (FVector3f::DistSquared(Position, Vertices[OtherIdx]) <= ToleranceSquared)
+							{
+								Target = OtherIdx;
+								break;
+							}
+						}
+					}
+				}
+			}
+		}
 
-		// Use Gram-Schmidt orthogonalization to make sure X is orthonormal with Z
-		TangentX -= TangentZ * (TangentZ | TangentX);
-		TangentX.Normalize();
-		TangentY.Normalize();
+		OutVertexMap[VertIdx] = Target;
+	});
 
-		Tangents.Set(VertxIdx, FRealtimeMeshTangentsNormalPrecision(TangentZ, TangentY, TangentX));
+	// Targets are always lower so walking up in order resolves every chain to the vertex at its root
+	for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+	{
+		const int32 Target = OutVertexMap[VertIdx];
+		OutVertexMap[VertIdx] = Target == VertIdx ? OutWeldedVertices.Add(VertIdx) : OutVertexMap[Target];
 	}
+
+	return OutWeldedVertices.Num();
 }
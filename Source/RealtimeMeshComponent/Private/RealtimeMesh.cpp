@@ -14,6 +14,7 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "Logging/MessageLog.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "RealtimeMesh"
 
@@ -25,6 +26,12 @@ DECLARE_CYCLE_STAT(TEXT("RealtimeMeshDelayedActions - Has Physics TriMesh"), STA
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshDelayedActions - Update Collision"), STAT_RealtimeMesh_UpdateCollision, STATGROUP_RealtimeMesh);
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshDelayedActions - Finish Collision Async Cook"), STAT_RealtimeMesh_FinishCollisionAsyncCook, STATGROUP_RealtimeMesh);
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshDelayedActions - Finalize Collision Cooked Data"), STAT_RealtimeMesh_FinalizeCollisionCookedData, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMesh - Apply Collision Update"), STAT_RealtimeMesh_ApplyCollisionUpdate, STATGROUP_RealtimeMesh);
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCollisionUpdateInPlace(
+	TEXT("RealtimeMesh.Collision.UpdateInPlace"),
+	1,
+	TEXT("Reuse the body setup when only the collision shapes changed, so components can swap the geometry of their existing bodies instead of recreating their physics state. 0 = new body setup on every update, 1 = reuse"));
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -288,6 +295,16 @@ UMaterialInterface* URealtimeMesh::GetMaterial(int32 SlotIndex) const
 	return nullptr;
 }
 
+float URealtimeMesh::GetUploadPriority() const
+{
+	return SharedResources->GetUploadPriority();
+}
+
+void URealtimeMesh::SetUploadPriority(float NewPriority)
+{
+	SharedResources->SetUploadPriority(NewPriority);
+}
+
 UWorld* URealtimeMesh::GetWorld() const
 {
 	return Super::GetWorld();
@@ -481,15 +498,43 @@ void URealtimeMesh::PostDuplicate(bool bDuplicateForPIE)
 
 ERealtimeMeshCollisionUpdateResult URealtimeMesh::ApplyCollisionUpdate(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey)
 {
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMesh_ApplyCollisionUpdate);
+	
 	if (NewCollisionKey > CurrentCollisionVersion)
 	{
-		UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public : RF_NoFlags));
-		NewBodySetup->BodySetupGuid = FGuid::NewGuid();
-		NewBodySetup->bGenerateMirroredCollision = false;
-		NewBodySetup->bDoubleSidedGeometry = true;
+		const ECollisionTraceFlag NewTraceFlag = InCollisionData.Configuration.bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
+
+		// When the body configuration is unchanged the existing body setup only gets its geometry replaced, which
+		// lets components swap the shapes of their bodies in place instead of recreating their physics state.
+		// Every component bound to this mesh gets the update event below and either swaps its own body's shapes
+		// or recreates its physics state, so no body keeps using the old geometry.
+		UBodySetup* NewBodySetup = BodySetup;
+		if (IsValid(NewBodySetup) && NewBodySetup->CollisionTraceFlag == NewTraceFlag && CVarRealtimeMeshCollisionUpdateInPlace.GetValueOnGameThread() != 0)
+		{
+			NewBodySetup->AggGeom.EmptyElements();
+#if RMC_ENGINE_ABOVE_5_4
+			NewBodySetup->TriMeshGeometries.Reset();
+#else
+			NewBodySetup->ChaosTriMeshes.Reset();
+#endif
+
+			// Same bookkeeping as UBodySetup::InvalidatePhysicsData, anything keyed on the guid must not match the old geometry
+			NewBodySetup->BodySetupGuid = FGuid::NewGuid();
+			if (!NewBodySetup->bSharedCookedData)
+			{
+				NewBodySetup->CookedFormatData.FlushData();
+			}
+		}
+		else
+		{
+			NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public : RF_NoFlags));
+			NewBodySetup->BodySetupGuid = FGuid::NewGuid();
+			NewBodySetup->bGenerateMirroredCollision = false;
+			NewBodySetup->bDoubleSidedGeometry = true;
+			NewBodySetup->bSupportUVsAndFaceRemap = true;
+			NewBodySetup->CollisionTraceFlag = NewTraceFlag;
+		}
 		NewBodySetup->bCreatedPhysicsMeshes = true;
-		NewBodySetup->bSupportUVsAndFaceRemap = true;
-		NewBodySetup->CollisionTraceFlag = InCollisionData.Configuration.bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
 
 		if (NewBodySetup->CollisionTraceFlag != CTF_UseComplexAsSimple)
 		{
@@ -7,6 +7,25 @@
 #include "Core/RealtimeMeshBuilder.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/PhysicsSettings.h"
+#include "Data/RealtimeMeshCollisionDiskCache.h"
+#include "Mesh/RealtimeMeshAlgo.h"
+#include "RealtimeMeshThreadingSubsystem.h"
+#include "Engine/Engine.h"
+#include "CompGeom/ConvexHull3.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
+
+#include <atomic>
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshCollision - Cook Complex Mesh"), STAT_RealtimeMeshCollision_CookComplexMesh, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Cooked Triangles"), STAT_RealtimeMeshCollision_CookedTriangles, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Welded Vertices"), STAT_RealtimeMeshCollision_WeldedVertices, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshCollision - Dropped Triangles"), STAT_RealtimeMeshCollision_DroppedTriangles, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshCollision - Convex Decomposition"), STAT_RealtimeMeshCollision_ConvexDecomposition, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshCollision - Fit Simple Collision"), STAT_RealtimeMeshCollision_FitSimpleCollision, STATGROUP_RealtimeMesh);
 
 
 bool URealtimeMeshCollisionTools::FindCollisionUVRealtimeMesh(const FHitResult& Hit, int32 UVChannel, FVector2D& UV)
@@ -81,121 +100,197 @@ void URealtimeMeshCollisionTools::CookConvexHull(FRealtimeMeshCollisionConvex& C
 	ConvexHull.Cooked = MakeShared<FRealtimeMeshCookedConvexMeshData>(NonMirrored);
 }
 
-void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh)
+static std::atomic<uint64> GRealtimeMeshComplexMeshCooks(0);
+
+uint64 URealtimeMeshCollisionTools::GetNumComplexMeshCooks()
+{
+	return GRealtimeMeshComplexMeshCooks.load(std::memory_order_relaxed);
+}
+
+uint64 URealtimeMeshCollisionTools::GetComplexMeshCookHash(const FRealtimeMeshCollisionMesh& CollisionMesh)
 {
-	constexpr bool EnableMeshClean = false;
+	// Bump when the cook itself changes in a way that changes its output
+	constexpr uint32 CookVersion = 1;
 	
-	if(CollisionMesh.Vertices.Num() == 0)
+	FXxHash64Builder Hasher;
+	Hasher.Update(&CookVersion, sizeof(CookVersion));
+	
+	const bool bFlipNormals = CollisionMesh.bFlipNormals;
+	const bool bSupportUVFromHitResults = UPhysicsSettings::Get()->bSupportUVFromHitResults;
+	const bool bTriMeshPerPolySupport = Chaos::TriMeshPerPolySupport;
+	Hasher.Update(&bFlipNormals, sizeof(bFlipNormals));
+	Hasher.Update(&bSupportUVFromHitResults, sizeof(bSupportUVFromHitResults));
+	Hasher.Update(&bTriMeshPerPolySupport, sizeof(bTriMeshPerPolySupport));
+	
+	const bool bCleanMesh = CollisionMesh.bCleanMesh;
+	Hasher.Update(&bCleanMesh, sizeof(bCleanMesh));
+	if (bCleanMesh)
 	{
-		CollisionMesh.Cooked = MakeShared<FRealtimeMeshCookedTriMeshData>();
+		Hasher.Update(&CollisionMesh.WeldTolerance, sizeof(CollisionMesh.WeldTolerance));
 	}
 
-	TArray<FVector3f> FinalVerts = CollisionMesh.Vertices;
+	auto HashArray = [&Hasher](const auto& Array)
+	{
+		const int32 Num = Array.Num();
+		Hasher.Update(&Num, sizeof(Num));
+		Hasher.Update(Array.GetData(), Array.Num() * Array.GetTypeSize());
+	};
+	
+	HashArray(CollisionMesh.Vertices);
+	HashArray(CollisionMesh.Triangles);
+	HashArray(CollisionMesh.Materials);
+	if (bSupportUVFromHitResults)
+	{
+		const int32 NumChannels = CollisionMesh.TexCoords.Num();
+		Hasher.Update(&NumChannels, sizeof(NumChannels));
+		for (const TArray<FVector2f>& Channel : CollisionMesh.TexCoords)
+		{
+			HashArray(Channel);
+		}
+	}
+	
+	return Hasher.Finalize().Hash;
+}
 
-	// Push indices into one flat array
-	TArray<int32> FinalIndices;
-	FinalIndices.Reserve(CollisionMesh.Triangles.Num() * 3);
-	for(const RealtimeMesh::TIndex3<int32>& Tri : CollisionMesh.Triangles)
+uint64 URealtimeMeshCollisionTools::GetComplexMeshCookHash(const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 MaterialIndex, bool bPolyGroupsAsMaterials,
+	bool bCleanMesh, float WeldTolerance)
+{
+	using namespace RealtimeMesh;
+	
+	// Kept apart from the collision mesh hashes, the two never describe the same input
+	constexpr uint32 CookVersion = 1;
+	constexpr uint32 StreamSourceMarker = 0x5354524D;
+	
+	FXxHash64Builder Hasher;
+	Hasher.Update(&CookVersion, sizeof(CookVersion));
+	Hasher.Update(&StreamSourceMarker, sizeof(StreamSourceMarker));
+	
+	const bool bSupportUVFromHitResults = UPhysicsSettings::Get()->bSupportUVFromHitResults;
+	const bool bTriMeshPerPolySupport = Chaos::TriMeshPerPolySupport;
+	Hasher.Update(&bSupportUVFromHitResults, sizeof(bSupportUVFromHitResults));
+	Hasher.Update(&bTriMeshPerPolySupport, sizeof(bTriMeshPerPolySupport));
+	Hasher.Update(&MaterialIndex, sizeof(MaterialIndex));
+	Hasher.Update(&bPolyGroupsAsMaterials, sizeof(bPolyGroupsAsMaterials));
+	Hasher.Update(&bCleanMesh, sizeof(bCleanMesh));
+	if (bCleanMesh)
 	{
-		// NOTE: This is where the Winding order of the triangles are changed to be consistent throughout the rest of the physics engine
-		// After this point we should have clockwise (CW) winding in left handed (LH) coordinates (or equivalently CCW in RH)
-		// This is the opposite convention followed in most of the unreal engine
-		FinalIndices.Add(CollisionMesh.bFlipNormals ? Tri.V1 : Tri.V0);
-		FinalIndices.Add(CollisionMesh.bFlipNormals ? Tri.V0 : Tri.V1);
-		FinalIndices.Add(Tri.V2);
+		Hasher.Update(&WeldTolerance, sizeof(WeldTolerance));
 	}
 
-	/*if(EnableMeshClean)
+	auto HashStream = [&Hasher, &Streams](const FRealtimeMeshStreamKey& StreamKey)
 	{
-		Chaos::CleanTrimesh(FinalVerts, FinalIndices, &OutFaceRemap, &OutVertexRemap);
-	}*/
+		if (const FRealtimeMeshStream* Stream = Streams.Find(StreamKey))
+		{
+			const uint32 LayoutHash = GetTypeHash(Stream->GetLayout());
+			const int32 Num = Stream->Num();
+			Hasher.Update(&LayoutHash, sizeof(LayoutHash));
+			Hasher.Update(&Num, sizeof(Num));
+			Hasher.Update(Stream->GetData(), Stream->GetResourceDataSize());
+		}
+		else
+		{
+			const int32 Missing = INDEX_NONE;
+			Hasher.Update(&Missing, sizeof(Missing));
+		}
+	};
 
-	// Build particle list #BG Maybe allow TParticles to copy vectors?
-	Chaos::FTriangleMeshImplicitObject::ParticlesType TriMeshParticles;
-	TriMeshParticles.AddParticles(FinalVerts.Num());
+	HashStream(FRealtimeMeshStreams::Position);
+	HashStream(FRealtimeMeshStreams::Triangles);
+	if (bPolyGroupsAsMaterials)
+	{
+		HashStream(FRealtimeMeshStreams::PolyGroups);
+	}
+	if (bSupportUVFromHitResults)
+	{
+		HashStream(FRealtimeMeshStreams::TexCoords);
+	}
+	
+	return Hasher.Finalize().Hash;
+}
+
+namespace RealtimeMeshCollisionCooking
+{
+	using FTriMeshParticles = Chaos::FTriangleMeshImplicitObject::ParticlesType;
 
-	const int32 NumVerts = FinalVerts.Num();
-	for(int32 VertIndex = 0; VertIndex < NumVerts; ++VertIndex)
+	// Particle positions are stored contiguously as single precision vectors, so they can be written in bulk
+	static FVector3f* GetParticlePositions(FTriMeshParticles& Particles)
 	{
+		if (Particles.Size() == 0)
+		{
+			return nullptr;
+		}
 #if RMC_ENGINE_ABOVE_5_4
-		TriMeshParticles.SetX(VertIndex, FinalVerts[VertIndex]);
+		auto* Positions = Particles.XArray().GetData();
 #else
-		TriMeshParticles.X(VertIndex) = FinalVerts[VertIndex];
+		auto* Positions = &Particles.X(0);
 #endif
+		static_assert(sizeof(*Positions) == sizeof(FVector3f), "Trimesh particles are expected to be single precision");
+		return reinterpret_cast<FVector3f*>(Positions);
 	}
 
-	TArray<int32> OutVertexRemap;
-	TArray<int32> OutFaceRemap;
-
-	// Build chaos triangle list. #BGTODO Just make the clean function take these types instead of double copying
-	auto LambdaHelper = [&CollisionMesh, &FinalVerts, &FinalIndices, &TriMeshParticles, &OutFaceRemap, &OutVertexRemap](auto& Triangles)
+	/*
+	 * Builds the chaos trimesh from particles that already hold the vertex positions.
+	 * Triangles and materials are read through the accessors so the collision mesh and the stream paths
+	 * can both feed this without building an intermediate index array first.
+	 * When the particles were welded VertexMap takes the source indices to the particles, and OutVertexRemap
+	 * takes the particles back to the source vertices.
+	 */
+	template<typename ChaosIndexType, typename TriangleAccessorType, typename MaterialAccessorType>
+	static TSharedPtr<FRealtimeMeshCookedTriMeshData> BuildCookedTriMesh(FTriMeshParticles&& TriMeshParticles, const TArray<int32>& VertexMap, TArray<int32>&& OutVertexRemap,
+		int32 NumTriangles, bool bFlipNormals, bool bHasMaterials, const TriangleAccessorType& GetTriangle, const MaterialAccessorType& GetMaterial,
+		FRealtimeMeshCollisionMeshCookedUVData&& UVInfo)
 	{
-		const int32 NumTriangles = FinalIndices.Num() / 3;
-		bool bHasMaterials = CollisionMesh.Materials.Num() > 0;
+		const FVector3f* Positions = GetParticlePositions(TriMeshParticles);
+		const bool bWelded = VertexMap.Num() > 0;
+		const uint32 NumVertices = bWelded ? VertexMap.Num() : TriMeshParticles.Size();
+
+		TArray<Chaos::TVector<ChaosIndexType, 3>> Triangles;
 		TArray<uint16> MaterialIndices;
+		TArray<int32> OutFaceRemap;
 
-		if(bHasMaterials)
+		Triangles.Reserve(NumTriangles);
+		OutFaceRemap.Reserve(NumTriangles);
+		if (bHasMaterials)
 		{
 			MaterialIndices.Reserve(NumTriangles);
 		}
 
-		// Need to rebuild face remap array, in case there are any invalid triangles
-		TArray<int32> OldFaceRemap = MoveTemp(OutFaceRemap);
-		OutFaceRemap.Reserve(OldFaceRemap.Num());
-
-		Triangles.Reserve(NumTriangles);
-		for(int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
 		{
-			// Only add this triangle if it is valid
-			const int32 BaseIndex = TriangleIndex * 3;
-			const bool bIsValidTriangle = Chaos::FConvexBuilder::IsValidTriangle(
-				FinalVerts[FinalIndices[BaseIndex]],
-				FinalVerts[FinalIndices[BaseIndex + 1]],
-				FinalVerts[FinalIndices[BaseIndex + 2]]);
+			const RealtimeMesh::TIndex3<int32> Tri = GetTriangle(TriangleIndex);
+			
+			// NOTE: This is where the Winding order of the triangles are changed to be consistent throughout the rest of the physics engine
+			// After this point we should have clockwise (CW) winding in left handed (LH) coordinates (or equivalently CCW in RH)
+			// This is the opposite convention followed in most of the unreal engine
+			uint32 V0 = bFlipNormals ? Tri.V1 : Tri.V0;
+			uint32 V1 = bFlipNormals ? Tri.V0 : Tri.V1;
+			uint32 V2 = Tri.V2;
+			if (V0 >= NumVertices || V1 >= NumVertices || V2 >= NumVertices)
+			{
+				continue;
+			}
+			
+			if (bWelded)
+			{
+				V0 = VertexMap[V0];
+				V1 = VertexMap[V1];
+				V2 = VertexMap[V2];
+			}
+
+			// Only add this triangle if it is valid, welding can collapse slivers onto an edge or a point
+			const bool bIsValidTriangle = V0 != V1 && V1 != V2 && V2 != V0 &&
+				Chaos::FConvexBuilder::IsValidTriangle(Positions[V0], Positions[V1], Positions[V2]);
 
 			// TODO: Figure out a proper way to handle this. Could these edges get sewn together? Is this important?
 			//if (ensureMsgf(bIsValidTriangle, TEXT("FChaosDerivedDataCooker::BuildTriangleMeshes(): Trimesh attempted cooked with invalid triangle!")));
-			if(bIsValidTriangle)
+			if (bIsValidTriangle)
 			{
-				Triangles.Add(Chaos::TVector<int32, 3>(FinalIndices[BaseIndex], FinalIndices[BaseIndex + 1], FinalIndices[BaseIndex + 2]));
-				OutFaceRemap.Add(OldFaceRemap.IsEmpty()? TriangleIndex : OldFaceRemap[TriangleIndex]);
+				Triangles.Add(Chaos::TVector<ChaosIndexType, 3>(V0, V1, V2));
+				OutFaceRemap.Add(TriangleIndex);
 
-				if(bHasMaterials)
+				if (bHasMaterials)
 				{
-					/*if(EnableMeshClean)
-					{
-						if(!ensure(OldFaceRemap.IsValidIndex(TriangleIndex)))
-						{
-							MaterialIndices.Empty();
-							bHasMaterials = false;
-						}
-						else
-						{
-							const int32 OriginalIndex = OldFaceRemap[TriangleIndex];
-
-							if(ensure(Materials.IsValidIndex(OriginalIndex)))
-							{
-								MaterialIndices.Add(Materials[OriginalIndex]);
-							}
-							else
-							{
-								MaterialIndices.Empty();
-								bHasMaterials = false;
-							}
-						}
-					}
-					else*/
-					{
-						if(ensure(CollisionMesh.Materials.IsValidIndex(TriangleIndex)))
-						{
-							MaterialIndices.Add(CollisionMesh.Materials[TriangleIndex]);
-						}
-						else
-						{
-							MaterialIndices.Empty();
-							bHasMaterials = false;
-						}
-					}
+					MaterialIndices.Add(GetMaterial(TriangleIndex));
 				}
 			}
 		}
@@ -203,7 +298,6 @@ void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& Co
 		TUniquePtr<TArray<int32>> OutFaceRemapPtr = MakeUnique<TArray<int32>>(OutFaceRemap);
 		TUniquePtr<TArray<int32>> OutVertexRemapPtr = Chaos::TriMeshPerPolySupport ? MakeUnique<TArray<int32>>(OutVertexRemap) : nullptr;
 		
-		
 #if RMC_ENGINE_ABOVE_5_4
 		auto* RawMesh = new Chaos::FTriangleMeshImplicitObject(MoveTemp(TriMeshParticles), MoveTemp(Triangles), MoveTemp(MaterialIndices), MoveTemp(OutFaceRemapPtr), MoveTemp(OutVertexRemapPtr));
 		auto CookedMesh = Chaos::FTriangleMeshImplicitObjectPtr(RawMesh);
@@ -211,33 +305,265 @@ void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& Co
 		TSharedPtr<Chaos::FTriangleMeshImplicitObject> CookedMesh = MakeShared<Chaos::FTriangleMeshImplicitObject>(MoveTemp(TriMeshParticles), MoveTemp(Triangles), MoveTemp(MaterialIndices), MoveTemp(OutFaceRemapPtr), MoveTemp(OutVertexRemapPtr));
 #endif
 		
+		INC_DWORD_STAT_BY(STAT_RealtimeMeshCollision_DroppedTriangles, NumTriangles - OutFaceRemap.Num());
+		
 		// Propagate remapped indices from the FTriangleMeshImplicitObject back to the remap array
-		//const auto& TriangleMeshRef = *CookedMesh.GetReference();
 		for (int32 TriangleIndex = 0; TriangleIndex < OutFaceRemap.Num(); TriangleIndex++)
 		{
 			OutFaceRemap[TriangleIndex] = CookedMesh->GetExternalFaceIndexFromInternal(TriangleIndex);
 		}
 		
-		FRealtimeMeshCollisionMeshCookedUVData UVInfo;
-		if (UPhysicsSettings::Get()->bSupportUVFromHitResults)
+		return MakeShared<FRealtimeMeshCookedTriMeshData>(CookedMesh, MoveTemp(OutVertexRemap), MoveTemp(OutFaceRemap), MoveTemp(UVInfo));
+	}
+
+	template<typename TriangleAccessorType, typename MaterialAccessorType>
+	static TSharedPtr<FRealtimeMeshCookedTriMeshData> BuildCookedTriMesh(FTriMeshParticles&& TriMeshParticles, const TArray<int32>& VertexMap, TArray<int32>&& OutVertexRemap,
+		int32 NumTriangles, bool bFlipNormals, bool bHasMaterials, const TriangleAccessorType& GetTriangle, const MaterialAccessorType& GetMaterial,
+		FRealtimeMeshCollisionMeshCookedUVData&& UVInfo)
+	{
+		if (TriMeshParticles.Size() < TNumericLimits<uint16>::Max())
+		{
+			return BuildCookedTriMesh<uint16>(MoveTemp(TriMeshParticles), VertexMap, MoveTemp(OutVertexRemap), NumTriangles, bFlipNormals, bHasMaterials,
+				GetTriangle, GetMaterial, MoveTemp(UVInfo));
+		}
+		return BuildCookedTriMesh<int32>(MoveTemp(TriMeshParticles), VertexMap, MoveTemp(OutVertexRemap), NumTriangles, bFlipNormals, bHasMaterials,
+			GetTriangle, GetMaterial, MoveTemp(UVInfo));
+	}
+
+	/*
+	 * Builds the trimesh, welding the particles first when the mesh asks to be cleaned.
+	 * Face indices stay those of the source triangles through the face remap, so the UV info built from the
+	 * unwelded source keeps resolving hit results.
+	 */
+	template<typename TriangleAccessorType, typename MaterialAccessorType>
+	static TSharedPtr<FRealtimeMeshCookedTriMeshData> BuildCookedTriMesh(FTriMeshParticles&& TriMeshParticles, int32 NumTriangles, bool bFlipNormals,
+		bool bCleanMesh, float WeldTolerance, bool bHasMaterials, const TriangleAccessorType& GetTriangle, const MaterialAccessorType& GetMaterial,
+		FRealtimeMeshCollisionMeshCookedUVData&& UVInfo)
+	{
+		if (bCleanMesh)
 		{
-			UVInfo.FillFromTriMesh(CollisionMesh);
+			const int32 NumVertices = TriMeshParticles.Size();
+			const FVector3f* Positions = GetParticlePositions(TriMeshParticles);
+
+			TArray<int32> VertexMap;
+			TArray<int32> WeldedVertices;
+			if (RealtimeMeshAlgo::WeldVertices(MakeArrayView(Positions, NumVertices), WeldTolerance, VertexMap, WeldedVertices) < NumVertices)
+			{
+				INC_DWORD_STAT_BY(STAT_RealtimeMeshCollision_WeldedVertices, NumVertices - WeldedVertices.Num());
+				
+				FTriMeshParticles WeldedParticles;
+				WeldedParticles.AddParticles(WeldedVertices.Num());
+				FVector3f* WeldedPositions = GetParticlePositions(WeldedParticles);
+				for (int32 Index = 0; Index < WeldedVertices.Num(); Index++)
+				{
+					WeldedPositions[Index] = Positions[WeldedVertices[Index]];
+				}
+
+				return BuildCookedTriMesh(MoveTemp(WeldedParticles), VertexMap, MoveTemp(WeldedVertices), NumTriangles, bFlipNormals, bHasMaterials,
+					GetTriangle, GetMaterial, MoveTemp(UVInfo));
+			}
 		}
 		
-		CollisionMesh.Cooked = MakeShared<FRealtimeMeshCookedTriMeshData>(CookedMesh,
-			MoveTemp(OutVertexRemap), MoveTemp(OutFaceRemap), MoveTemp(UVInfo));
-	};
+		return BuildCookedTriMesh(MoveTemp(TriMeshParticles), TArray<int32>(), TArray<int32>(), NumTriangles, bFlipNormals, bHasMaterials,
+			GetTriangle, GetMaterial, MoveTemp(UVInfo));
+	}
+
+	// Reads the triangle indices straight out of the stream memory for the common index widths
+	template<typename IndexType>
+	static auto MakeStreamTriangleAccessor(const RealtimeMesh::FRealtimeMeshStream& TriangleStream)
+	{
+		const IndexType* Indices = TriangleStream.GetElementArrayView<IndexType>().GetData();
+		return [Indices](int32 TriangleIndex)
+		{
+			const IndexType* Tri = Indices + TriangleIndex * REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE;
+			return RealtimeMesh::TIndex3<int32>(static_cast<int32>(Tri[0]), static_cast<int32>(Tri[1]), static_cast<int32>(Tri[2]));
+		};
+	}
+
+	static void FillUVInfoFromStreams(FRealtimeMeshCollisionMeshCookedUVData& UVInfo, const RealtimeMesh::FRealtimeMeshStream& PositionStream,
+		const RealtimeMesh::FRealtimeMeshStream& TriangleStream, const RealtimeMesh::FRealtimeMeshStream* TexCoordsStream)
+	{
+		using namespace RealtimeMesh;
+		
+		PositionStream.CopyTo(UVInfo.Positions);
+		
+		TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> TrianglesData(TriangleStream);
+		UVInfo.Triangles.SetNumUninitialized(TrianglesData.Num());
+		for (int32 TriIdx = 0; TriIdx < TrianglesData.Num(); TriIdx++)
+		{
+			UVInfo.Triangles[TriIdx] = TIndex3<int32>(
+				TrianglesData[TriIdx].GetElement(0).GetValue(),
+				TrianglesData[TriIdx].GetElement(1).GetValue(),
+				TrianglesData[TriIdx].GetElement(2).GetValue());
+		}
+
+		if (TexCoordsStream && TexCoordsStream->Num() == PositionStream.Num())
+		{
+			UVInfo.TexCoords.SetNum(TexCoordsStream->GetNumElements());
+			for (int32 ChannelIndex = 0; ChannelIndex < TexCoordsStream->GetNumElements(); ChannelIndex++)
+			{
+				TRealtimeMeshStridedStreamBuilder<const FVector2f, void> UVData(*TexCoordsStream, ChannelIndex);
+				TArray<FVector2f>& Channel = UVInfo.TexCoords[ChannelIndex];
+				Channel.SetNumUninitialized(UVData.Num());
+				for (int32 TexCoordIdx = 0; TexCoordIdx < UVData.Num(); TexCoordIdx++)
+				{
+					Channel[TexCoordIdx] = UVData[TexCoordIdx];
+				}
+			}
+		}
+	}
+}
+
+void URealtimeMeshCollisionTools::CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh)
+{
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshCollision_CookComplexMesh);
+
+	RealtimeMesh::FRealtimeMeshCollisionDiskCache* DiskCache = CollisionMesh.Vertices.Num() > 0? RealtimeMesh::FRealtimeMeshCollisionDiskCache::Get() : nullptr;
+	const uint64 DiskCacheKey = DiskCache? GetComplexMeshCookHash(CollisionMesh) : 0;
+	if (DiskCache && DiskCache->TryLoad(DiskCacheKey, CollisionMesh.Cooked))
+	{
+		return;
+	}
+
+	GRealtimeMeshComplexMeshCooks.fetch_add(1, std::memory_order_relaxed);
+	INC_DWORD_STAT_BY(STAT_RealtimeMeshCollision_CookedTriangles, CollisionMesh.Triangles.Num());
+	
+	if(CollisionMesh.Vertices.Num() == 0)
+	{
+		CollisionMesh.Cooked = MakeShared<FRealtimeMeshCookedTriMeshData>();
+	}
+
+	// Copy the vertices straight into the particles
+	RealtimeMeshCollisionCooking::FTriMeshParticles TriMeshParticles;
+	TriMeshParticles.AddParticles(CollisionMesh.Vertices.Num());
+	if (CollisionMesh.Vertices.Num() > 0)
+	{
+		FMemory::Memcpy(RealtimeMeshCollisionCooking::GetParticlePositions(TriMeshParticles), CollisionMesh.Vertices.GetData(), CollisionMesh.Vertices.Num() * sizeof(FVector3f));
+	}
+
+	const bool bHasMaterials = CollisionMesh.Materials.Num() > 0 && ensure(CollisionMesh.Materials.Num() >= CollisionMesh.Triangles.Num());
+	
+	FRealtimeMeshCollisionMeshCookedUVData UVInfo;
+	if (UPhysicsSettings::Get()->bSupportUVFromHitResults)
+	{
+		UVInfo.FillFromTriMesh(CollisionMesh);
+	}
+
+	CollisionMesh.Cooked = RealtimeMeshCollisionCooking::BuildCookedTriMesh(MoveTemp(TriMeshParticles), CollisionMesh.Triangles.Num(), CollisionMesh.bFlipNormals,
+		CollisionMesh.bCleanMesh, CollisionMesh.WeldTolerance, bHasMaterials,
+		[&CollisionMesh](int32 TriangleIndex) { return CollisionMesh.Triangles[TriangleIndex]; },
+		[&CollisionMesh](int32 TriangleIndex) { return CollisionMesh.Materials[TriangleIndex]; },
+		MoveTemp(UVInfo));
+
+	if (DiskCache && CollisionMesh.Cooked.IsValid())
+	{
+		DiskCache->Store(DiskCacheKey, *CollisionMesh.Cooked);
+	}
+}
+
+bool URealtimeMeshCollisionTools::CookComplexMeshFromStreams(FRealtimeMeshCollisionMesh& CollisionMesh, const RealtimeMesh::FRealtimeMeshStreamSet& Streams,
+	int32 MaterialIndex, bool bPolyGroupsAsMaterials)
+{
+	using namespace RealtimeMesh;
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshCollision_CookComplexMesh);
+
+	const FRealtimeMeshStream* PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
+	const FRealtimeMeshStream* TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
+	const FRealtimeMeshStream* PolyGroupStream = bPolyGroupsAsMaterials ? Streams.Find(FRealtimeMeshStreams::PolyGroups) : nullptr;
+
+	if (!PositionStream || !TriangleStream)
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to cook collision from streams: missing position or triangle stream."));
+		return false;
+	}
+
+	const int32 NumTriangles = (TriangleStream->Num() * TriangleStream->GetNumElements()) / REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE;
+	if (PositionStream->Num() < 3 || NumTriangles < 1)
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to cook collision from streams: not enough elements in streams."));
+		return false;
+	}
 
-	if(FinalVerts.Num() < TNumericLimits<uint16>::Max())
+	if (!PositionStream->CanConvertTo<FVector3f>())
+	{
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to cook collision from streams: position stream not convertible to FVector3f"));
+		return false;
+	}
+
+	// Only the cooked result and the cook options are kept, the source data stays in the streams
+	const bool bCleanMesh = CollisionMesh.bCleanMesh;
+	const float WeldTolerance = CollisionMesh.WeldTolerance;
+	CollisionMesh = FRealtimeMeshCollisionMesh();
+	CollisionMesh.bCleanMesh = bCleanMesh;
+	CollisionMesh.WeldTolerance = WeldTolerance;
+
+	RealtimeMesh::FRealtimeMeshCollisionDiskCache* DiskCache = RealtimeMesh::FRealtimeMeshCollisionDiskCache::Get();
+	const uint64 DiskCacheKey = DiskCache? GetComplexMeshCookHash(Streams, MaterialIndex, bPolyGroupsAsMaterials, bCleanMesh, WeldTolerance) : 0;
+	if (DiskCache && DiskCache->TryLoad(DiskCacheKey, CollisionMesh.Cooked))
+	{
+		return true;
+	}
+
+	GRealtimeMeshComplexMeshCooks.fetch_add(1, std::memory_order_relaxed);
+	INC_DWORD_STAT_BY(STAT_RealtimeMeshCollision_CookedTriangles, NumTriangles);
+
+	// Convert the positions straight into the particles, this is a plain copy for FVector3f streams and a bulk conversion for anything else
+	RealtimeMeshCollisionCooking::FTriMeshParticles TriMeshParticles;
+	TriMeshParticles.AddParticles(PositionStream->Num());
+	PositionStream->CopyRange(0, MakeArrayView(RealtimeMeshCollisionCooking::GetParticlePositions(TriMeshParticles), PositionStream->Num()));
+
+	FRealtimeMeshCollisionMeshCookedUVData UVInfo;
+	if (UPhysicsSettings::Get()->bSupportUVFromHitResults)
 	{
-		TArray<Chaos::TVector<uint16, 3>> TrianglesSmallIdx;
-		LambdaHelper(TrianglesSmallIdx);
+		RealtimeMeshCollisionCooking::FillUVInfoFromStreams(UVInfo, *PositionStream, *TriangleStream, Streams.Find(FRealtimeMeshStreamKey(FRealtimeMeshStreams::TexCoords)));
+	}
+
+	// Polygroups are read in place when they're already uint16, anything else gets converted once
+	TArray<uint16> ConvertedPolyGroups;
+	const uint16* PolyGroups = nullptr;
+	if (PolyGroupStream && PolyGroupStream->Num() >= NumTriangles)
+	{
+		if (PolyGroupStream->GetElementType() == GetRealtimeMeshDataElementType<uint16>() && PolyGroupStream->GetNumElements() == 1)
+		{
+			PolyGroups = PolyGroupStream->GetElementArrayView<uint16>().GetData();
+		}
+		else if (PolyGroupStream->CanConvertTo<uint16>())
+		{
+			PolyGroupStream->CopyTo(ConvertedPolyGroups);
+			PolyGroups = ConvertedPolyGroups.GetData();
+		}
+	}
+	const uint16 FixedMaterial = static_cast<uint16>(FMath::Max(MaterialIndex, 0));
+	const auto GetMaterial = [PolyGroups, FixedMaterial](int32 TriangleIndex) { return PolyGroups ? PolyGroups[TriangleIndex] : FixedMaterial; };
+
+	constexpr bool bFlipNormals = true;
+	const FRealtimeMeshElementType IndexType = TriangleStream->GetElementType();
+	if (IndexType == GetRealtimeMeshDataElementType<uint16>())
+	{
+		CollisionMesh.Cooked = RealtimeMeshCollisionCooking::BuildCookedTriMesh(MoveTemp(TriMeshParticles), NumTriangles, bFlipNormals, bCleanMesh, WeldTolerance, true,
+			RealtimeMeshCollisionCooking::MakeStreamTriangleAccessor<uint16>(*TriangleStream), GetMaterial, MoveTemp(UVInfo));
+	}
+	else if (IndexType == GetRealtimeMeshDataElementType<uint32>())
+	{
+		CollisionMesh.Cooked = RealtimeMeshCollisionCooking::BuildCookedTriMesh(MoveTemp(TriMeshParticles), NumTriangles, bFlipNormals, bCleanMesh, WeldTolerance, true,
+			RealtimeMeshCollisionCooking::MakeStreamTriangleAccessor<uint32>(*TriangleStream), GetMaterial, MoveTemp(UVInfo));
+	}
+	else if (IndexType == GetRealtimeMeshDataElementType<int32>())
+	{
+		CollisionMesh.Cooked = RealtimeMeshCollisionCooking::BuildCookedTriMesh(MoveTemp(TriMeshParticles), NumTriangles, bFlipNormals, bCleanMesh, WeldTolerance, true,
+			RealtimeMeshCollisionCooking::MakeStreamTriangleAccessor<int32>(*TriangleStream), GetMaterial, MoveTemp(UVInfo));
 	}
 	else
 	{
-		TArray<Chaos::TVector<int32, 3>> TrianglesLargeIdx;
-		LambdaHelper(TrianglesLargeIdx);
-	}	
+		UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to cook collision from streams: unsupported index type %s"), *IndexType.ToString());
+		return false;
+	}
+
+	if (DiskCache && CollisionMesh.Cooked.IsValid())
+	{
+		DiskCache->Store(DiskCacheKey, *CollisionMesh.Cooked);
+	}
+	return true;
 }
 
 void URealtimeMeshCollisionTools::CopySimpleGeometryToBodySetup(const FRealtimeMeshSimpleGeometry& SimpleGeom, UBodySetup* BodySetup)
@@ -611,6 +937,803 @@ bool URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(FRealtimeMeshColl
 	return true;
 }
 
+namespace RealtimeMeshCollisionShapes
+{
+	using namespace RealtimeMesh;
+
+	struct FHull
+	{
+		TArray<FVector3d> Points;
+		double Volume = 0.0;
+	};
+
+	static void ComputeHull(TArray<FVector3d>&& Points, FHull& OutHull)
+	{
+		OutHull.Points.Reset();
+		OutHull.Volume = 0.0;
+
+		UE::Geometry::FConvexHull3d HullSolver;
+		if (Points.Num() >= 4 && HullSolver.Solve(Points.Num(), [&Points](int32 Index) { return Points[Index]; }) && HullSolver.GetDimension() == 3)
+		{
+			TArray<int32> HullIndices;
+			const FVector3d Origin = Points[0];
+			for (const UE::Geometry::FIndex3i& HullTri : HullSolver.GetTriangles())
+			{
+				HullIndices.Add(HullTri.A);
+				HullIndices.Add(HullTri.B);
+				HullIndices.Add(HullTri.C);
+				OutHull.Volume += FVector3d::DotProduct(Points[HullTri.A] - Origin, FVector3d::CrossProduct(Points[HullTri.B] - Origin, Points[HullTri.C] - Origin));
+			}
+			OutHull.Volume = FMath::Abs(OutHull.Volume) / 6.0;
+
+			HullIndices.Sort();
+			HullIndices.SetNum(Algo::Unique(HullIndices));
+			OutHull.Points.Reserve(HullIndices.Num());
+			for (const int32 HullIndex : HullIndices)
+			{
+				OutHull.Points.Add(Points[HullIndex]);
+			}
+		}
+		else
+		{
+			// Flat or degenerate, keep every point and leave it to the caller to thin them out
+			OutHull.Points = MoveTemp(Points);
+		}
+	}
+
+	static void ComputeHull(TConstArrayView<FVector3f> Vertices, TConstArrayView<TIndex3<int32>> Triangles, TConstArrayView<int32> HullTriangles, FHull& OutHull)
+	{
+		TArray<int32> VertexIndices;
+		VertexIndices.Reserve(HullTriangles.Num() * REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE);
+		for (const int32 TriIdx : HullTriangles)
+		{
+			VertexIndices.Add(Triangles[TriIdx].V0);
+			VertexIndices.Add(Triangles[TriIdx].V1);
+			VertexIndices.Add(Triangles[TriIdx].V2);
+		}
+		VertexIndices.Sort();
+		VertexIndices.SetNum(Algo::Unique(VertexIndices));
+
+		TArray<FVector3d> Points;
+		Points.SetNumUninitialized(VertexIndices.Num());
+		for (int32 Index = 0; Index < VertexIndices.Num(); Index++)
+		{
+			Points[Index] = FVector3d(Vertices[VertexIndices[Index]]);
+		}
+		ComputeHull(MoveTemp(Points), OutHull);
+	}
+
+	// Copies the positions and the valid triangles of the polygroup out of the streams
+	static bool GatherTriangles(const FRealtimeMeshStreamSet& Streams, int32 PolyGroup, TArray<FVector3f>& OutVertices, TArray<TIndex3<int32>>& OutTriangles, const TCHAR* Usage)
+	{
+		const FRealtimeMeshStream* PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
+		const FRealtimeMeshStream* TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
+
+		if (!PositionStream || !TriangleStream)
+		{
+			UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to %s: missing position or triangle stream."), Usage);
+			return false;
+		}
+
+		if (!PositionStream->CanConvertTo<FVector3f>())
+		{
+			UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to %s: position stream not convertible to FVector3f"), Usage);
+			return false;
+		}
+
+		TArray<uint16> PolyGroups;
+		if (PolyGroup != INDEX_NONE)
+		{
+			const FRealtimeMeshStream* PolyGroupStream = Streams.Find(FRealtimeMeshStreams::PolyGroups);
+			if (!PolyGroupStream || !PolyGroupStream->CanConvertTo<uint16>())
+			{
+				UE_LOG(LogRealtimeMeshInterface, Warning, TEXT("Unable to %s: missing or unsupported polygroup stream."), Usage);
+				return false;
+			}
+			PolyGroupStream->CopyTo(PolyGroups);
+		}
+
+		OutVertices.Reset();
+		PositionStream->CopyTo(OutVertices);
+
+		TRealtimeMeshStreamBuilder<const TIndex3<uint32>, void> TrianglesData(*TriangleStream);
+		OutTriangles.Reset(TrianglesData.Num());
+		for (int32 TriIdx = 0; TriIdx < TrianglesData.Num(); TriIdx++)
+		{
+			if (PolyGroup != INDEX_NONE && (!PolyGroups.IsValidIndex(TriIdx) || PolyGroups[TriIdx] != PolyGroup))
+			{
+				continue;
+			}
+
+			const TIndex3<int32> Tri(
+				static_cast<int32>(TrianglesData[TriIdx].GetElement(0).GetValue()),
+				static_cast<int32>(TrianglesData[TriIdx].GetElement(1).GetValue()),
+				static_cast<int32>(TrianglesData[TriIdx].GetElement(2).GetValue()));
+			if (OutVertices.IsValidIndex(Tri.V0) && OutVertices.IsValidIndex(Tri.V1) && OutVertices.IsValidIndex(Tri.V2))
+			{
+				OutTriangles.Add(Tri);
+			}
+		}
+		return true;
+	}
+}
+
+namespace RealtimeMeshConvexDecomposition
+{
+	using namespace RealtimeMesh;
+	using RealtimeMeshCollisionShapes::FHull;
+	using RealtimeMeshCollisionShapes::ComputeHull;
+
+	struct FSplit
+	{
+		TArray<int32> Triangles[2];
+		FHull Hulls[2];
+		/* Hull volume removed by the split, negative when there's no usable split */
+		double Gain = -1.0;
+	};
+
+	struct FCluster
+	{
+		TArray<int32> Triangles;
+		FHull Hull;
+		bool bSplitEvaluated = false;
+		FSplit BestSplit;
+	};
+
+	static void EvaluateSplit(TConstArrayView<FVector3f> Vertices, TConstArrayView<TIndex3<int32>> Triangles, TConstArrayView<FVector3d> Centroids,
+		const FCluster& Cluster, int32 Axis, FSplit& OutSplit)
+	{
+		double Min = TNumericLimits<double>::Max();
+		double Max = TNumericLimits<double>::Lowest();
+		for (const int32 TriIdx : Cluster.Triangles)
+		{
+			Min = FMath::Min(Min, Centroids[TriIdx][Axis]);
+			Max = FMath::Max(Max, Centroids[TriIdx][Axis]);
+		}
+
+		if (Max - Min <= KINDA_SMALL_NUMBER)
+		{
+			return;
+		}
+
+		// Triangles go to whichever side their centroid is on, so the two halves can overlap a little where triangles cross the plane
+		const double SplitValue = (Min + Max) * 0.5;
+		for (const int32 TriIdx : Cluster.Triangles)
+		{
+			OutSplit.Triangles[Centroids[TriIdx][Axis] < SplitValue ? 0 : 1].Add(TriIdx);
+		}
+
+		if (OutSplit.Triangles[0].Num() == 0 || OutSplit.Triangles[1].Num() == 0)
+		{
+			return;
+		}
+
+		ComputeHull(Vertices, Triangles, OutSplit.Triangles[0], OutSplit.Hulls[0]);
+		ComputeHull(Vertices, Triangles, OutSplit.Triangles[1], OutSplit.Hulls[1]);
+		OutSplit.Gain = Cluster.Hull.Volume - (OutSplit.Hulls[0].Volume + OutSplit.Hulls[1].Volume);
+	}
+
+	static TArray<FVector> ReduceToVertexBudget(TConstArrayView<FVector3d> Points, int32 MaxVertices)
+	{
+		if (Points.Num() <= MaxVertices)
+		{
+			return TArray<FVector>(Points.GetData(), Points.Num());
+		}
+
+		// Keep the support points along evenly spread directions, which keeps the extremes of the hull and drops the points in between
+		TArray<int32> Selected;
+		Selected.Reserve(MaxVertices);
+		for (int32 DirIdx = 0; DirIdx < MaxVertices; DirIdx++)
+		{
+			const double Z = 1.0 - (2.0 * DirIdx + 1.0) / MaxVertices;
+			const double Radius = FMath::Sqrt(FMath::Max(0.0, 1.0 - Z * Z));
+			const double Phi = DirIdx * PI * (3.0 - FMath::Sqrt(5.0));
+			const FVector3d Direction(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+
+			int32 BestIndex = 0;
+			double BestDistance = TNumericLimits<double>::Lowest();
+			for (int32 Index = 0; Index < Points.Num(); Index++)
+			{
+				const double Distance = FVector3d::DotProduct(Points[Index], Direction);
+				if (Distance > BestDistance)
+				{
+					BestDistance = Distance;
+					BestIndex = Index;
+				}
+			}
+			Selected.AddUnique(BestIndex);
+		}
+
+		TArray<FVector> Result;
+		Result.Reserve(Selected.Num());
+		for (const int32 Index : Selected)
+		{
+			Result.Add(Points[Index]);
+		}
+		return Result;
+	}
+}
+
+TFuture<FRealtimeMeshSimpleGeometry> URealtimeMeshCollisionTools::ComputeConvexDecomposition(const RealtimeMesh::FRealtimeMeshStreamSet& Streams,
+	const FRealtimeMeshConvexDecompositionSettings& Settings)
+{
+	using namespace RealtimeMesh;
+
+	// Copy out only what the decomposition needs, so the streams can change while it runs
+	TArray<FVector3f> Vertices;
+	TArray<TIndex3<int32>> Triangles;
+	if (!RealtimeMeshCollisionShapes::GatherTriangles(Streams, Settings.PolyGroup, Vertices, Triangles, TEXT("compute convex decomposition")))
+	{
+		return MakeFulfilledPromise<FRealtimeMeshSimpleGeometry>().GetFuture();
+	}
+
+	URealtimeMeshThreadingSubsystem* ThreadingSubsystem = GEngine? URealtimeMeshThreadingSubsystem::Get() : nullptr;
+	FQueuedThreadPool& ThreadPool = ThreadingSubsystem? ThreadingSubsystem->GetThreadPool() : *GThreadPool;
+	return AsyncPool(ThreadPool, [Vertices = MoveTemp(Vertices), Triangles = MoveTemp(Triangles), Settings]()
+	{
+		return BuildConvexDecomposition(Vertices, Triangles, Settings);
+	});
+}
+
+FRealtimeMeshSimpleGeometry URealtimeMeshCollisionTools::BuildConvexDecomposition(TConstArrayView<FVector3f> Vertices, TConstArrayView<RealtimeMesh::TIndex3<int32>> Triangles,
+	const FRealtimeMeshConvexDecompositionSettings& Settings)
+{
+	using namespace RealtimeMeshConvexDecomposition;
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshCollision_ConvexDecomposition);
+
+	FRealtimeMeshSimpleGeometry Result;
+	if (Triangles.Num() == 0)
+	{
+		return Result;
+	}
+
+	const int32 MaxHulls = FMath::Max(1, Settings.MaxHulls);
+	const int32 MaxVerticesPerHull = FMath::Max(4, Settings.MaxVerticesPerHull);
+
+	TArray<FVector3d> Centroids;
+	Centroids.SetNumUninitialized(Triangles.Num());
+	for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
+	{
+		const TIndex3<int32>& Tri = Triangles[TriIdx];
+		Centroids[TriIdx] = FVector3d(Vertices[Tri.V0] + Vertices[Tri.V1] + Vertices[Tri.V2]) / 3.0;
+	}
+
+	TArray<FCluster> Clusters;
+	{
+		FCluster& Root = Clusters.AddDefaulted_GetRef();
+		Root.Triangles.SetNumUninitialized(Triangles.Num());
+		for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
+		{
+			Root.Triangles[TriIdx] = TriIdx;
+		}
+		ComputeHull(Vertices, Triangles, Root.Triangles, Root.Hull);
+	}
+	const double MinGain = FMath::Max(0.0f, Settings.MinVolumeReduction) * Clusters[0].Hull.Volume;
+
+	while (Clusters.Num() < MaxHulls)
+	{
+		// Each cluster's split is only evaluated once, after that only the two new halves need evaluating
+		TArray<int32> PendingClusters;
+		for (int32 ClusterIdx = 0; ClusterIdx < Clusters.Num(); ClusterIdx++)
+		{
+			if (!Clusters[ClusterIdx].bSplitEvaluated)
+			{
+				PendingClusters.Add(ClusterIdx);
+			}
+		}
+
+		TArray<FSplit> Candidates;
+		Candidates.SetNum(PendingClusters.Num() * 3);
+		ParallelFor(Candidates.Num(), [&](int32 CandidateIdx)
+		{
+			EvaluateSplit(Vertices, Triangles, Centroids, Clusters[PendingClusters[CandidateIdx / 3]], CandidateIdx % 3, Candidates[CandidateIdx]);
+		});
+
+		for (int32 PendingIdx = 0; PendingIdx < PendingClusters.Num(); PendingIdx++)
+		{
+			FCluster& Cluster = Clusters[PendingClusters[PendingIdx]];
+			Cluster.bSplitEvaluated = true;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				FSplit& Candidate = Candidates[PendingIdx * 3 + Axis];
+				if (Candidate.Gain > Cluster.BestSplit.Gain)
+				{
+					Cluster.BestSplit = MoveTemp(Candidate);
+				}
+			}
+		}
+
+		int32 BestClusterIdx = INDEX_NONE;
+		double BestGain = MinGain;
+		for (int32 ClusterIdx = 0; ClusterIdx < Clusters.Num(); ClusterIdx++)
+		{
+			if (Clusters[ClusterIdx].BestSplit.Gain > BestGain)
+			{
+				BestGain = Clusters[ClusterIdx].BestSplit.Gain;
+				BestClusterIdx = ClusterIdx;
+			}
+		}
+
+		if (BestClusterIdx == INDEX_NONE)
+		{
+			break;
+		}
+
+		FSplit Split = MoveTemp(Clusters[BestClusterIdx].BestSplit);
+		Clusters[BestClusterIdx] = FCluster();
+		Clusters[BestClusterIdx].Triangles = MoveTemp(Split.Triangles[0]);
+		Clusters[BestClusterIdx].Hull = MoveTemp(Split.Hulls[0]);
+		FCluster& NewCluster = Clusters.AddDefaulted_GetRef();
+		NewCluster.Triangles = MoveTemp(Split.Triangles[1]);
+		NewCluster.Hull = MoveTemp(Split.Hulls[1]);
+	}
+
+	TArray<FRealtimeMeshCollisionConvex> Hulls;
+	Hulls.SetNum(Clusters.Num());
+	ParallelFor(Clusters.Num(), [&](int32 ClusterIdx)
+	{
+		Hulls[ClusterIdx].SetVertices(ReduceToVertexBudget(Clusters[ClusterIdx].Hull.Points, MaxVerticesPerHull));
+		if (Settings.bCookHulls)
+		{
+			CookConvexHull(Hulls[ClusterIdx]);
+		}
+	});
+
+	for (const FRealtimeMeshCollisionConvex& Hull : Hulls)
+	{
+		Result.ConvexHulls.Add(Hull);
+	}
+	return Result;
+}
+
+namespace RealtimeMeshCollisionFitting
+{
+	using RealtimeMeshCollisionShapes::FHull;
+
+	static FHull ComputePointHull(TConstArrayView<FVector3f> Points)
+	{
+		TArray<FVector3d> HullPoints;
+		HullPoints.SetNumUninitialized(Points.Num());
+		for (int32 Index = 0; Index < Points.Num(); Index++)
+		{
+			HullPoints[Index] = FVector3d(Points[Index]);
+		}
+
+		FHull Hull;
+		RealtimeMeshCollisionShapes::ComputeHull(MoveTemp(HullPoints), Hull);
+		return Hull;
+	}
+
+	static float GetFitQuality(const FHull& Hull, double ShapeVolume)
+	{
+		return ShapeVolume > UE_SMALL_NUMBER? static_cast<float>(FMath::Clamp(Hull.Volume / ShapeVolume, 0.0, 1.0)) : 0.0f;
+	}
+
+	// Eigenvectors of the covariance of the points through Jacobi rotations, sorted by decreasing variance and made right handed
+	static void ComputePrincipalAxes(TConstArrayView<FVector3d> Points, FVector3d OutAxes[3])
+	{
+		FVector3d Mean = FVector3d::ZeroVector;
+		for (const FVector3d& Point : Points)
+		{
+			Mean += Point;
+		}
+		Mean /= static_cast<double>(FMath::Max(1, Points.Num()));
+
+		double A[3][3] = {};
+		for (const FVector3d& Point : Points)
+		{
+			const FVector3d Delta = Point - Mean;
+			for (int32 Row = 0; Row < 3; Row++)
+			{
+				for (int32 Col = 0; Col < 3; Col++)
+				{
+					A[Row][Col] += Delta[Row] * Delta[Col];
+				}
+			}
+		}
+
+		double V[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+		for (int32 Sweep = 0; Sweep < 32; Sweep++)
+		{
+			const double OffDiagonal = A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+			const double Diagonal = A[0][0] * A[0][0] + A[1][1] * A[1][1] + A[2][2] * A[2][2];
+			if (OffDiagonal <= Diagonal * 1e-24)
+			{
+				break;
+			}
+
+			for (int32 P = 0; P < 2; P++)
+			{
+				for (int32 Q = P + 1; Q < 3; Q++)
+				{
+					if (FMath::Abs(A[P][Q]) < UE_DOUBLE_SMALL_NUMBER)
+					{
+						continue;
+					}
+
+					const double Theta = (A[Q][Q] - A[P][P]) / (2.0 * A[P][Q]);
+					const double T = (Theta >= 0.0? 1.0 : -1.0) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1.0));
+					const double C = 1.0 / FMath::Sqrt(T * T + 1.0);
+					const double S = T * C;
+
+					for (int32 K = 0; K < 3; K++)
+					{
+						const double AKP = A[K][P];
+						const double AKQ = A[K][Q];
+						A[K][P] = C * AKP - S * AKQ;
+						A[K][Q] = S * AKP + C * AKQ;
+					}
+					for (int32 K = 0; K < 3; K++)
+					{
+						const double APK = A[P][K];
+						const double AQK = A[Q][K];
+						A[P][K] = C * APK - S * AQK;
+						A[Q][K] = S * APK + C * AQK;
+					}
+					for (int32 K = 0; K < 3; K++)
+					{
+						const double VKP = V[K][P];
+						const double VKQ = V[K][Q];
+						V[K][P] = C * VKP - S * VKQ;
+						V[K][Q] = S * VKP + C * VKQ;
+					}
+				}
+			}
+		}
+
+		int32 Order[3] = { 0, 1, 2 };
+		Algo::Sort(Order, [&A](int32 Left, int32 Right) { return A[Left][Left] > A[Right][Right]; });
+		for (int32 Index = 0; Index < 3; Index++)
+		{
+			OutAxes[Index] = FVector3d(V[0][Order[Index]], V[1][Order[Index]], V[2][Order[Index]]).GetSafeNormal();
+		}
+		OutAxes[2] = FVector3d::CrossProduct(OutAxes[0], OutAxes[1]).GetSafeNormal();
+	}
+
+	static double MeasureBox(TConstArrayView<FVector3d> Points, const FVector3d Axes[3], FVector3d& OutMin, FVector3d& OutMax)
+	{
+		OutMin = FVector3d(TNumericLimits<double>::Max());
+		OutMax = FVector3d(TNumericLimits<double>::Lowest());
+		for (const FVector3d& Point : Points)
+		{
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				const double Distance = FVector3d::DotProduct(Point, Axes[Axis]);
+				OutMin[Axis] = FMath::Min(OutMin[Axis], Distance);
+				OutMax[Axis] = FMath::Max(OutMax[Axis], Distance);
+			}
+		}
+		const FVector3d Size = OutMax - OutMin;
+		return Size.X * Size.Y * Size.Z;
+	}
+
+	static void RotateBasis(const FVector3d InAxes[3], int32 AroundAxis, double Angle, FVector3d OutAxes[3])
+	{
+		const FVector3d Axes[3] = { InAxes[0], InAxes[1], InAxes[2] };
+		const int32 U = (AroundAxis + 1) % 3;
+		const int32 W = (AroundAxis + 2) % 3;
+		double Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, Angle);
+		OutAxes[AroundAxis] = Axes[AroundAxis];
+		OutAxes[U] = Axes[U] * Cos + Axes[W] * Sin;
+		OutAxes[W] = Axes[W] * Cos - Axes[U] * Sin;
+	}
+
+	// Badoiu-Clarkson iterations, stepping towards the farthest point by a shrinking amount, converge on the minimum enclosing ball
+	template<typename VectorType>
+	static void FitMinimumBall(TConstArrayView<VectorType> Points, const VectorType& Start, VectorType& OutCenter, double& OutRadius)
+	{
+		OutCenter = Start;
+		OutRadius = TNumericLimits<double>::Max();
+
+		VectorType Center = Start;
+		for (int32 Iteration = 1; Iteration <= 256; Iteration++)
+		{
+			int32 FarthestIndex = 0;
+			double FarthestDistSquared = -1.0;
+			for (int32 Index = 0; Index < Points.Num(); Index++)
+			{
+				const double DistSquared = VectorType::DistSquared(Points[Index], Center);
+				if (DistSquared > FarthestDistSquared)
+				{
+					FarthestDistSquared = DistSquared;
+					FarthestIndex = Index;
+				}
+			}
+
+			const double Radius = FMath::Sqrt(FarthestDistSquared);
+			if (Radius < OutRadius)
+			{
+				OutRadius = Radius;
+				OutCenter = Center;
+			}
+			Center += (Points[FarthestIndex] - Center) / (Iteration + 1.0);
+		}
+	}
+
+	static double FitBoxToPoints(TConstArrayView<FVector3d> Points, FRealtimeMeshCollisionBox& OutBox)
+	{
+		FVector3d Axes[3];
+		ComputePrincipalAxes(Points, Axes);
+
+		FVector3d Min, Max;
+		double BestVolume = MeasureBox(Points, Axes, Min, Max);
+
+		// The principal axes follow the point distribution rather than the extents, so search rotations around each axis for a smaller box
+		for (int32 Round = 0; Round < 3; Round++)
+		{
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				double BestAngle = 0.0;
+				double Range = PI / 4.0;
+				for (int32 Level = 0; Level < 4; Level++)
+				{
+					const double CenterAngle = BestAngle;
+					for (int32 Sample = -8; Sample <= 8; Sample++)
+					{
+						if (Sample == 0)
+						{
+							continue;
+						}
+
+						const double Angle = CenterAngle + Range * Sample / 8.0;
+						FVector3d RotatedAxes[3];
+						RotateBasis(Axes, Axis, Angle, RotatedAxes);
+						const double Volume = MeasureBox(Points, RotatedAxes, Min, Max);
+						if (Volume < BestVolume)
+						{
+							BestVolume = Volume;
+							BestAngle = Angle;
+						}
+					}
+					Range /= 8.0;
+				}
+
+				if (BestAngle != 0.0)
+				{
+					RotateBasis(Axes, Axis, BestAngle, Axes);
+				}
+			}
+		}
+
+		const double Volume = MeasureBox(Points, Axes, Min, Max);
+		const FVector3d LocalCenter = (Min + Max) * 0.5;
+		OutBox.Extents = Max - Min;
+		OutBox.Center = Axes[0] * LocalCenter.X + Axes[1] * LocalCenter.Y + Axes[2] * LocalCenter.Z;
+		OutBox.Rotation = FMatrix(Axes[0], Axes[1], Axes[2], FVector::ZeroVector).Rotator();
+		return Volume;
+	}
+
+	static double FitSphereToPoints(TConstArrayView<FVector3d> Points, FRealtimeMeshCollisionSphere& OutSphere)
+	{
+		FVector3d Axes[3];
+		ComputePrincipalAxes(Points, Axes);
+
+		// Ritter's sphere, seeded with the extremes along the principal axis
+		int32 MinIndex = 0;
+		int32 MaxIndex = 0;
+		for (int32 Index = 1; Index < Points.Num(); Index++)
+		{
+			const double Distance = FVector3d::DotProduct(Points[Index], Axes[0]);
+			MinIndex = Distance < FVector3d::DotProduct(Points[MinIndex], Axes[0])? Index : MinIndex;
+			MaxIndex = Distance > FVector3d::DotProduct(Points[MaxIndex], Axes[0])? Index : MaxIndex;
+		}
+
+		FVector3d Center = (Points[MinIndex] + Points[MaxIndex]) * 0.5;
+		double Radius = FVector3d::Dist(Points[MinIndex], Points[MaxIndex]) * 0.5;
+		for (const FVector3d& Point : Points)
+		{
+			const double Distance = FVector3d::Dist(Point, Center);
+			if (Distance > Radius)
+			{
+				const double NewRadius = (Radius + Distance) * 0.5;
+				Center += (Point - Center) * ((Distance - NewRadius) / Distance);
+				Radius = NewRadius;
+			}
+		}
+
+		FVector3d RefinedCenter;
+		double RefinedRadius;
+		FitMinimumBall<FVector3d>(Points, Center, RefinedCenter, RefinedRadius);
+		if (RefinedRadius < Radius)
+		{
+			Center = RefinedCenter;
+			Radius = RefinedRadius;
+		}
+
+		OutSphere.Center = Center;
+		OutSphere.Radius = static_cast<float>(Radius);
+		return (4.0 / 3.0) * PI * Radius * Radius * Radius;
+	}
+
+	static double FitCapsuleAlongAxis(TConstArrayView<FVector3d> Points, const FVector3d& Axis, FRealtimeMeshCollisionCapsule& OutCapsule)
+	{
+		FVector3d U, W;
+		Axis.FindBestAxisVectors(U, W);
+
+		TArray<FVector2d> Projected;
+		TArray<double> Heights;
+		Projected.SetNumUninitialized(Points.Num());
+		Heights.SetNumUninitialized(Points.Num());
+		FVector2d Mean = FVector2d::ZeroVector;
+		for (int32 Index = 0; Index < Points.Num(); Index++)
+		{
+			Projected[Index] = FVector2d(FVector3d::DotProduct(Points[Index], U), FVector3d::DotProduct(Points[Index], W));
+			Heights[Index] = FVector3d::DotProduct(Points[Index], Axis);
+			Mean += Projected[Index];
+		}
+		Mean /= static_cast<double>(FMath::Max(1, Points.Num()));
+
+		FVector2d CircleCenter;
+		double CircleRadius;
+		FitMinimumBall<FVector2d>(Projected, Mean, CircleCenter, CircleRadius);
+
+		// A wider capsule can have a shorter segment, try a few radii and keep the smallest volume
+		double BestVolume = TNumericLimits<double>::Max();
+		for (int32 Step = 0; Step <= 16; Step++)
+		{
+			const double Radius = CircleRadius * (1.0 + Step / 16.0);
+
+			double Bottom = TNumericLimits<double>::Max();
+			double Top = TNumericLimits<double>::Lowest();
+			for (int32 Index = 0; Index < Points.Num(); Index++)
+			{
+				const double Slack = FMath::Sqrt(FMath::Max(0.0, Radius * Radius - FVector2d::DistSquared(Projected[Index], CircleCenter)));
+				Bottom = FMath::Min(Bottom, Heights[Index] + Slack);
+				Top = FMath::Max(Top, Heights[Index] - Slack);
+			}
+			if (Bottom > Top)
+			{
+				Bottom = Top = (Bottom + Top) * 0.5;
+			}
+
+			const double Volume = PI * Radius * Radius * (Top - Bottom) + (4.0 / 3.0) * PI * Radius * Radius * Radius;
+			if (Volume < BestVolume)
+			{
+				BestVolume = Volume;
+				OutCapsule.Radius = static_cast<float>(Radius);
+				OutCapsule.Length = static_cast<float>(Top - Bottom);
+				OutCapsule.Center = U * CircleCenter.X + W * CircleCenter.Y + Axis * ((Bottom + Top) * 0.5);
+			}
+		}
+
+		OutCapsule.Rotation = FRotationMatrix::MakeFromZ(Axis).Rotator();
+		return BestVolume;
+	}
+
+	static double FitCapsuleToPoints(TConstArrayView<FVector3d> Points, FRealtimeMeshCollisionCapsule& OutCapsule)
+	{
+		FVector3d Axes[3];
+		ComputePrincipalAxes(Points, Axes);
+
+		double BestVolume = TNumericLimits<double>::Max();
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			FRealtimeMeshCollisionCapsule Capsule;
+			const double Volume = FitCapsuleAlongAxis(Points, Axes[Axis], Capsule);
+			if (Volume < BestVolume)
+			{
+				BestVolume = Volume;
+				OutCapsule = Capsule;
+			}
+		}
+		return BestVolume;
+	}
+}
+
+float URealtimeMeshCollisionTools::FitBox(TConstArrayView<FVector3f> Points, FRealtimeMeshCollisionBox& OutBox)
+{
+	using namespace RealtimeMeshCollisionFitting;
+	const FHull Hull = ComputePointHull(Points);
+	return Hull.Points.Num() > 0? GetFitQuality(Hull, FitBoxToPoints(Hull.Points, OutBox)) : 0.0f;
+}
+
+float URealtimeMeshCollisionTools::FitSphere(TConstArrayView<FVector3f> Points, FRealtimeMeshCollisionSphere& OutSphere)
+{
+	using namespace RealtimeMeshCollisionFitting;
+	const FHull Hull = ComputePointHull(Points);
+	return Hull.Points.Num() > 0? GetFitQuality(Hull, FitSphereToPoints(Hull.Points, OutSphere)) : 0.0f;
+}
+
+float URealtimeMeshCollisionTools::FitCapsule(TConstArrayView<FVector3f> Points, FRealtimeMeshCollisionCapsule& OutCapsule)
+{
+	using namespace RealtimeMeshCollisionFitting;
+	const FHull Hull = ComputePointHull(Points);
+	return Hull.Points.Num() > 0? GetFitQuality(Hull, FitCapsuleToPoints(Hull.Points, OutCapsule)) : 0.0f;
+}
+
+bool URealtimeMeshCollisionTools::GatherCollisionFitPoints(const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 PolyGroup, TArray<FVector3f>& OutPoints)
+{
+	using namespace RealtimeMesh;
+
+	TArray<FVector3f> Vertices;
+	TArray<TIndex3<int32>> Triangles;
+	if (!RealtimeMeshCollisionShapes::GatherTriangles(Streams, PolyGroup, Vertices, Triangles, TEXT("fit simple collision")))
+	{
+		return false;
+	}
+
+	// Only the vertices the triangles use, streams can carry vertices of other polygroups or unused ones
+	TBitArray<> UsedVertices(false, Vertices.Num());
+	for (const TIndex3<int32>& Tri : Triangles)
+	{
+		UsedVertices[Tri.V0] = true;
+		UsedVertices[Tri.V1] = true;
+		UsedVertices[Tri.V2] = true;
+	}
+
+	OutPoints.Reset();
+	for (TConstSetBitIterator<> It(UsedVertices); It; ++It)
+	{
+		OutPoints.Add(Vertices[It.GetIndex()]);
+	}
+	return OutPoints.Num() > 0;
+}
+
+FRealtimeMeshCollisionFitResult URealtimeMeshCollisionTools::FitSimpleCollision(const RealtimeMesh::FRealtimeMeshStreamSet& Streams, FRealtimeMeshSimpleGeometry& SimpleGeometry,
+	int32 PolyGroup, float MinQuality)
+{
+	using namespace RealtimeMeshCollisionFitting;
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshCollision_FitSimpleCollision);
+
+	FRealtimeMeshCollisionFitResult Result;
+
+	TArray<FVector3f> Points;
+	if (!GatherCollisionFitPoints(Streams, PolyGroup, Points))
+	{
+		return Result;
+	}
+
+	// The hull is shared by all three fits, they only ever need its vertices
+	const FHull Hull = ComputePointHull(Points);
+	if (Hull.Volume <= 0.0)
+	{
+		return Result;
+	}
+
+	FRealtimeMeshCollisionBox Box;
+	FRealtimeMeshCollisionSphere Sphere;
+	FRealtimeMeshCollisionCapsule Capsule;
+	const float BoxQuality = GetFitQuality(Hull, FitBoxToPoints(Hull.Points, Box));
+	const float SphereQuality = GetFitQuality(Hull, FitSphereToPoints(Hull.Points, Sphere));
+	const float CapsuleQuality = GetFitQuality(Hull, FitCapsuleToPoints(Hull.Points, Capsule));
+
+	ERealtimeMeshCollisionFitShape BestShape = ERealtimeMeshCollisionFitShape::Box;
+	Result.Quality = BoxQuality;
+	if (SphereQuality > Result.Quality)
+	{
+		BestShape = ERealtimeMeshCollisionFitShape::Sphere;
+		Result.Quality = SphereQuality;
+	}
+	if (CapsuleQuality > Result.Quality)
+	{
+		BestShape = ERealtimeMeshCollisionFitShape::Capsule;
+		Result.Quality = CapsuleQuality;
+	}
+
+	if (Result.Quality < MinQuality)
+	{
+		return Result;
+	}
+
+	Result.Shape = BestShape;
+	switch (BestShape)
+	{
+	case ERealtimeMeshCollisionFitShape::Box:
+		Result.Index = SimpleGeometry.Boxes.Add(Box);
+		break;
+	case ERealtimeMeshCollisionFitShape::Sphere:
+		Result.Index = SimpleGeometry.Spheres.Add(Sphere);
+		break;
+	case ERealtimeMeshCollisionFitShape::Capsule:
+		Result.Index = SimpleGeometry.Capsules.Add(Capsule);
+		break;
+	default:
+		break;
+	}
+	return Result;
+}
+
 
 // Sphere Functions
 
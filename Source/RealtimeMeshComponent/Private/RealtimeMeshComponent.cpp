@@ -8,16 +8,29 @@
 #include "RealtimeMeshComponentModule.h"
 #include "RenderProxy/RealtimeMeshComponentProxy.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "Physics/PhysicsInterfaceCore.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
 #include "RealtimeMeshCore.h"
 #include "RealtimeMesh.h"
 #include "NavigationSystem.h"
 #include "RenderProxy/RealtimeMeshNaniteProxyInterface.h"
 #include "RenderProxy/RealtimeMeshProxy.h"
 #include "Net/UnrealNetwork.h"
+#include <atomic>
 
 
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponent - Collision Data Received"), STAT_RealtimeMeshComponent_NewCollisionMeshReceived, STATGROUP_RealtimeMesh);
 DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponent - Create Scene Proxy"), STAT_RealtimeMeshComponent_CreateSceneProxy, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponent - Update Collision In Place"), STAT_RealtimeMeshComponent_UpdateCollisionInPlace, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshComponent - Recreate Physics State"), STAT_RealtimeMeshComponent_RecreatePhysicsState, STATGROUP_RealtimeMesh);
+
+static std::atomic<uint64> GRealtimeMeshCollisionUpdatesInPlace(0);
+
+uint64 URealtimeMeshComponent::GetNumCollisionUpdatesInPlace()
+{
+	return GRealtimeMeshCollisionUpdatesInPlace.load(std::memory_order_relaxed);
+}
 
 URealtimeMeshComponent::URealtimeMeshComponent()
 {
@@ -349,25 +362,86 @@ void URealtimeMeshComponent::HandleCollisionBodyUpdated(URealtimeMesh* InRealtim
 
 void URealtimeMeshComponent::UpdateCollision()
 {
-	if (KeepMomentumOnCollisionUpdate)
+	if (!UpdateCollisionInPlace())
 	{
-		// First Store Velocities
-		const FVector PrevLinearVelocity = GetPhysicsLinearVelocity();
-		const FVector PrevAngularVelocity = GetPhysicsAngularVelocityInDegrees();
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshComponent_RecreatePhysicsState);
+		
+		if (KeepMomentumOnCollisionUpdate)
+		{
+			// First Store Velocities
+			const FVector PrevLinearVelocity = GetPhysicsLinearVelocity();
+			const FVector PrevAngularVelocity = GetPhysicsAngularVelocityInDegrees();
 
-		// Recreate the physics state
-		RecreatePhysicsState();
+			// Recreate the physics state
+			RecreatePhysicsState();
 
-		// Apply Velocities
-		SetPhysicsLinearVelocity(PrevLinearVelocity, false);
-		SetPhysicsAngularVelocityInDegrees(PrevAngularVelocity, false);
-	}
-	else
-	{
-		//First recreate the physics state
-		RecreatePhysicsState();
+			// Apply Velocities
+			SetPhysicsLinearVelocity(PrevLinearVelocity, false);
+			SetPhysicsAngularVelocityInDegrees(PrevAngularVelocity, false);
+		}
+		else
+		{
+			//First recreate the physics state
+			RecreatePhysicsState();
+		}
 	}
 
 	// Now update the navigation.
 	FNavigationSystem::UpdateComponentData(*this);
 }
+
+bool URealtimeMeshComponent::UpdateCollisionInPlace()
+{
+	// The mesh keeps its body setup when only the shapes changed, a different one means the body configuration changed
+	UBodySetup* CurrentBodySetup = GetBodySetup();
+	if (!IsValid(CurrentBodySetup) || !BodyInstance.IsValidBodyInstance() || BodyInstance.GetBodySetup() != CurrentBodySetup)
+	{
+		return false;
+	}
+
+	// Welded bodies share the actor, swapping its shapes would drop theirs. Both the weld parent and its welded
+	// children recreate instead, which tears the weld down and rebuilds it from the current body setup
+	const TMap<FPhysicsShapeHandle, FBodyInstance::FWeldInfo>* WeldInfo = BodyInstance.GetCurrentWeldInfo();
+	if (BodyInstance.WeldParent != nullptr || (WeldInfo && WeldInfo->Num() > 0))
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshComponent_UpdateCollisionInPlace);
+
+	FBodyCollisionData BodyCollisionData;
+	BodyInstance.BuildBodyFilterData(BodyCollisionData.CollisionFilterData);
+	FBodyInstance::BuildBodyCollisionFlags(BodyCollisionData.CollisionFlags, BodyInstance.GetCollisionEnabled(), CurrentBodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple);
+
+	UPhysicalMaterial* SimpleMaterial = BodyInstance.GetSimplePhysicalMaterial();
+	TArray<UPhysicalMaterial*> ComplexMaterials;
+	TArray<FPhysicalMaterialMaskParams> ComplexMaterialMasks;
+	BodyInstance.GetComplexPhysicalMaterials(ComplexMaterials, ComplexMaterialMasks);
+
+	// Replace the shapes on the existing actor, which keeps its constraints, overlaps and velocity
+	FVector Scale3D = GetComponentTransform().GetScale3D();
+	FPhysicsCommand::ExecuteWrite(BodyInstance.ActorHandle, [&](const FPhysicsActorHandle& Actor)
+	{
+		TArray<FPhysicsShapeHandle> OldShapes;
+		BodyInstance.GetAllShapes_AssumesLocked(OldShapes);
+		for (FPhysicsShapeHandle& Shape : OldShapes)
+		{
+			FPhysicsInterface::DetachShape(Actor, Shape, false);
+		}
+		
+		CurrentBodySetup->AddShapesToRigidActor_AssumesLocked(&BodyInstance, Scale3D, SimpleMaterial, ComplexMaterials, ComplexMaterialMasks, BodyCollisionData);
+	});
+
+	if (FPhysScene* PhysScene = BodyInstance.GetPhysicsScene())
+	{
+		PhysScene->UpdateActorInAccelerationStructure(BodyInstance.ActorHandle);
+	}
+
+	if (BodyInstance.IsInstanceSimulatingPhysics())
+	{
+		BodyInstance.UpdateMassProperties();
+	}
+
+	GRealtimeMeshCollisionUpdatesInPlace.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
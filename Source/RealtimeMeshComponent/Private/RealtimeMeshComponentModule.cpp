@@ -5,6 +5,7 @@
 #include "Interfaces/IPluginManager.h"
 #include "ShaderCore.h"
 #include "RealtimeMeshCore.h"
+#include "Data/RealtimeMeshCollisionCookScheduler.h"
 
 
 // Register the custom version with core
@@ -32,6 +33,7 @@ void FRealtimeMeshComponentPlugin::StartupModule()
 
 void FRealtimeMeshComponentPlugin::ShutdownModule()
 {
+	RealtimeMesh::FRealtimeMeshCollisionCookScheduler::TearDown();
 }
 
 DEFINE_LOG_CATEGORY(LogRealtimeMesh);
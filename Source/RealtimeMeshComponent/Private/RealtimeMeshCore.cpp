@@ -66,6 +66,11 @@ namespace RealtimeMesh
 		return MakeShareable(new FRealtimeMeshLocalVertexFactory(GetFeatureLevel()), FRealtimeMeshRenderThreadDeleter<FRealtimeMeshLocalVertexFactory>());
 	}
 
+	FRealtimeMeshVertexFactoryRef FRealtimeMeshSharedResources::CreateInterleavedVertexFactory() const
+	{
+		return MakeShareable(new FRealtimeMeshInterleavedVertexFactory(GetFeatureLevel()), FRealtimeMeshRenderThreadDeleter<FRealtimeMeshInterleavedVertexFactory>());
+	}
+
 	FRealtimeMeshSectionProxyRef FRealtimeMeshSharedResources::CreateSectionProxy(const FRealtimeMeshSectionKey& InKey) const
 	{
 		return MakeShareable(new FRealtimeMeshSectionProxy(ConstCastSharedRef<FRealtimeMeshSharedResources>(this->AsShared()), InKey),
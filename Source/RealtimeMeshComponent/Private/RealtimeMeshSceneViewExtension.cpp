@@ -33,22 +33,22 @@ void FRealtimeMeshSceneViewExtension::BeginRenderViewFamily(FSceneViewFamily& In
 
 void FRealtimeMeshSceneViewExtension::PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
 {
+	TArray<RealtimeMesh::FRealtimeMeshProxyPtr> Proxies;
+	Proxies.Reserve(ActiveProxies.Num());
 	for (auto It = ActiveProxies.CreateIterator(); It; ++It)
 	{
 		if (auto Pinned = It->Pin())
 		{
-			// We only process commands if there are no components using it, this allows syncing to
-			// the render thread, but without causing issues with existing components.
-			if (!Pinned->HasAnyReferencingComponents())
-			{
-				Pinned->ProcessCommands(GraphBuilder.RHICmdList);
-			}
+			Proxies.Add(MoveTemp(Pinned));
 		}
 		else
 		{
 			It.RemoveCurrent();
 		}
 	}
+
+	// Proxies in use by components only apply updates that don't need their scene proxy recreated, see FRealtimeMeshProxy::ProcessCommandsForFrame
+	RealtimeMesh::FRealtimeMeshProxy::ProcessCommandsForFrame(GraphBuilder.RHICmdList, Proxies);
 }
 
 void FRealtimeMeshSceneViewExtension::PostRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView)
@@ -9,6 +9,7 @@
 #include "Core/RealtimeMeshSectionConfig.h"
 #include "Core/RealtimeMeshSectionGroupConfig.h"
 #include "Interfaces/Interface_CollisionDataProvider.h"
+#include "Chaos/ChaosArchive.h"
 
 FArchive& operator<<(FArchive& Ar, FRealtimeMeshLODKey& Key)
 {		
@@ -92,6 +93,15 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshSectionGroupConfig& Config)
 	{
 		Ar << Config.DrawType;
 	}
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::SectionGroupStoresPositionQuantization)
+	{
+		Ar << Config.PositionQuantization.Scale;
+		Ar << Config.PositionQuantization.Bias;
+	}
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::SectionGroupInterleavedVertexStreams)
+	{
+		Ar << Config.bInterleaveVertexStreams;
+	}
 	return Ar;
 }
 	
@@ -124,6 +134,22 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionConfiguration& Config)
 	{
 		Ar << Config.bMergeAllMeshes;
 	}
+
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::CollisionSourceSelection)
+	{
+		Ar << Config.ComplexCollisionLOD;
+	}
+
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::CollisionMeshCleaning)
+	{
+		Ar << Config.bCleanComplexMesh;
+		Ar << Config.ComplexMeshWeldTolerance;
+	}
+
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::CollisionChunking)
+	{
+		Ar << Config.ComplexCollisionChunkSize;
+	}
 	return Ar;
 }
 
@@ -227,6 +253,19 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionMeshCookedUVData& UVInf
 	return Ar;
 }
 
+FArchive& operator<<(FArchive& Ar, FRealtimeMeshCookedTriMeshData& CookedData)
+{
+	// The trimesh goes through chaos serialization so the acceleration structure doesn't have to be rebuilt on load
+	Chaos::FChaosArchive ChaosAr(Ar);
+	ChaosAr << CookedData.TriMesh;
+	
+	Ar << CookedData.VertexRemap;
+	Ar << CookedData.FaceRemap;
+	Ar << CookedData.UVInfo;
+
+	return Ar;
+}
+
 FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionMesh& MeshData)
 {
 	Ar << MeshData.Vertices;
@@ -257,6 +296,12 @@ FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionMesh& MeshData)
 		Ar << MeshData.TexCoords;
 		Ar << MeshData.bFlipNormals;
 	}
+
+	if (Ar.CustomVer(RealtimeMesh::FRealtimeMeshVersion::GUID) >= RealtimeMesh::FRealtimeMeshVersion::CollisionMeshCleaning)
+	{
+		Ar << MeshData.bCleanMesh;
+		Ar << MeshData.WeldTolerance;
+	}
 	
 	return Ar;
 }
@@ -326,22 +371,22 @@ namespace RealtimeMesh
 
 		if (SerializedNum > 0)
 		{
-			Stream.ArrayNum = 0;
-
 			// Serialize simple bytes which require no construction or destruction.
-			if (SerializedNum && Ar.IsLoading())
+			if (Ar.IsLoading())
 			{
+				Stream.ArrayNum = 0;
 				Stream.ResizeAllocation(SerializedNum);
-			}
 
-			// TODO: This will not handle endianness of the vertex data for say a network archive.
-			Ar.Serialize(Stream.GetData(), SerializedNum * Stream.GetStride());
-			Stream.ArrayNum = SerializedNum;
-
-			if (Ar.IsLoading())
-			{					
+				// TODO: This will not handle endianness of the vertex data for say a network archive.
+				Ar.Serialize(Stream.GetData(), SerializedNum * Stream.GetStride());
+				Stream.ArrayNum = SerializedNum;
 				Stream.BroadcastNumChanged();
 			}
+			else
+			{
+				// Saving only reads the data, so go through the const accessor to avoid detaching shared storage
+				Ar.Serialize(const_cast<uint8*>(AsConst(Stream).GetData()), SerializedNum * Stream.GetStride());
+			}
 		}
 		else if (Ar.IsLoading())
 		{
@@ -8,7 +8,11 @@
 #include "RenderProxy/RealtimeMeshProxyCommandBatch.h"
 #include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
 #include "RenderProxy/RealtimeMeshVertexFactory.h"
+#include "Algo/AnyOf.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
+#include "PhysicsEngine/PhysicsSettings.h"
 #include "Core/RealtimeMeshFuture.h"
 #include "Data/RealtimeMeshUpdateBuilder.h"
 #include "Mesh/RealtimeMeshAlgo.h"
@@ -18,13 +22,114 @@
 
 #define LOCTEXT_NAMESPACE "RealtimeMeshSimple"
 
+static TAutoConsoleVariable<int32> CVarRealtimeMeshSimpleShareStreamStorage(
+	TEXT("RealtimeMesh.Simple.ShareStreamStorage"),
+	1,
+	TEXT("Share stream memory between the CPU copy held by simple meshes and the GPU upload instead of copying it (copy on write). 0 = always copy, 1 = share"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshSimpleCacheSectionGroupCooks(
+	TEXT("RealtimeMesh.Collision.CacheSectionGroupCooks"),
+	1,
+	TEXT("Keep the cooked complex collision of each simple section group and only re-cook groups whose collision content changed. 0 = cook every group on every collision update, 1 = cache"));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshCollisionCookFromStreams(
+	TEXT("RealtimeMesh.Collision.CookFromStreams"),
+	1,
+	TEXT("Cook complex collision directly from the section group streams when possible instead of building an intermediate collision mesh first. 0 = always build the collision mesh, 1 = cook from streams"));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshSimple - Collision Section Group Cooks"), STAT_RealtimeMeshSimple_CollisionSectionGroupCooks, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshSimple - Collision Section Group Cache Hits"), STAT_RealtimeMeshSimple_CollisionSectionGroupCacheHits, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshSimple - Collision Chunk Cooks"), STAT_RealtimeMeshSimple_CollisionChunkCooks, STATGROUP_RealtimeMesh);
+
 using namespace RealtimeMesh;
 
 namespace RealtimeMesh
 {
 	namespace Simple::Private
 	{
-		static thread_local bool bShouldDeferPolyGroupUpdates = false;		
+		static thread_local bool bShouldDeferPolyGroupUpdates = false;
+		static thread_local bool bShouldDeferInterleavedUpdates = false;
+
+		static void PrepareStreamForCopy(FRealtimeMeshStream& Stream)
+		{
+			if (CVarRealtimeMeshSimpleShareStreamStorage.GetValueOnAnyThread() != 0)
+			{
+				Stream.ConvertToSharedStorage();
+			}
+		}
+
+		// Section groups cook their own collision, so they pick the cook options up from the mesh that owns them
+		static FRealtimeMeshCollisionConfiguration GetOwnerCollisionConfig(const FRealtimeMeshSharedResourcesRef& SharedResources, const FRealtimeMeshLockContext& LockContext)
+		{
+			const FRealtimeMeshPtr Owner = SharedResources->GetOwner();
+			return Owner.IsValid() ? StaticCastSharedPtr<FRealtimeMeshSimple>(Owner)->GetCollisionConfig(LockContext) : FRealtimeMeshCollisionConfiguration();
+		}
+
+		// Copies the given triangles of the source mesh into their own compact collision mesh
+		static void BuildCollisionChunk(const FRealtimeMeshCollisionMesh& SourceMesh, TConstArrayView<int32> ChunkTriangles, FRealtimeMeshCollisionMesh& OutChunkMesh)
+		{
+			const TArray<FVector3f>& SourceVertices = SourceMesh.GetVertices();
+			const TArray<TIndex3<int32>>& SourceTriangles = SourceMesh.GetTriangles();
+			const TArray<uint16>& SourceMaterials = SourceMesh.GetMaterials();
+			const TArray<TArray<FVector2f>>& SourceTexCoords = SourceMesh.GetTexCoords();
+			const bool bHasMaterials = SourceMaterials.Num() == SourceTriangles.Num();
+
+			TMap<int32, int32> VertexRemap;
+			VertexRemap.Reserve(ChunkTriangles.Num() * 2);
+			TArray<int32> ChunkVertexSources;
+			ChunkVertexSources.Reserve(ChunkTriangles.Num() * 2);
+			const auto RemapVertex = [&](int32 SourceIndex)
+			{
+				if (const int32* Existing = VertexRemap.Find(SourceIndex))
+				{
+					return *Existing;
+				}
+				const int32 NewIndex = ChunkVertexSources.Add(SourceIndex);
+				VertexRemap.Add(SourceIndex, NewIndex);
+				return NewIndex;
+			};
+
+			TArray<TIndex3<int32>> Triangles;
+			Triangles.Reserve(ChunkTriangles.Num());
+			TArray<uint16> Materials;
+			Materials.Reserve(bHasMaterials ? ChunkTriangles.Num() : 0);
+			for (const int32 TriangleIndex : ChunkTriangles)
+			{
+				const TIndex3<int32>& Triangle = SourceTriangles[TriangleIndex];
+				Triangles.Add(TIndex3<int32>(RemapVertex(Triangle.V0), RemapVertex(Triangle.V1), RemapVertex(Triangle.V2)));
+				if (bHasMaterials)
+				{
+					Materials.Add(SourceMaterials[TriangleIndex]);
+				}
+			}
+
+			TArray<FVector3f> Vertices;
+			Vertices.SetNumUninitialized(ChunkVertexSources.Num());
+			for (int32 Index = 0; Index < ChunkVertexSources.Num(); Index++)
+			{
+				Vertices[Index] = SourceVertices[ChunkVertexSources[Index]];
+			}
+
+			TArray<TArray<FVector2f>> TexCoords;
+			TexCoords.SetNum(SourceTexCoords.Num());
+			for (int32 ChannelIndex = 0; ChannelIndex < SourceTexCoords.Num(); ChannelIndex++)
+			{
+				if (SourceTexCoords[ChannelIndex].Num() == SourceVertices.Num())
+				{
+					TexCoords[ChannelIndex].SetNumUninitialized(ChunkVertexSources.Num());
+					for (int32 Index = 0; Index < ChunkVertexSources.Num(); Index++)
+					{
+						TexCoords[ChannelIndex][Index] = SourceTexCoords[ChannelIndex][ChunkVertexSources[Index]];
+					}
+				}
+			}
+
+			OutChunkMesh.SetVertices(MoveTemp(Vertices));
+			OutChunkMesh.SetTriangles(MoveTemp(Triangles));
+			OutChunkMesh.SetMaterials(MoveTemp(Materials));
+			OutChunkMesh.SetTexCoords(MoveTemp(TexCoords));
+			OutChunkMesh.SetCleanSettings(SourceMesh.ShouldCleanMesh(), SourceMesh.GetWeldTolerance());
+		}
 	}	
 	
 	FRealtimeMeshSectionSimple::FRealtimeMeshSectionSimple(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionKey& InKey)
@@ -101,6 +206,18 @@ namespace RealtimeMesh
 							const FVector3f* Points = Stream->GetData<FVector3f>() + SectionStreamRange.GetMinVertex();
 							LocalBounds = FBoxSphereBounds3f(Points, SectionStreamRange.NumVertices());
 						}
+						else if (Stream->GetLayout() == GetRealtimeMeshBufferLayout<FRealtimeMeshQuantizedPosition>())
+						{
+							const FRealtimeMeshPositionQuantization& Quantization = SectionGroup->GetConfig(UpdateContext).PositionQuantization;
+							const FRealtimeMeshQuantizedPosition* Points = Stream->GetData<FRealtimeMeshQuantizedPosition>() + SectionStreamRange.GetMinVertex();
+
+							FBox3f Box(ForceInit);
+							for (int32 Index = 0; Index < SectionStreamRange.NumVertices(); Index++)
+							{
+								Box += Quantization.Dequantize(Points[Index]);
+							}
+							LocalBounds = FBoxSphereBounds3f(Box);
+						}
 					}
 				}
 
@@ -155,6 +272,21 @@ namespace RealtimeMesh
 		ConfigHandler = FRealtimeMeshPolyGroupConfigHandler::CreateSP(this, &FRealtimeMeshSectionGroupSimple::DefaultPolyGroupSectionHandler);
 	}
 
+	void FRealtimeMeshSectionGroupSimple::SetCollisionStreams(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStreamSet&& InCollisionStreams)
+	{
+		CollisionStreams = MoveTemp(InCollisionStreams);
+		UpdateContext.GetState<FRealtimeMeshSimpleUpdateState>().CollisionGroupDirtySet.Flag(Key);
+	}
+
+	void FRealtimeMeshSectionGroupSimple::ClearCollisionStreams(FRealtimeMeshUpdateContext& UpdateContext)
+	{
+		if (CollisionStreams.Num() > 0)
+		{
+			CollisionStreams.Empty();
+			UpdateContext.GetState<FRealtimeMeshSimpleUpdateState>().CollisionGroupDirtySet.Flag(Key);
+		}
+	}
+
 	void FRealtimeMeshSectionGroupSimple::ProcessMeshData(const FRealtimeMeshLockContext& LockContext, TFunctionRef<void(const FRealtimeMeshStreamSet&)> ProcessFunc) const
 	{
 		ProcessFunc(Streams);
@@ -166,8 +298,9 @@ namespace RealtimeMesh
 
 		for (const auto& UpdatedStream : UpdatedStreams)
 		{
-			if (const auto* Stream = Streams.Find(UpdatedStream))
+			if (auto* Stream = Streams.Find(UpdatedStream))
 			{
+				Simple::Private::PrepareStreamForCopy(*Stream);
 				FRealtimeMeshStream StreamCopy(*Stream);				
 				FRealtimeMeshSectionGroup::CreateOrUpdateStream(UpdateContext, MoveTemp(StreamCopy));
 			}
@@ -178,11 +311,148 @@ namespace RealtimeMesh
 								  FText::FromString(UpdatedStream.ToString()), FText::FromName(SharedResources->GetMeshName())));
 			}
 		}
+
+		// Repack once for all the edited streams
+		if (Algo::AnyOf(UpdatedStreams, &FRealtimeMeshInterleavedLayout::CanInterleaveStream))
+		{
+			UpdateInterleavedStream(UpdateContext);
+		}
+	}
+
+	void FRealtimeMeshSectionGroupSimple::EditMeshDataRanges(FRealtimeMeshUpdateContext& UpdateContext, TFunctionRef<TSet<FRealtimeMeshStreamKey>(FRealtimeMeshStreamSet&)> EditFunc)
+	{
+		struct FStreamSnapshot
+		{
+			int32 Num;
+			FRealtimeMeshBufferLayout Layout;
+		};
+
+		// Remember the shape of every stream so we can tell which edits can be sent as a sub-range
+		TMap<FRealtimeMeshStreamKey, FStreamSnapshot> Snapshots;
+		Streams.ForEach([&Snapshots](FRealtimeMeshStream& Stream)
+		{
+			Stream.ClearDirtyRange();
+			Snapshots.Add(Stream.GetStreamKey(), FStreamSnapshot { Stream.Num(), Stream.GetLayout() });
+		});
+
+		// A stream whose storage is still shared with an upload the render thread hasn't read yet would copy the whole stream
+		// on the first write to detach from it. Write the rows in place instead, the upload then carries the edited rows, and the
+		// range update below writes the same rows again. The render thread is kept out of the upload until the edits are done.
+		TArray<TSharedPtr<FRealtimeMeshSectionGroupStreamUpdateData>, TInlineAllocator<4>> LockedUploads;
+		Streams.ForEach([&](FRealtimeMeshStream& Stream)
+		{
+			const TSharedPtr<FRealtimeMeshSectionGroupStreamUpdateData> PendingUpload = PendingProxyUploads.FindRef(Stream.GetStreamKey()).Pin();
+			if (PendingUpload.IsValid() && Stream.IsSharedStorageOnlySharedWith(PendingUpload->GetStream()) && PendingUpload->GetStreamDataLock().TryLock())
+			{
+				Stream.SetWritesSharedStorage(true);
+				LockedUploads.Add(PendingUpload);
+			}
+		});
+		
+		auto UpdatedStreams = EditFunc(Streams);
+
+		Streams.ForEach([](FRealtimeMeshStream& Stream)
+		{
+			Stream.SetWritesSharedStorage(false);
+		});
+		for (const TSharedPtr<FRealtimeMeshSectionGroupStreamUpdateData>& LockedUpload : LockedUploads)
+		{
+			LockedUpload->GetStreamDataLock().Unlock();
+		}
+
+		// Go through our own stream updates so polygroup sections follow the edits, but only repack the interleaved buffer once below
+		Simple::Private::bShouldDeferInterleavedUpdates = true;
+		for (const auto& UpdatedStream : UpdatedStreams)
+		{
+			if (auto* Stream = Streams.Find(UpdatedStream))
+			{
+				const FStreamSnapshot* Snapshot = Snapshots.Find(UpdatedStream);
+				const bool bCanUpdateRange = Snapshot && Snapshot->Num == Stream->Num() && Snapshot->Layout == Stream->GetLayout() && Stream->HasDirtyRange();
+				
+				if (bCanUpdateRange)
+				{
+					const TRange<int32> DirtyRange = Stream->GetDirtyRange();
+					const int32 StartIndex = DirtyRange.GetLowerBoundValue();
+					const int32 Count = DirtyRange.Size<int32>();
+
+					FRealtimeMeshStream RangeData(UpdatedStream, Stream->GetLayout());
+					RangeData.SetNumUninitialized(Count);
+					RangeData.SetRange(0, Stream->GetLayout(), AsConst(*Stream).GetDataRawAtVertex(StartIndex), Count);
+					
+					UpdateStreamRange(UpdateContext, MoveTemp(RangeData), StartIndex);
+				}
+				else
+				{
+					Simple::Private::PrepareStreamForCopy(*Stream);
+					CreateOrUpdateStream(UpdateContext, FRealtimeMeshStream(*Stream));
+				}
+				
+				Stream->ClearDirtyRange();
+			}
+			else
+			{				
+				FMessageLog("RealtimeMesh").Error(
+					FText::Format(LOCTEXT("EditMeshData_InvalidStream", "Unable to update stream {0} in mesh {1}"),
+								  FText::FromString(UpdatedStream.ToString()), FText::FromName(SharedResources->GetMeshName())));
+			}
+		}
+		Simple::Private::bShouldDeferInterleavedUpdates = false;
+
+		// Repack once for all the edited streams, only the rows they touched unless one of them was sent whole
+		UpdateInterleavedStreamRows(UpdateContext);
+	}
+
+	void FRealtimeMeshSectionGroupSimple::UpdateConfig(FRealtimeMeshUpdateContext& UpdateContext, TFunction<void(FRealtimeMeshSectionGroupConfig&)> EditFunc)
+	{
+		const FRealtimeMeshPositionQuantization OldQuantization = Config.PositionQuantization;
+		const bool bWasInterleaved = Config.bInterleaveVertexStreams;
+		FRealtimeMeshSectionGroup::UpdateConfig(UpdateContext, EditFunc);
+
+		// Switch the vertex streams between their own buffers and the packed buffer
+		if (bWasInterleaved != Config.bInterleaveVertexStreams)
+		{
+			for (const FRealtimeMeshStreamKey& StreamKey : FRealtimeMeshInterleavedLayout::GetInterleavableStreams())
+			{
+				if (FRealtimeMeshStream* Stream = Streams.Find(StreamKey))
+				{
+					if (Config.bInterleaveVertexStreams)
+					{
+						RemoveStreamFromProxy(UpdateContext, StreamKey);
+					}
+					else
+					{
+						Simple::Private::PrepareStreamForCopy(*Stream);
+						FRealtimeMeshSectionGroup::CreateOrUpdateStream(UpdateContext, FRealtimeMeshStream(*Stream));
+					}
+				}
+			}
+
+			if (Config.bInterleaveVertexStreams)
+			{
+				UpdateInterleavedStream(UpdateContext);
+			}
+			else
+			{
+				RemoveStreamFromProxy(UpdateContext, FRealtimeMeshStreams::Interleaved);
+			}
+			return;
+		}
+
+		// Quantized positions are decoded on upload, so the GPU copy is stale once the quantization changes
+		FRealtimeMeshStream* Stream = Streams.Find(FRealtimeMeshStreams::Position);
+		if (Stream && Stream->Num() > 0 && OldQuantization != Config.PositionQuantization &&
+			Stream->GetLayout() == GetRealtimeMeshBufferLayout<FRealtimeMeshQuantizedPosition>())
+		{
+			Simple::Private::PrepareStreamForCopy(*Stream);
+			FRealtimeMeshSectionGroup::CreateOrUpdateStream(UpdateContext, FRealtimeMeshStream(*Stream));
+			MarkInterleavedStreamDirty(UpdateContext, FRealtimeMeshStreams::Position);
+		}
 	}
 
 	void FRealtimeMeshSectionGroupSimple::CreateOrUpdateStream(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& Stream)
 	{
-		// Replace the stored stream (We allow this to copy as we then pass the stream to the RT command queue)
+		// Replace the stored stream. The stored copy shares its storage with the one we then pass to the RT command queue
+		Simple::Private::PrepareStreamForCopy(Stream);
 		Streams.AddStream(Stream);
 		
 		// If this stream is a segments stream or polygon group stream lets update the sections
@@ -204,7 +474,45 @@ namespace RealtimeMesh
 			}
 		}
 		
+		const FRealtimeMeshStreamKey StreamKey = Stream.GetStreamKey();
 		FRealtimeMeshSectionGroup::CreateOrUpdateStream(UpdateContext, MoveTemp(Stream));
+		MarkInterleavedStreamDirty(UpdateContext, StreamKey);
+	}
+
+	void FRealtimeMeshSectionGroupSimple::UpdateStreamRange(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& RangeData, int32 DestinationIndex)
+	{
+		const FRealtimeMeshStreamKey StreamKey = RangeData.GetStreamKey();
+		FRealtimeMeshStream* Stream = Streams.Find(StreamKey);
+
+		if (Stream == nullptr || DestinationIndex < 0 || DestinationIndex + RangeData.Num() > Stream->Num() ||
+			(RangeData.GetLayout() != Stream->GetLayout() && !RangeData.ConvertTo(Stream->GetLayout())))
+		{
+			FMessageLog("RealtimeMesh").Error(
+				FText::Format(LOCTEXT("UpdateStreamRange_InvalidRange", "Unable to update range [{0}, {1}) of stream {2} in mesh {3}"),
+							  FText::AsNumber(DestinationIndex), FText::AsNumber(DestinationIndex + RangeData.Num()),
+							  FText::FromString(StreamKey.ToString()), FText::FromName(SharedResources->GetMeshName())));
+			return;
+		}
+
+		if (RangeData.Num() == 0)
+		{
+			return;
+		}
+
+		Stream->SetRange(DestinationIndex, RangeData.GetLayout(), AsConst(RangeData).GetData(), RangeData.Num());
+		Stream->ClearDirtyRange();
+
+		// Polygroup changes can move section boundaries, so those still need the full path to rebuild the sections
+		if (bAutoCreateSectionsForPolygonGroups && (StreamKey == FRealtimeMeshStreams::PolyGroups || StreamKey == FRealtimeMeshStreams::DepthOnlyPolyGroups))
+		{
+			Simple::Private::PrepareStreamForCopy(*Stream);
+			CreateOrUpdateStream(UpdateContext, FRealtimeMeshStream(*Stream));
+			return;
+		}
+
+		const FInt32Range Rows(DestinationIndex, DestinationIndex + RangeData.Num());
+		FRealtimeMeshSectionGroup::UpdateStreamRange(UpdateContext, MoveTemp(RangeData), DestinationIndex);
+		MarkInterleavedRowsDirty(UpdateContext, StreamKey, Rows);
 	}
 
 	void FRealtimeMeshSectionGroupSimple::RemoveStream(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey)
@@ -218,6 +526,7 @@ namespace RealtimeMesh
 		}
 
 		FRealtimeMeshSectionGroup::RemoveStream(UpdateContext, StreamKey);
+		MarkInterleavedStreamDirty(UpdateContext, StreamKey);
 	}
 
 	void FRealtimeMeshSectionGroupSimple::SetAllStreams(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStreamSet&& InStreams)
@@ -243,8 +552,12 @@ namespace RealtimeMesh
 		// Block auto update of material indices until all streams are set		
 		// Defer updates for bulk changes like this
 		Simple::Private::bShouldDeferPolyGroupUpdates = true;
+		Simple::Private::bShouldDeferInterleavedUpdates = true;
 		FRealtimeMeshSectionGroup::SetAllStreams(UpdateContext, MoveTemp(InStreams));
 		Simple::Private::bShouldDeferPolyGroupUpdates = false;
+		Simple::Private::bShouldDeferInterleavedUpdates = false;
+
+		UpdateInterleavedStream(UpdateContext);
 		
 		if (bWantsPolyGroupUpdate)
 		{
@@ -259,23 +572,23 @@ namespace RealtimeMesh
 	void FRealtimeMeshSectionGroupSimple::InitializeProxy(FRealtimeMeshUpdateContext& UpdateContext)
 	{
 		// We only send streams here, we rely on the base to send the sections
-		Streams.ForEach([&](const FRealtimeMeshStream& Stream)
+		Streams.ForEach([&](FRealtimeMeshStream& Stream)
 		{
-			if (SharedResources->WantsStreamOnGPU(Stream.GetStreamKey()) && Stream.Num() > 0)
+			if (ShouldSendStreamToProxy(Stream.GetStreamKey()) && Stream.Num() > 0)
 			{
-				if (auto ProxyBuilder = UpdateContext.GetProxyBuilder())
+				if (UpdateContext.GetProxyBuilder())
 				{
+					Simple::Private::PrepareStreamForCopy(Stream);
 					FRealtimeMeshStream Copy(Stream);
+					DecodeStreamForProxy(Copy);
 					const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(Copy), EBufferUsageFlags::Static);
-					UpdateData->CreateBufferAsyncIfPossible(UpdateContext);
+					UpdateProxyStreamShape(*UpdateData);
 
-					ProxyBuilder->AddSectionGroupTask(Key, [UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
-					{
-						Proxy.CreateOrUpdateStream(RHICmdList, UpdateData);
-					}, ShouldRecreateProxyOnChange(UpdateContext));
+					SendStreamToProxy(UpdateContext, UpdateData, false);
 				}
 			}
 		});
+		UpdateInterleavedStream(UpdateContext);
 
 		FRealtimeMeshSectionGroup::InitializeProxy(UpdateContext);
 	}
@@ -283,6 +596,15 @@ namespace RealtimeMesh
 	void FRealtimeMeshSectionGroupSimple::Reset(FRealtimeMeshUpdateContext& UpdateContext)
 	{
 		Streams.Empty();
+		CollisionStreams.Empty();
+		{
+			FScopeLock Lock(&CollisionCacheLock);
+			CachedCollisionCook.Reset();
+			bHasCachedCollision = false;
+			CachedCollisionChunks.Empty();
+			bHasCachedCollisionChunks = false;
+		}
+		InterleavedDirtyRows = FInt32Range::Empty();
 		FRealtimeMeshSectionGroup::Reset(UpdateContext);
 	}
 
@@ -293,6 +615,11 @@ namespace RealtimeMesh
 		if (ensure(bResult))
 		{
 			Ar << Streams;
+
+			if (Ar.CustomVer(FRealtimeMeshVersion::GUID) >= FRealtimeMeshVersion::CollisionSourceSelection)
+			{
+				Ar << CollisionStreams;
+			}
 		}
 
 		return bResult;
@@ -300,6 +627,30 @@ namespace RealtimeMesh
 
 	bool FRealtimeMeshSectionGroupSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshCollisionMesh& CollisionMesh) const
 	{
+		if (HasCollisionStreams(LockContext))
+		{
+			const int32 FirstTriangle = CollisionMesh.GetTriangles().Num();
+			if (!URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(CollisionMesh, CollisionStreams, 0))
+			{
+				return false;
+			}
+
+			// Polygroups take the place of the material slots of the render sections
+			if (const FRealtimeMeshStream* PolyGroupStream = CollisionStreams.Find(FRealtimeMeshStreams::PolyGroups))
+			{
+				TArray<uint16> PolyGroups;
+				PolyGroupStream->CopyTo(PolyGroups);
+
+				TArray<uint16> Materials = CollisionMesh.GetMaterials();
+				for (int32 Index = FirstTriangle; Index < Materials.Num() && Index - FirstTriangle < PolyGroups.Num(); Index++)
+				{
+					Materials[Index] = PolyGroups[Index - FirstTriangle];
+				}
+				CollisionMesh.SetMaterials(MoveTemp(Materials));
+			}
+			return true;
+		}
+		
 		bool bHasMeshData = false;
 		for (const FRealtimeMeshSectionRef& Section : Sections)
 		{
@@ -316,6 +667,426 @@ namespace RealtimeMesh
 		return bHasMeshData;
 	}
 
+	bool FRealtimeMeshSectionGroupSimple::GetCookedComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshCollisionMesh& OutCollisionMesh,
+		const FRealtimeMeshCollisionCookToken& CookToken) const
+	{
+		const bool bUseCache = CVarRealtimeMeshSimpleCacheSectionGroupCooks.GetValueOnAnyThread() != 0;
+		const uint64 CollisionHash = bUseCache ? GetComplexCollisionHash(LockContext) : 0;
+
+		FScopeLock Lock(&CollisionCacheLock);
+		
+		if (bUseCache && bHasCachedCollision && CachedCollisionHash == CollisionHash && CachedCollisionCook.IsValid() && CachedCollisionCook->HasMesh())
+		{
+			INC_DWORD_STAT(STAT_RealtimeMeshSimple_CollisionSectionGroupCacheHits);
+			OutCollisionMesh = FRealtimeMeshCollisionMesh();
+			OutCollisionMesh.SetCooked(CachedCollisionCook);
+			return true;
+		}
+
+		CachedCollisionCook.Reset();
+		bHasCachedCollision = false;
+
+		const FRealtimeMeshCollisionConfiguration OwnerCollisionConfig = Simple::Private::GetOwnerCollisionConfig(SharedResources, LockContext);
+		
+		FRealtimeMeshCollisionMesh NewMesh;
+		NewMesh.SetCleanSettings(OwnerCollisionConfig.bCleanComplexMesh, OwnerCollisionConfig.ComplexMeshWeldTolerance);
+		const bool bCookedFromStreams = CookComplexCollisionFromStreams(LockContext, NewMesh);
+		if (!bCookedFromStreams && !GenerateComplexCollision(LockContext, NewMesh))
+		{
+			return false;
+		}
+
+		// A newer collision update superseded this one, it will cook the group itself
+		if (!bCookedFromStreams && CookToken.IsCancelled())
+		{
+			return false;
+		}
+
+		INC_DWORD_STAT(STAT_RealtimeMeshSimple_CollisionSectionGroupCooks);
+		if (!bCookedFromStreams)
+		{
+			URealtimeMeshCollisionTools::CookComplexMesh(NewMesh);
+		}
+
+		if (bUseCache)
+		{
+			CachedCollisionCook = NewMesh.GetCooked();
+			CachedCollisionHash = CollisionHash;
+			bHasCachedCollision = true;
+		}
+		
+		OutCollisionMesh = MoveTemp(NewMesh);
+		return true;
+	}
+
+	bool FRealtimeMeshSectionGroupSimple::GetCookedComplexCollisionChunks(const FRealtimeMeshLockContext& LockContext, float ChunkSize, TArray<FRealtimeMeshCollisionMesh>& OutCollisionMeshes,
+		const FRealtimeMeshCollisionCookToken& CookToken) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupSimple::GetCookedComplexCollisionChunks);
+		check(ChunkSize > 0.0f);
+		
+		const bool bUseCache = CVarRealtimeMeshSimpleCacheSectionGroupCooks.GetValueOnAnyThread() != 0;
+		const uint64 CollisionHash = bUseCache ? GetComplexCollisionHash(LockContext) : 0;
+
+		FScopeLock Lock(&CollisionCacheLock);
+
+		if (bUseCache && bHasCachedCollisionChunks && CachedCollisionChunksHash == CollisionHash)
+		{
+			INC_DWORD_STAT(STAT_RealtimeMeshSimple_CollisionSectionGroupCacheHits);
+			for (const auto& Chunk : CachedCollisionChunks)
+			{
+				OutCollisionMeshes.AddDefaulted_GetRef().SetCooked(Chunk.Value.Cook);
+			}
+			return CachedCollisionChunks.Num() > 0;
+		}
+
+		bHasCachedCollisionChunks = false;
+
+		const FRealtimeMeshCollisionConfiguration OwnerCollisionConfig = Simple::Private::GetOwnerCollisionConfig(SharedResources, LockContext);
+		
+		FRealtimeMeshCollisionMesh SourceMesh;
+		SourceMesh.SetCleanSettings(OwnerCollisionConfig.bCleanComplexMesh, OwnerCollisionConfig.ComplexMeshWeldTolerance);
+		if (!GenerateComplexCollision(LockContext, SourceMesh))
+		{
+			CachedCollisionChunks.Empty();
+			return false;
+		}
+
+		// Bin the triangles by the cell their centroid falls in
+		const TArray<FVector3f>& Vertices = SourceMesh.GetVertices();
+		const TArray<TIndex3<int32>>& Triangles = SourceMesh.GetTriangles();
+		TMap<FIntVector, TArray<int32>> CellTriangles;
+		for (int32 TriangleIndex = 0; TriangleIndex < Triangles.Num(); TriangleIndex++)
+		{
+			const TIndex3<int32>& Triangle = Triangles[TriangleIndex];
+			const FVector3f Centroid = (Vertices[Triangle.V0] + Vertices[Triangle.V1] + Vertices[Triangle.V2]) / (3.0f * ChunkSize);
+			CellTriangles.FindOrAdd(FIntVector(FMath::FloorToInt32(Centroid.X), FMath::FloorToInt32(Centroid.Y), FMath::FloorToInt32(Centroid.Z))).Add(TriangleIndex);
+		}
+
+		// Sorted so the element index of each cell is stable between cooks
+		TArray<FIntVector> Cells;
+		CellTriangles.GenerateKeyArray(Cells);
+		Cells.Sort([](const FIntVector& A, const FIntVector& B)
+		{
+			return A.Z != B.Z ? A.Z < B.Z : (A.Y != B.Y ? A.Y < B.Y : A.X < B.X);
+		});
+
+		// Cells whose content hash still matches keep their cooked mesh, the rest are cooked in parallel
+		TArray<FRealtimeMeshCollisionMesh> CellMeshes;
+		CellMeshes.SetNum(Cells.Num());
+		TArray<uint64> CellHashes;
+		CellHashes.SetNumZeroed(Cells.Num());
+		ParallelFor(Cells.Num(), [&](int32 Index)
+		{
+			if (CookToken.IsCancelled())
+			{
+				return;
+			}
+
+			Simple::Private::BuildCollisionChunk(SourceMesh, CellTriangles.FindChecked(Cells[Index]), CellMeshes[Index]);
+			CellHashes[Index] = URealtimeMeshCollisionTools::GetComplexMeshCookHash(CellMeshes[Index]);
+
+			const FCachedCollisionChunk* CachedChunk = bUseCache ? CachedCollisionChunks.Find(Cells[Index]) : nullptr;
+			if (CachedChunk && CachedChunk->Hash == CellHashes[Index] && CachedChunk->Cook.IsValid() && CachedChunk->Cook->HasMesh())
+			{
+				CellMeshes[Index].SetCooked(CachedChunk->Cook);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_RealtimeMeshSimple_CollisionChunkCooks);
+				URealtimeMeshCollisionTools::CookComplexMesh(CellMeshes[Index]);
+			}
+		});
+
+		// Some cells may not have been cooked, so keep the cache as it was for the update that superseded this one
+		if (CookToken.IsCancelled())
+		{
+			return false;
+		}
+
+		// Cells that no longer have any triangles are dropped from the cache here
+		CachedCollisionChunks.Reset();
+		for (int32 Index = 0; Index < Cells.Num(); Index++)
+		{
+			if (bUseCache)
+			{
+				CachedCollisionChunks.Add(Cells[Index], FCachedCollisionChunk{ CellHashes[Index], CellMeshes[Index].GetCooked() });
+			}
+			OutCollisionMeshes.Add(MoveTemp(CellMeshes[Index]));
+		}
+		
+		INC_DWORD_STAT(STAT_RealtimeMeshSimple_CollisionSectionGroupCooks);
+		CachedCollisionChunksHash = CollisionHash;
+		bHasCachedCollisionChunks = bUseCache;
+		return Cells.Num() > 0;
+	}
+
+	bool FRealtimeMeshSectionGroupSimple::CookComplexCollisionFromStreams(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshCollisionMesh& OutCollisionMesh) const
+	{
+		if (CVarRealtimeMeshCollisionCookFromStreams.GetValueOnAnyThread() == 0)
+		{
+			return false;
+		}
+
+		if (HasCollisionStreams(LockContext))
+		{
+			return URealtimeMeshCollisionTools::CookComplexMeshFromStreams(OutCollisionMesh, CollisionStreams, 0, true);
+		}
+
+		const FRealtimeMeshStream* TriangleStream = Streams.Find(FRealtimeMeshStreams::Triangles);
+		if (!TriangleStream)
+		{
+			return false;
+		}
+
+		// Multiple collision sections, or one that only covers part of the streams, need the collision mesh to pick out their triangles
+		TSharedPtr<FRealtimeMeshSectionSimple> CollisionSection;
+		for (const FRealtimeMeshSectionRef& Section : Sections)
+		{
+			const auto SimpleSection = StaticCastSharedRef<FRealtimeMeshSectionSimple>(Section);
+			if (SimpleSection->HasCollision(LockContext))
+			{
+				if (CollisionSection.IsValid())
+				{
+					return false;
+				}
+				CollisionSection = SimpleSection;
+			}
+		}
+
+		if (!CollisionSection.IsValid())
+		{
+			return false;
+		}
+
+		const int32 NumTriangles = (TriangleStream->Num() * TriangleStream->GetNumElements()) / REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE;
+		const FRealtimeMeshStreamRange StreamRange = CollisionSection->GetStreamRange(LockContext);
+		if (StreamRange.GetMinIndex() != 0 || StreamRange.NumPrimitives(REALTIME_MESH_NUM_INDICES_PER_PRIMITIVE) != NumTriangles)
+		{
+			return false;
+		}
+
+		return URealtimeMeshCollisionTools::CookComplexMeshFromStreams(OutCollisionMesh, Streams, CollisionSection->GetConfig(LockContext).MaterialSlot);
+	}
+
+	uint64 FRealtimeMeshSectionGroupSimple::GetComplexCollisionHash(const FRealtimeMeshLockContext& LockContext) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupSimple::GetComplexCollisionHash);
+		
+		FXxHash64Builder Hasher;
+		const auto HashValue = [&Hasher](const auto& Value)
+		{
+			Hasher.Update(&Value, sizeof(Value));
+		};
+		
+		const auto HashStream = [&](const FRealtimeMeshStreamSet& SourceStreams, const FRealtimeMeshStreamKey& StreamKey)
+		{
+			if (const FRealtimeMeshStream* Stream = SourceStreams.Find(StreamKey))
+			{
+				HashValue(GetTypeHash(Stream->GetLayout()));
+				HashValue(Stream->Num());
+				Hasher.Update(Stream->GetData(), Stream->GetResourceDataSize());
+			}
+			else
+			{
+				HashValue(INDEX_NONE);
+			}
+		};
+
+		// Cleaning changes the cooked result without changing the streams
+		const FRealtimeMeshCollisionConfiguration OwnerCollisionConfig = Simple::Private::GetOwnerCollisionConfig(SharedResources, LockContext);
+		HashValue(OwnerCollisionConfig.bCleanComplexMesh);
+		HashValue(OwnerCollisionConfig.bCleanComplexMesh ? OwnerCollisionConfig.ComplexMeshWeldTolerance : 0.0f);
+		HashValue(OwnerCollisionConfig.ComplexCollisionChunkSize);
+
+		const bool bUseCollisionStreams = HasCollisionStreams(LockContext);
+		const FRealtimeMeshStreamSet& SourceStreams = bUseCollisionStreams ? CollisionStreams : Streams;
+		HashValue(bUseCollisionStreams);
+
+		HashStream(SourceStreams, FRealtimeMeshStreams::Position);
+		HashStream(SourceStreams, FRealtimeMeshStreams::Triangles);
+		HashStream(SourceStreams, FRealtimeMeshStreams::PolyGroups);
+
+		// UVs are only kept in the collision mesh when they can be looked up from hit results
+		const bool bSupportsUVs = UPhysicsSettings::Get()->bSupportUVFromHitResults;
+		HashValue(bSupportsUVs);
+		if (bSupportsUVs)
+		{
+			HashStream(SourceStreams, FRealtimeMeshStreams::TexCoords);
+		}
+
+		// Collision streams don't depend on the sections
+		if (bUseCollisionStreams)
+		{
+			return Hasher.Finalize().Hash;
+		}
+
+		for (const FRealtimeMeshSectionRef& Section : Sections)
+		{
+			const auto SimpleSection = StaticCastSharedRef<FRealtimeMeshSectionSimple>(Section);
+			if (SimpleSection->HasCollision(LockContext))
+			{
+				const FRealtimeMeshStreamRange StreamRange = SimpleSection->GetStreamRange(LockContext);
+				HashValue(SimpleSection->GetConfig(LockContext).MaterialSlot);
+				HashValue(StreamRange.GetMinIndex());
+				HashValue(StreamRange.GetMaxIndex());
+			}
+		}
+
+		return Hasher.Finalize().Hash;
+	}
+
+	bool FRealtimeMeshSectionGroupSimple::ShouldSendStreamToProxy(const FRealtimeMeshStreamKey& StreamKey) const
+	{
+		// Interleaved vertex streams only reach the GPU packed together
+		if (Config.bInterleaveVertexStreams && FRealtimeMeshInterleavedLayout::CanInterleaveStream(StreamKey))
+		{
+			return false;
+		}
+		return FRealtimeMeshSectionGroup::ShouldSendStreamToProxy(StreamKey);
+	}
+
+	void FRealtimeMeshSectionGroupSimple::MarkInterleavedStreamDirty(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey)
+	{
+		MarkInterleavedRowsDirty(UpdateContext, StreamKey, FInt32Range::All());
+	}
+
+	void FRealtimeMeshSectionGroupSimple::MarkInterleavedRowsDirty(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey, const FInt32Range& Rows)
+	{
+		if (!Config.bInterleaveVertexStreams || !FRealtimeMeshInterleavedLayout::CanInterleaveStream(StreamKey) || Rows.IsEmpty())
+		{
+			return;
+		}
+
+		// A single color is repeated into every packed row
+		const FRealtimeMeshStream* Stream = Streams.Find(StreamKey);
+		const bool bRepeatsFirstRow = StreamKey == FRealtimeMeshStreams::Color && Stream && Stream->Num() == 1;
+
+		if (bRepeatsFirstRow)
+		{
+			InterleavedDirtyRows = FInt32Range::All();
+		}
+		else
+		{
+			InterleavedDirtyRows = InterleavedDirtyRows.IsEmpty() ? Rows : FInt32Range::Hull(InterleavedDirtyRows, Rows);
+		}
+
+		if (!Simple::Private::bShouldDeferInterleavedUpdates)
+		{
+			UpdateInterleavedStreamRows(UpdateContext);
+		}
+	}
+
+	FRealtimeMeshStreamSet FRealtimeMeshSectionGroupSimple::GetInterleavedSourceStreams()
+	{
+		// Pack from copies in a format the GPU can read, sharing storage with the stored streams where nothing needs decoding
+		FRealtimeMeshStreamSet SourceStreams;
+		for (const FRealtimeMeshStreamKey& StreamKey : FRealtimeMeshInterleavedLayout::GetInterleavableStreams())
+		{
+			if (FRealtimeMeshStream* Stream = Streams.Find(StreamKey))
+			{
+				Simple::Private::PrepareStreamForCopy(*Stream);
+				FRealtimeMeshStream Copy(*Stream);
+				DecodeStreamForProxy(Copy);
+				SourceStreams.AddStream(MoveTemp(Copy));
+			}
+		}
+		return SourceStreams;
+	}
+
+	void FRealtimeMeshSectionGroupSimple::UpdateInterleavedStream(FRealtimeMeshUpdateContext& UpdateContext)
+	{
+		InterleavedDirtyRows = FInt32Range::Empty();
+
+		if (!Config.bInterleaveVertexStreams)
+		{
+			return;
+		}
+
+		auto ProxyBuilder = UpdateContext.GetProxyBuilder();
+		if (!ProxyBuilder || !SharedResources->WantsStreamOnGPU(FRealtimeMeshStreams::Interleaved))
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupSimple::UpdateInterleavedStream);
+
+		const FRealtimeMeshStreamSet SourceStreams = GetInterleavedSourceStreams();
+		const FRealtimeMeshInterleavedLayout Layout = FRealtimeMeshInterleavedLayout::Create(SourceStreams);
+		FRealtimeMeshStream PackedStream;
+		if (!Layout.Pack(SourceStreams, PackedStream))
+		{
+			// Nothing to draw yet, drop any stale packed buffer
+			RemoveStreamFromProxy(UpdateContext, FRealtimeMeshStreams::Interleaved);
+			return;
+		}
+
+		const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(PackedStream), EBufferUsageFlags::Static);
+		UpdateData->SetInterleavedLayout(Layout);
+
+		SendStreamToProxy(UpdateContext, UpdateData, UpdateProxyStreamShape(*UpdateData));
+	}
+
+	void FRealtimeMeshSectionGroupSimple::UpdateInterleavedStreamRows(FRealtimeMeshUpdateContext& UpdateContext)
+	{
+		const FInt32Range DirtyRows = InterleavedDirtyRows;
+		if (DirtyRows.IsEmpty())
+		{
+			return;
+		}
+
+		if (!DirtyRows.HasLowerBound() || !DirtyRows.HasUpperBound())
+		{
+			UpdateInterleavedStream(UpdateContext);
+			return;
+		}
+
+		InterleavedDirtyRows = FInt32Range::Empty();
+
+		auto ProxyBuilder = UpdateContext.GetProxyBuilder();
+		if (!Config.bInterleaveVertexStreams || !ProxyBuilder || !SharedResources->WantsStreamOnGPU(FRealtimeMeshStreams::Interleaved))
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupSimple::UpdateInterleavedStreamRows);
+
+		const FRealtimeMeshStreamSet SourceStreams = GetInterleavedSourceStreams();
+		const FRealtimeMeshInterleavedLayout Layout = FRealtimeMeshInterleavedLayout::Create(SourceStreams);
+
+		// Rows can only be written over a buffer the proxy already holds packed the same way
+		const FRealtimeMeshProxyStreamShape* ProxyShape = ProxyStreamShapes.Find(FRealtimeMeshStreams::Interleaved);
+		if (ProxyShape == nullptr || ProxyShape->InterleavedLayout != Layout)
+		{
+			UpdateInterleavedStream(UpdateContext);
+			return;
+		}
+
+		const int32 StartIndex = FMath::Max(DirtyRows.GetLowerBoundValue(), 0);
+		const int32 EndIndex = FMath::Min(DirtyRows.GetUpperBoundValue(), Layout.GetNumVertices());
+		if (EndIndex <= StartIndex)
+		{
+			// Only rows past what gets packed changed
+			return;
+		}
+
+		FRealtimeMeshStream PackedRows;
+		if (!Layout.PackRange(SourceStreams, StartIndex, EndIndex - StartIndex, PackedRows))
+		{
+			UpdateInterleavedStream(UpdateContext);
+			return;
+		}
+
+		const auto UpdateData = MakeShared<FRealtimeMeshSectionGroupStreamUpdateData>(MoveTemp(PackedRows), StartIndex);
+		UpdateData->SetInterleavedLayout(Layout);
+
+		ProxyBuilder->AddSectionGroupStreamTask(Key, FRealtimeMeshStreams::Interleaved, UpdateData->GetStream().GetResourceDataSize(),
+			[UpdateData = UpdateData](FRHICommandListBase& RHICmdList, FRealtimeMeshSectionGroupProxy& Proxy)
+		{
+			Proxy.UpdateStreamRange(RHICmdList, UpdateData);
+		}, false, false);
+	}
+
 	void FRealtimeMeshSectionGroupSimple::UpdatePolyGroupSections(FRealtimeMeshUpdateContext& UpdateContext, bool bUpdateDepthOnly)
 	{
 		if (ShouldCreateSingularSection())
@@ -386,16 +1157,49 @@ namespace RealtimeMesh
 			(Sections.Num() == 0 || (Sections.Num() == 1 && Sections.Contains(FRealtimeMeshSectionKey::CreateForPolyGroup(Key, 0))));
 	}
 
-	bool FRealtimeMeshLODSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry) const
+	bool FRealtimeMeshLODSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry,
+		const FRealtimeMeshCollisionCookToken& CookToken) const
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshLODSimple::GenerateComplexCollision);
+		
+		// Each group is cooked on its own, and only when its collision content changed, so they can be gathered in parallel
+		const TArray<FRealtimeMeshSectionGroupRef> Groups = SectionGroups.Array();
+		TArray<TArray<FRealtimeMeshCollisionMesh>> GroupMeshes;
+		GroupMeshes.SetNum(Groups.Num());
+		TArray<bool> GroupHasData;
+		GroupHasData.SetNumZeroed(Groups.Num());
+
+		// When chunked every grid cell becomes its own mesh, and so its own shape in the body, so edits only re-cook the cells they touch
+		const float ChunkSize = Simple::Private::GetOwnerCollisionConfig(SharedResources, LockContext).ComplexCollisionChunkSize;
+
+		ParallelFor(Groups.Num(), [&](int32 Index)
+		{
+			// Groups left once a newer update superseded this one aren't worth cooking
+			if (CookToken.IsCancelled())
+			{
+				return;
+			}
+
+			const auto Group = StaticCastSharedRef<FRealtimeMeshSectionGroupSimple>(Groups[Index]);
+			if (ChunkSize > 0.0f)
+			{
+				GroupHasData[Index] = Group->GetCookedComplexCollisionChunks(LockContext, ChunkSize, GroupMeshes[Index], CookToken);
+			}
+			else
+			{
+				GroupHasData[Index] = Group->GetCookedComplexCollision(LockContext, GroupMeshes[Index].AddDefaulted_GetRef(), CookToken);
+			}
+		});
+		
 		bool bHasSectionData = false;
-		for (const auto& SectionGroup : SectionGroups)
+		for (int32 Index = 0; Index < Groups.Num(); Index++)
 		{
-			FRealtimeMeshCollisionMesh NewMesh;
-			const bool bHadData = StaticCastSharedRef<FRealtimeMeshSectionGroupSimple>(SectionGroup)->GenerateComplexCollision(LockContext, NewMesh);
-			if (bHadData)
+			if (GroupHasData[Index])
 			{
-				ComplexGeometry.Add(MoveTemp(NewMesh));
+				for (FRealtimeMeshCollisionMesh& GroupMesh : GroupMeshes[Index])
+				{
+					ComplexGeometry.Add(MoveTemp(GroupMesh));
+				}
 				bHasSectionData = true;
 			}
 		}
@@ -610,15 +1414,29 @@ namespace RealtimeMesh
 		FRealtimeMesh::ClearCardRepresentation(UpdateContext);
 	}
 
-	bool FRealtimeMeshSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& OutComplexGeometry) const
+	bool FRealtimeMeshSimple::GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& OutComplexGeometry,
+		const FRealtimeMeshCollisionCookToken& CookToken) const
 	{
 		// Copy any custom complex geometry
 		OutComplexGeometry = ComplexGeometry;
+
+		// Custom meshes follow the mesh wide clean settings unless they already ask to be cleaned themselves
+		if (CollisionConfig.bCleanComplexMesh)
+		{
+			for (const int32 MeshID : OutComplexGeometry.GetMeshIDsNeedingCook())
+			{
+				FRealtimeMeshCollisionMesh& CollisionMesh = OutComplexGeometry.GetByIndex(MeshID);
+				if (!CollisionMesh.ShouldCleanMesh())
+				{
+					CollisionMesh.SetCleanSettings(true, CollisionConfig.ComplexMeshWeldTolerance);
+				}
+			}
+		}
 		
-		// TODO: Allow other LOD to be used for collision?
-		if (LODs.IsValidIndex(0))
+		if (LODs.Num() > 0)
 		{
-			return StaticCastSharedRef<FRealtimeMeshLODSimple>(LODs[0])->GenerateComplexCollision(LockContext, OutComplexGeometry);
+			const int32 CollisionLODIndex = FMath::Clamp(CollisionConfig.ComplexCollisionLOD, 0, LODs.Num() - 1);
+			return StaticCastSharedRef<FRealtimeMeshLODSimple>(LODs[CollisionLODIndex])->GenerateComplexCollision(LockContext, OutComplexGeometry, CookToken);
 		}
 		return false;
 	}
@@ -657,8 +1475,30 @@ namespace RealtimeMesh
 		}
 	}
 
+	FRealtimeMeshSimple::~FRealtimeMeshSimple()
+	{
+		// The scheduler keys cooks by our address, don't leave one behind for whatever gets allocated here next
+		CancelCollisionCooks();
+
+		if (PendingCollisionPromise)
+		{
+			PendingCollisionPromise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+		}
+	}
+
+	void FRealtimeMeshSimple::CancelCollisionCooks() const
+	{
+		if (FRealtimeMeshCollisionCookScheduler* CookScheduler = FRealtimeMeshCollisionCookScheduler::TryGet())
+		{
+			CookScheduler->Cancel(this);
+		}
+	}
+
 	void FRealtimeMeshSimple::Reset(FRealtimeMeshUpdateContext& UpdateContext, bool bRemoveRenderProxy)
 	{
+		// Cooks of the old geometry would only be applied over the reset collision. Done before taking the guard as waiters are resolved inline
+		CancelCollisionCooks();
+
 		FRealtimeMeshScopeGuardWrite ScopeGuard(SharedResources->GetGuard());
 		CollisionConfig = FRealtimeMeshCollisionConfiguration();
 		SimpleGeometry = FRealtimeMeshSimpleGeometry();
@@ -823,7 +1663,6 @@ namespace RealtimeMesh
 			const int32 UpdateKey = GetNextCollisionUpdateVersion();
 			
 			const bool bAsyncCook = CollisionConfig.bUseAsyncCook;
-			const ERealtimeMeshThreadType AllowedGenerationThread = bAsyncCook ? ERealtimeMeshThreadType::AsyncThread : ERealtimeMeshThreadType::GameThread;
 
 			auto CollisionData = MakeShared<FRealtimeMeshCollisionInfo>();
 			CollisionData->Configuration = CollisionConfig;
@@ -831,33 +1670,67 @@ namespace RealtimeMesh
 			
 			auto ThisWeak = StaticCastWeakPtr<FRealtimeMeshSimple>(this->AsWeak());
 
-			DoOnAllowedThread(AllowedGenerationThread, [ThisWeak, CollisionData, ResultPromise = MoveTemp(Promise), UpdateKey]() mutable
-			{				
-				if (const auto ThisShared = ThisWeak.Pin())
+			if (bAsyncCook)
+			{
+				// Async cooks go through the scheduler so a mesh edited every frame only cooks its latest state
+				auto CookFuture = FRealtimeMeshCollisionCookScheduler::Get().Schedule(this,
+					[ThisWeak, CollisionData, UpdateKey](const FRealtimeMeshCollisionCookToken& CookToken) -> TFuture<ERealtimeMeshCollisionUpdateResult>
+					{
+						if (const auto ThisShared = ThisWeak.Pin())
+						{
+							{
+								FRealtimeMeshAccessContext AccessContext(ThisShared.ToSharedRef());
+								FRealtimeMeshComplexGeometry NewComplexGeometry;
+							
+								if (ThisShared->GenerateComplexCollision(AccessContext, NewComplexGeometry, CookToken))
+								{
+									CollisionData->ComplexGeometry = MoveTemp(NewComplexGeometry);
+								}
+							}
+
+							if (!CookToken.IsCancelled())
+							{
+								return ThisShared->UpdateCollision(MoveTemp(*CollisionData), UpdateKey, CookToken);
+							}
+						}
+						return MakeFulfilledPromise<ERealtimeMeshCollisionUpdateResult>(ERealtimeMeshCollisionUpdateResult::Ignored).GetFuture();
+					});
+
+				ContinueOnGameThread(MoveTemp(CookFuture), [ResultPromise = MoveTemp(Promise)](TFuture<ERealtimeMeshCollisionUpdateResult>&& Result) mutable
 				{
-					FRealtimeMeshAccessContext AccessContext(ThisShared.ToSharedRef());
-					FRealtimeMeshComplexGeometry NewComplexGeometry;
-					
-					if (ThisShared->GenerateComplexCollision(AccessContext, NewComplexGeometry))
+					ResultPromise.EmplaceValue(Result.Get());
+				});
+			}
+			else
+			{
+				DoOnGameThread([ThisWeak, CollisionData, ResultPromise = MoveTemp(Promise), UpdateKey]() mutable
+				{				
+					if (const auto ThisShared = ThisWeak.Pin())
 					{
-						CollisionData->ComplexGeometry = MoveTemp(NewComplexGeometry);
-					}
+						FRealtimeMeshAccessContext AccessContext(ThisShared.ToSharedRef());
+						FRealtimeMeshComplexGeometry NewComplexGeometry;
+					
+						if (ThisShared->GenerateComplexCollision(AccessContext, NewComplexGeometry))
+						{
+							CollisionData->ComplexGeometry = MoveTemp(NewComplexGeometry);
+						}
 
-					auto CollisionUpdateFuture = ThisShared->UpdateCollision(MoveTemp(*CollisionData), UpdateKey);
+						auto CollisionUpdateFuture = ThisShared->UpdateCollision(MoveTemp(*CollisionData), UpdateKey);
 
-					ContinueOnGameThread(MoveTemp(CollisionUpdateFuture), [ResultPromise = MoveTemp(ResultPromise)](TFuture<ERealtimeMeshCollisionUpdateResult>&& Result) mutable
-					{
-						ResultPromise.EmplaceValue(Result.Get());
-					});
-				}
-				else
-				{
-					DoOnGameThread([ResultPromise = MoveTemp(ResultPromise)]() mutable
+						ContinueOnGameThread(MoveTemp(CollisionUpdateFuture), [ResultPromise = MoveTemp(ResultPromise)](TFuture<ERealtimeMeshCollisionUpdateResult>&& Result) mutable
+						{
+							ResultPromise.EmplaceValue(Result.Get());
+						});
+					}
+					else
 					{
-						ResultPromise.EmplaceValue(ERealtimeMeshCollisionUpdateResult::Ignored);
-					});
-				}
-			});
+						DoOnGameThread([ResultPromise = MoveTemp(ResultPromise)]() mutable
+						{
+							ResultPromise.EmplaceValue(ERealtimeMeshCollisionUpdateResult::Ignored);
+						});
+					}
+				});
+			}
 		}
 		FRealtimeMesh::ProcessEndOfFrameUpdates();
 	}
@@ -1069,6 +1942,62 @@ TFuture<ERealtimeMeshProxyUpdateStatus> URealtimeMeshSimple::EditMeshInPlace(con
 	return UpdateBuilder.Commit(GetMeshData());
 }
 
+// ReSharper disable once CppMemberFunctionMayBeConst
+TFuture<ERealtimeMeshProxyUpdateStatus> URealtimeMeshSimple::EditMeshRangesInPlace(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const TFunctionRef<TSet<FRealtimeMeshStreamKey>(FRealtimeMeshStreamSet&)>& EditFunc)
+{
+	FRealtimeMeshUpdateBuilder UpdateBuilder;
+
+	UpdateBuilder.AddSectionGroupTask<FRealtimeMeshSectionGroupSimple>(SectionGroupKey,
+	[&EditFunc](FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshSectionGroupSimple& SectionGroup)
+	{
+		SectionGroup.EditMeshDataRanges(UpdateContext, EditFunc);
+	});
+	
+	return UpdateBuilder.Commit(GetMeshData());
+}
+
+// ReSharper disable once CppMemberFunctionMayBeConst
+TFuture<ERealtimeMeshProxyUpdateStatus> URealtimeMeshSimple::UpdateSectionGroupStreamRange(const FRealtimeMeshSectionGroupKey& SectionGroupKey, FRealtimeMeshStream&& RangeData, int32 DestinationIndex)
+{
+	FRealtimeMeshUpdateBuilder UpdateBuilder;
+
+	UpdateBuilder.AddSectionGroupTask<FRealtimeMeshSectionGroupSimple>(SectionGroupKey,
+	[RangeData = MoveTemp(RangeData), DestinationIndex](FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshSectionGroupSimple& SectionGroup) mutable
+	{
+		SectionGroup.UpdateStreamRange(UpdateContext, MoveTemp(RangeData), DestinationIndex);
+	});
+	
+	return UpdateBuilder.Commit(GetMeshData());
+}
+
+// ReSharper disable once CppMemberFunctionMayBeConst
+TFuture<ERealtimeMeshProxyUpdateStatus> URealtimeMeshSimple::SetSectionGroupCollisionStreams(const FRealtimeMeshSectionGroupKey& SectionGroupKey, FRealtimeMeshStreamSet&& CollisionStreams)
+{
+	FRealtimeMeshUpdateBuilder UpdateBuilder;
+
+	UpdateBuilder.AddSectionGroupTask<FRealtimeMeshSectionGroupSimple>(SectionGroupKey,
+	[CollisionStreams = MoveTemp(CollisionStreams)](FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshSectionGroupSimple& SectionGroup) mutable
+	{
+		SectionGroup.SetCollisionStreams(UpdateContext, MoveTemp(CollisionStreams));
+	});
+	
+	return UpdateBuilder.Commit(GetMeshData());
+}
+
+// ReSharper disable once CppMemberFunctionMayBeConst
+TFuture<ERealtimeMeshProxyUpdateStatus> URealtimeMeshSimple::ClearSectionGroupCollisionStreams(const FRealtimeMeshSectionGroupKey& SectionGroupKey)
+{
+	FRealtimeMeshUpdateBuilder UpdateBuilder;
+
+	UpdateBuilder.AddSectionGroupTask<FRealtimeMeshSectionGroupSimple>(SectionGroupKey,
+	[](FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshSectionGroupSimple& SectionGroup)
+	{
+		SectionGroup.ClearCollisionStreams(UpdateContext);
+	});
+	
+	return UpdateBuilder.Commit(GetMeshData());
+}
+
 bool URealtimeMeshSimple::HasCustomComplexMeshGeometry() const
 {
 	return GetMeshAs<FRealtimeMeshSimple>()->HasCustomComplexMeshGeometry();
@@ -846,6 +846,13 @@ namespace RealtimeMesh
 				// Update debug mode and line length in case they changed
 				(*ExistingVF)->SetDebugMode(DebugMode);
 				(*ExistingVF)->SetLineLength(LineLength);
+
+				// Ring backed groups move to new rows on every update without rebuilding, follow them
+				if (SectionGroup->HasVertexRing())
+				{
+					const TSharedPtr<FRealtimeMeshVertexFactory> GroupVertexFactory = SectionGroup->GetVertexFactory();
+					(*ExistingVF)->SetVertexWindow(RHICmdList, GroupVertexFactory->GetBaseVertexIndex(), GroupVertexFactory->GetValidRange().NumVertices());
+				}
 				return *ExistingVF;
 			}
 		}
@@ -872,6 +879,13 @@ namespace RealtimeMesh
 			BufferMap.Add(FRealtimeMeshStreams::Color, ColorBuffer);
 		}
 
+		// Read from the same rows of the ring as the section group
+		if (SectionGroup->HasVertexRing())
+		{
+			const TSharedPtr<FRealtimeMeshVertexFactory> GroupVertexFactory = SectionGroup->GetVertexFactory();
+			DebugVertexFactory->SetVertexWindow(RHICmdList, GroupVertexFactory->GetBaseVertexIndex(), GroupVertexFactory->GetValidRange().NumVertices());
+		}
+
 		// Initialize the debug vertex factory
 		DebugVertexFactory->Initialize(RHICmdList, BufferMap);
 
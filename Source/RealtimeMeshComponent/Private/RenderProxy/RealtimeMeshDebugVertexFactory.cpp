@@ -243,6 +243,23 @@ namespace RealtimeMesh
 		return *DebugIndexBuffer;
 	}
 
+	void FRealtimeMeshDebugVertexFactory::SetVertexWindow(FRHICommandListBase& RHICmdList, uint32 InBaseVertexIndex, int32 NumVertices)
+	{
+		const bool bBaseChanged = InBaseVertexIndex != BaseVertexIndex;
+		FRealtimeMeshVertexFactory::SetVertexWindow(RHICmdList, InBaseVertexIndex, NumVertices);
+
+		if (ValidRange.NumVertices() > 0)
+		{
+			ValidRange = FRealtimeMeshStreamRange(FInt32Range(0, NumVertices), FInt32Range(0, NumVertices));
+		}
+
+		// The lines are drawn from their own index buffer, so the offset only reaches the shader through the uniform buffer
+		if (bBaseChanged && UniformBuffer.IsValid())
+		{
+			UniformBuffer = CreateDebugVertexFactoryUniformBuffer();
+		}
+	}
+
 	TUniformBufferRef<FLocalVertexFactoryUniformShaderParameters> FRealtimeMeshDebugVertexFactory::CreateDebugVertexFactoryUniformBuffer() const
 	{
 		FLocalVertexFactoryUniformShaderParameters UniformParameters;
@@ -254,7 +271,7 @@ namespace RealtimeMesh
 		const float DebugLineLength = CVarRealtimeMeshDebugLineLength.GetValueOnRenderThread();
 		
 		// Pack debug parameters into VertexFetch_Parameters:
-		// x = vertex offset (0 for debug)
+		// x = vertex offset (the base vertex of ring backed section groups, otherwise 0)
 		// y = debug mode bitmask (1=normals, 2=tangents, 4=binormals)  
 		// z = debug line length (as int, will be converted back to float in shader)
 		// w = number of active debug channels
@@ -265,7 +282,7 @@ namespace RealtimeMesh
 		if (bShowBinormals) { DebugModeBitmask |= 4; NumActiveChannels++; }
 		
 		UniformParameters.VertexFetch_Parameters = FIntVector4(
-			0,  // x = vertex offset
+			BaseVertexIndex,  // x = vertex offset
 			DebugModeBitmask, // y = debug mode bitmask
 			*(uint32*)&DebugLineLength, // z = debug line length (float as uint32)
 			NumActiveChannels // w = number of active channels
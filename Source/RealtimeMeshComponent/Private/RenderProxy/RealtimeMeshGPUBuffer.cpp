@@ -1,14 +1,160 @@
 ﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
 
 #include "RenderProxy/RealtimeMeshGPUBuffer.h"
+#include "RealtimeMeshCore.h"
 #include "Data/RealtimeMeshUpdateBuilder.h"
 
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshBufferCreationMode(
+	TEXT("RealtimeMesh.BufferCreationMode"),
+	1,
+	TEXT("Where GPU buffers for stream updates are created.\n")
+	TEXT("0: Always on the render thread while processing the update.\n")
+	TEXT("1: On the updating thread through the update's RHI command list when the RHI supports multithreaded resource creation, otherwise on the render thread.\n")
+	TEXT("Engines before 5.5 always create them on the render thread."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshReuseStreamBuffers(
+	TEXT("RealtimeMesh.ReuseStreamBuffers"),
+	1,
+	TEXT("Write stream updates that keep the same layout and size into the existing GPU buffer instead of creating a new one.\n")
+	TEXT("This keeps the vertex factory and cached draw commands valid across the update."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshDynamicRingBuffers(
+	TEXT("RealtimeMesh.DynamicRingBuffers"),
+	1,
+	TEXT("Back the vertex streams of each dynamic section group with one ring that every update of the group is suballocated from,\n")
+	TEXT("instead of creating a new GPU buffer whenever the streams change size. The buffers and views stay the same, draws move to the new rows by base vertex index."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshDynamicRingBufferFramesInFlight(
+	TEXT("RealtimeMesh.DynamicRingBuffers.FramesInFlight"),
+	3,
+	TEXT("How many render frames a region of a dynamic ring buffer is kept after it was last drawn from before it's reused (2-4).\n")
+	TEXT("Frames are counted on the render thread, this assumes the GPU never falls further behind than that.\n")
+	TEXT("A ring is sized to hold one more update than this. When every region is still in use the ring grows instead."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshPoolStreamBuffers(
+	TEXT("RealtimeMesh.PoolStreamBuffers"),
+	0,
+	TEXT("Create stream buffers in size classes with extra capacity and reuse released buffers of the same class.\n")
+	TEXT("Streams that grow or shrink a little keep their buffer, and resized streams recycle buffers instead of allocating new ones."));
+
+static TAutoConsoleVariable<float> CVarRealtimeMeshPoolStreamBuffersSlack(
+	TEXT("RealtimeMesh.PoolStreamBuffers.Slack"),
+	0.25f,
+	TEXT("Extra capacity pooled buffers are created with as a fraction of the stream size, 0.25 is 25%."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshPoolStreamBuffersReuseDelay(
+	TEXT("RealtimeMesh.PoolStreamBuffers.ReuseDelayFrames"),
+	3,
+	TEXT("Render frames a released buffer waits in the pool before it's reused, so the GPU is done with it."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshPoolStreamBuffersMaxIdle(
+	TEXT("RealtimeMesh.PoolStreamBuffers.MaxIdleFrames"),
+	300,
+	TEXT("Render frames a free buffer is kept in the pool before it's destroyed."));
+
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshGPUBuffer - Render Thread Buffer Creation"), STAT_RealtimeMeshGPUBuffer_RenderThreadBufferCreation, STATGROUP_RealtimeMesh);
+DECLARE_CYCLE_STAT(TEXT("RealtimeMeshGPUBuffer - Async Buffer Creation"), STAT_RealtimeMeshGPUBuffer_AsyncBufferCreation, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshGPUBuffer - Render Thread Buffers Created"), STAT_RealtimeMeshGPUBuffer_NumRenderThreadBuffers, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshGPUBuffer - Async Buffers Created"), STAT_RealtimeMeshGPUBuffer_NumAsyncBuffers, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshGPUBuffer - Buffers Updated In Place"), STAT_RealtimeMeshGPUBuffer_NumInPlaceUpdates, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshGPUBuffer - Ring Buffers Created"), STAT_RealtimeMeshGPUBuffer_NumRingBuffers, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshGPUBuffer - Pool Hits"), STAT_RealtimeMeshGPUBuffer_NumPoolHits, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshGPUBuffer - Pool Misses"), STAT_RealtimeMeshGPUBuffer_NumPoolMisses, STATGROUP_RealtimeMesh);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("RealtimeMeshGPUBuffer - Pool Hit Rate"), STAT_RealtimeMeshGPUBuffer_PoolHitRate, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("RealtimeMeshGPUBuffer - Pool Free Buffers"), STAT_RealtimeMeshGPUBuffer_PoolFreeBuffers, STATGROUP_RealtimeMesh);
+DECLARE_MEMORY_STAT(TEXT("RealtimeMeshGPUBuffer - Pool In Use Memory"), STAT_RealtimeMeshGPUBuffer_PoolInUseMemory, STATGROUP_RealtimeMesh);
+DECLARE_MEMORY_STAT(TEXT("RealtimeMeshGPUBuffer - Pool Wasted Memory"), STAT_RealtimeMeshGPUBuffer_PoolWastedMemory, STATGROUP_RealtimeMesh);
+
 namespace RealtimeMesh
 {
+	/* Released stream buffers waiting for reuse, only used from the render thread */
+	class FRealtimeMeshBufferPoolResource : public FRenderResource
+	{
+	public:
+		TRealtimeMeshBufferPool<FBufferRHIRef> Pool;
+		uint64 LastTrimFrame = 0;
+
+		virtual FString GetFriendlyName() const override { return TEXT("FRealtimeMeshBufferPoolResource"); }
+
+		virtual void ReleaseRHI() override
+		{
+			// The pooled buffers can't outlive the RHI
+			Pool.Empty();
+		}
+	};
+
+	static TGlobalResource<FRealtimeMeshBufferPoolResource> GRealtimeMeshBufferPool;
+
+	static std::atomic<uint64> GRealtimeMeshStreamBuffersCreated(0);
+
+	uint64 FRealtimeMeshSectionGroupStreamUpdateData::GetNumBuffersCreated()
+	{
+		return GRealtimeMeshStreamBuffersCreated.load(std::memory_order_relaxed);
+	}
+
+	static FRealtimeMeshBufferPoolPolicy GetBufferPoolPolicy()
+	{
+		FRealtimeMeshBufferPoolPolicy Policy;
+		Policy.Slack = FMath::Max(CVarRealtimeMeshPoolStreamBuffersSlack.GetValueOnAnyThread(), 0.0f);
+		Policy.ReuseDelayFrames = FMath::Max(CVarRealtimeMeshPoolStreamBuffersReuseDelay.GetValueOnAnyThread(), 1);
+		Policy.MaxIdleFrames = FMath::Max(CVarRealtimeMeshPoolStreamBuffersMaxIdle.GetValueOnAnyThread(), 0);
+		return Policy;
+	}
+
+	static void UpdateBufferPoolStats()
+	{
+		const FRealtimeMeshBufferPoolStats& Stats = GRealtimeMeshBufferPool.Pool.GetStats();
+		SET_FLOAT_STAT(STAT_RealtimeMeshGPUBuffer_PoolHitRate, Stats.GetHitRate());
+		SET_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_PoolFreeBuffers, Stats.NumFree);
+		SET_MEMORY_STAT(STAT_RealtimeMeshGPUBuffer_PoolInUseMemory, Stats.InUseBytes);
+		SET_MEMORY_STAT(STAT_RealtimeMeshGPUBuffer_PoolWastedMemory, Stats.GetWastedBytes());
+	}
+
+	static FBufferRHIRef CreateUninitializedBuffer(FRHICommandListBase& RHICmdList, const TCHAR* Name, bool bIsIndexBuffer, uint32 Size, uint32 Stride, EBufferUsageFlags Usage)
+	{
+#if RMC_ENGINE_ABOVE_5_6
+		// SetUsage replaces the vertex usage, so this creates index buffers as well, like the stream buffers below
+		const FRHIBufferCreateDesc BufferDesc = FRHIBufferCreateDesc::CreateVertex(Name)
+			.SetSize(Size)
+			.SetStride(Stride)
+			.SetUsage(Usage)
+			.SetInitialState(ERHIAccess::VertexOrIndexBuffer | ERHIAccess::SRVMask);
+		return RHICmdList.CreateBuffer(BufferDesc);
+#else
+		FRHIResourceCreateInfo CreateInfo(Name);
+		return bIsIndexBuffer
+			? RHICmdList.CreateIndexBuffer(Stride, Size, Usage, CreateInfo)
+			: RHICmdList.CreateVertexBuffer(Size, Usage, CreateInfo);
+#endif
+	}
+
+	static bool ShouldCreateBuffersAsync()
+	{
+#if RMC_ENGINE_ABOVE_5_5
+		return CVarRealtimeMeshBufferCreationMode.GetValueOnAnyThread() == 1 && GRHISupportsMultithreadedResources;
+#else
+		// Before 5.5 the update's command list is only reset on commit, never submitted, so nothing recorded to it would reach the RHI
+		return false;
+#endif
+	}
+	
 	void FRealtimeMeshSectionGroupStreamUpdateData::CreateBufferAsyncIfPossible(FRealtimeMeshUpdateContext& UpdateContext)
 	{
-		if (false && GRHISupportsAsyncTextureCreation)
+		// Range updates are written into the existing buffer, and pooled buffers are handed out on the render thread
+		if (IsRangeUpdate() || FRealtimeMeshGPUBuffer::ShouldPoolBuffers())
 		{
+			return;
+		}
+
+		// Otherwise the buffer is created on the render thread in FinalizeInitialization
+		if (ShouldCreateBuffersAsync() && Stream.GetResourceDataSize() > 0)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshGPUBuffer_AsyncBufferCreation);
+			INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumAsyncBuffers);
+			GRealtimeMeshStreamBuffersCreated.fetch_add(1, std::memory_order_relaxed);
+			
 			auto& RHICmdList = UpdateContext.GetRHICmdList();
 
 #if RMC_ENGINE_ABOVE_5_6
@@ -76,8 +222,15 @@ namespace RealtimeMesh
 
 	void FRealtimeMeshSectionGroupStreamUpdateData::FinalizeInitialization(FRHICommandListBase& RHICmdList)
 	{
-		if (!Buffer.IsValid())
+		if (!Buffer.IsValid() && !IsRangeUpdate() && FRealtimeMeshGPUBuffer::ShouldPoolBuffers() && Stream.Num() > 0 && Stream.GetStride() > 0)
 		{
+			AcquirePooledBuffer(RHICmdList);
+		}
+		else if (!Buffer.IsValid() && !IsRangeUpdate())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshGPUBuffer_RenderThreadBufferCreation);
+			INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumRenderThreadBuffers);
+			GRealtimeMeshStreamBuffersCreated.fetch_add(1, std::memory_order_relaxed);
 			check(Stream.GetResourceDataSize());
 				
 #if RMC_ENGINE_ABOVE_5_6
@@ -129,4 +282,300 @@ namespace RealtimeMesh
 #endif
 		}
 	}
+
+	void FRealtimeMeshSectionGroupStreamUpdateData::AcquirePooledBuffer(FRHICommandListBase& RHICmdList)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupStreamUpdateData::AcquirePooledBuffer);
+
+		const bool bIsIndexBuffer = GetStreamKey().IsIndexStream();
+		const EBufferUsageFlags BufferUsage = UsageFlags | (bIsIndexBuffer ? BUF_IndexBuffer : BUF_VertexBuffer) | BUF_ShaderResource;
+		const uint32 Stride = bIsIndexBuffer ? Stream.GetElementStride() : Stream.GetStride();
+		const uint64 Size = Stream.GetResourceDataSize();
+		const uint64 Frame = GFrameNumberRenderThread;
+
+		TRealtimeMeshBufferPool<FBufferRHIRef>& Pool = GRealtimeMeshBufferPool.Pool;
+		Pool.SetPolicy(GetBufferPoolPolicy());
+
+		if (GRealtimeMeshBufferPool.LastTrimFrame != Frame)
+		{
+			GRealtimeMeshBufferPool.LastTrimFrame = Frame;
+			Pool.Trim(Frame);
+		}
+
+		if (Pool.Acquire(static_cast<uint32>(BufferUsage), Stride, Size, Frame, PoolKey, Buffer))
+		{
+			INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumPoolHits);
+		}
+		else
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshGPUBuffer_RenderThreadBufferCreation);
+			INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumPoolMisses);
+			INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumRenderThreadBuffers);
+			GRealtimeMeshStreamBuffersCreated.fetch_add(1, std::memory_order_relaxed);
+			check(PoolKey.Size <= TNumericLimits<uint32>::Max());
+
+			Buffer = CreateUninitializedBuffer(RHICmdList, TEXT("RealtimeMeshBuffer-Pooled"), bIsIndexBuffer, static_cast<uint32>(PoolKey.Size), Stride, BufferUsage);
+		}
+		bIsPooled = true;
+
+		// Only the front of the buffer holds data, the rest is slack for the stream to grow into
+		void* Dest = RHICmdList.LockBuffer(Buffer, 0, static_cast<uint32>(Size), RLM_WriteOnly);
+		FMemory::Memcpy(Dest, Stream.GetResourceData(), Size);
+		RHICmdList.UnlockBuffer(Buffer);
+
+		UpdateBufferPoolStats();
+	}
+
+	bool FRealtimeMeshGPUBuffer::CanApplyRangeUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) const
+	{
+		if (!UpdateData->IsRangeUpdate() || !IsResourceInitialized() || BufferLayout != UpdateData->GetBufferLayout())
+		{
+			return false;
+		}
+
+		const FRHIBuffer* RHIBuffer = GetRHIBuffer();
+		if (RHIBuffer == nullptr)
+		{
+			return false;
+		}
+
+		const uint64 Offset = static_cast<uint64>(UpdateData->GetDestinationIndex()) * GetStride();
+		const uint64 Size = UpdateData->GetStream().GetResourceDataSize();
+		return Size > 0 && Offset + Size <= RHIBuffer->GetSize();
+	}
+
+	void FRealtimeMeshGPUBuffer::ApplyRangeUpdate(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshGPUBuffer::ApplyRangeUpdate);
+		check(CanApplyRangeUpdate(UpdateData));
+
+		const uint32 Offset = UpdateData->GetDestinationIndex() * GetStride();
+		const uint32 Size = UpdateData->GetStream().GetResourceDataSize();
+
+		void* Dest = RHICmdList.LockBuffer(GetRHIBuffer(), Offset, Size, RLM_WriteOnly);
+		FMemory::Memcpy(Dest, UpdateData->GetStream().GetResourceData(), Size);
+		RHICmdList.UnlockBuffer(GetRHIBuffer());
+	}
+
+	bool FRealtimeMeshGPUBuffer::CanApplyInPlaceUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) const
+	{
+		if (UpdateData->IsRangeUpdate() || !IsResourceInitialized() || BufferLayout != UpdateData->GetBufferLayout() || UsageFlags != UpdateData->GetUsageFlags())
+		{
+			return false;
+		}
+
+		const FRHIBuffer* RHIBuffer = GetRHIBuffer();
+		if (RHIBuffer == nullptr)
+		{
+			return false;
+		}
+
+		const uint64 Size = UpdateData->GetStream().GetResourceDataSize();
+		if (bIsPooled)
+		{
+			// Pooled buffers take any size within their capacity as long as it doesn't leave most of it unused
+			return GetBufferPoolPolicy().CanReuseCapacity(Size, RHIBuffer->GetSize());
+		}
+		return Size > 0 && Size == RHIBuffer->GetSize();
+	}
+
+	void FRealtimeMeshGPUBuffer::ApplyInPlaceUpdate(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshGPUBuffer::ApplyInPlaceUpdate);
+		check(CanApplyInPlaceUpdate(UpdateData));
+		INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumInPlaceUpdates);
+
+		const uint32 Size = UpdateData->GetStream().GetResourceDataSize();
+
+		void* Dest = RHICmdList.LockBuffer(GetRHIBuffer(), 0, Size, RLM_WriteOnly);
+		FMemory::Memcpy(Dest, UpdateData->GetStream().GetResourceData(), Size);
+		RHICmdList.UnlockBuffer(GetRHIBuffer());
+
+		// Pooled buffers can be written with a different number of rows
+		if (bIsPooled)
+		{
+			GRealtimeMeshBufferPool.Pool.UpdateDataSize(DataSize, Size);
+			UpdateBufferPoolStats();
+		}
+		DataSize = Size;
+
+		// Index buffers count single indices rather than rows
+		BufferNum = UpdateData->GetNumElements() * (GetStreamType() == ERealtimeMeshStreamType::Index ? BufferLayout.GetNumElements() : 1);
+	}
+
+	bool FRealtimeMeshGPUBuffer::ShouldReuseBuffersInPlace()
+	{
+		return CVarRealtimeMeshReuseStreamBuffers.GetValueOnAnyThread() != 0;
+	}
+
+	bool FRealtimeMeshGPUBuffer::ShouldPoolBuffers()
+	{
+		return CVarRealtimeMeshPoolStreamBuffers.GetValueOnAnyThread() != 0;
+	}
+
+	FRealtimeMeshBufferPoolStats FRealtimeMeshGPUBuffer::GetBufferPoolStats()
+	{
+		return GRealtimeMeshBufferPool.Pool.GetStats();
+	}
+
+	void FRealtimeMeshGPUBuffer::InitializePooling(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData)
+	{
+		bIsPooled = UpdateData->IsPooled();
+		PoolKey = UpdateData->GetPoolKey();
+		DataSize = UpdateData->GetStream().GetResourceDataSize();
+	}
+
+	void FRealtimeMeshGPUBuffer::ReturnToPool(FBufferRHIRef&& Buffer)
+	{
+		check(bIsPooled);
+
+		// Once the pool itself has been released at shutdown the buffer is simply dropped
+		if (Buffer.IsValid() && GRealtimeMeshBufferPool.IsInitialized())
+		{
+			GRealtimeMeshBufferPool.Pool.Release(PoolKey, DataSize, MoveTemp(Buffer), GFrameNumberRenderThread);
+			UpdateBufferPoolStats();
+		}
+
+		Buffer = nullptr;
+		bIsPooled = false;
+		DataSize = 0;
+	}
+
+	bool FRealtimeMeshGPUBuffer::ShouldUseRingBuffer(ERealtimeMeshSectionDrawType DrawType, const FRealtimeMeshStreamKey& StreamKey)
+	{
+		// Index buffers are bound without an offset by the mesh batches, so only vertex streams can live in a ring
+		return DrawType == ERealtimeMeshSectionDrawType::Dynamic && StreamKey.IsVertexStream() &&
+			CVarRealtimeMeshDynamicRingBuffers.GetValueOnAnyThread() != 0;
+	}
+
+	uint32 FRealtimeMeshGPUBuffer::GetRingFramesInFlight()
+	{
+		return FMath::Clamp(CVarRealtimeMeshDynamicRingBufferFramesInFlight.GetValueOnAnyThread(), 2, 4);
+	}
+
+	void FRealtimeMeshVertexBuffer::InitializeRingResources(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData, uint32 InRingNumRows)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshVertexBuffer::InitializeRingResources);
+		check(!UpdateData->IsRangeUpdate());
+		check(BufferLayout == UpdateData->GetBufferLayout());
+		check(BufferLayout.IsValid());
+		check(GetStride() > 0);
+
+		InitResource(RHICmdList);
+
+#if WITH_EDITOR
+		BufferName = UpdateData->GetStreamKey().GetName().ToString();
+#endif
+
+		InterleavedLayout = UpdateData->GetInterleavedLayout();
+		UsageFlags = UpdateData->GetUsageFlags();
+
+		const bool bStaged = StageRingUpdate(UpdateData);
+		check(bStaged);
+
+		check(InRingNumRows >= static_cast<uint32>(BufferNum));
+		RingNumRows = InRingNumRows;
+		CreateRingBuffer(RHICmdList);
+	}
+
+	void FRealtimeMeshVertexBuffer::ResizeRing(FRHICommandListBase& RHICmdList, uint32 InRingNumRows)
+	{
+		check(IsRingBuffer());
+		check(InRingNumRows >= static_cast<uint32>(BufferNum));
+
+		RingNumRows = InRingNumRows;
+		CreateRingBuffer(RHICmdList);
+	}
+
+	bool FRealtimeMeshVertexBuffer::StageRingUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData)
+	{
+		if (BufferLayout != UpdateData->GetBufferLayout() || InterleavedLayout != UpdateData->GetInterleavedLayout())
+		{
+			return false;
+		}
+
+		const uint64 Size = UpdateData->GetStream().GetResourceDataSize();
+		if (Size == 0)
+		{
+			return false;
+		}
+
+		if (UpdateData->IsRangeUpdate())
+		{
+			// Only the staged copy is patched, the rows the GPU reads are replaced as a whole when the group uploads its next region
+			const uint64 Offset = static_cast<uint64>(UpdateData->GetDestinationIndex()) * GetStride();
+			if (Offset + Size > static_cast<uint64>(RingContents.Num()))
+			{
+				return false;
+			}
+			FMemory::Memcpy(RingContents.GetData() + Offset, UpdateData->GetStream().GetResourceData(), Size);
+		}
+		else
+		{
+			if (IsRingBuffer() && Size > static_cast<uint64>(RingNumRows) * GetStride())
+			{
+				return false;
+			}
+			RingContents.SetNumUninitialized(Size);
+			FMemory::Memcpy(RingContents.GetData(), UpdateData->GetStream().GetResourceData(), Size);
+			BufferNum = static_cast<uint32>(Size / GetStride());
+			DataSize = Size;
+		}
+		return true;
+	}
+
+	void FRealtimeMeshVertexBuffer::UploadRingRows(FRHICommandListBase& RHICmdList, uint32 FirstRow)
+	{
+		const uint64 Size = RingContents.Num();
+		check(IsRingBuffer() && Size > 0);
+		check(FirstRow + static_cast<uint64>(BufferNum) <= RingNumRows);
+
+		// Nothing in flight overlaps the region so the write doesn't need to wait on the GPU
+		void* Dest = RHICmdList.LockBuffer(VertexBufferRHI, FirstRow * GetStride(), static_cast<uint32>(Size), RLM_WriteOnly_NoOverwrite);
+		FMemory::Memcpy(Dest, RingContents.GetData(), Size);
+		RHICmdList.UnlockBuffer(VertexBufferRHI);
+	}
+
+	void FRealtimeMeshVertexBuffer::ReleaseRing(FRHICommandListBase& RHICmdList)
+	{
+		check(IsRingBuffer());
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshGPUBuffer_RenderThreadBufferCreation);
+
+		// Frames still drawing from the ring keep it alive through their own references
+		const uint32 Size = static_cast<uint32>(RingContents.Num());
+		VertexBufferRHI = CreateUninitializedBuffer(RHICmdList, TEXT("RealtimeMeshBuffer-Vertex"), false, Size, GetStride(), UsageFlags | BUF_VertexBuffer);
+
+		void* Dest = RHICmdList.LockBuffer(VertexBufferRHI, 0, Size, RLM_WriteOnly);
+		FMemory::Memcpy(Dest, RingContents.GetData(), Size);
+		RHICmdList.UnlockBuffer(VertexBufferRHI);
+
+		ShaderResourceViewRHI = nullptr;
+		if (RHISupportsManualVertexFetch(GMaxRHIShaderPlatform) && !IsInterleaved())
+		{
+			ShaderResourceViewRHI = RHICmdList.CreateShaderResourceView(FShaderResourceViewInitializer(VertexBufferRHI, GetElementFormat()));
+		}
+
+		RingContents.Empty();
+		RingNumRows = 0;
+	}
+
+	void FRealtimeMeshVertexBuffer::CreateRingBuffer(FRHICommandListBase& RHICmdList)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_RealtimeMeshGPUBuffer_RenderThreadBufferCreation);
+		INC_DWORD_STAT(STAT_RealtimeMeshGPUBuffer_NumRingBuffers);
+
+		const uint64 RingSize = static_cast<uint64>(RingNumRows) * GetStride();
+		check(RingSize > 0 && RingSize <= TNumericLimits<uint32>::Max());
+
+		// Any frame still drawing from a previous ring keeps it alive through its own reference
+		VertexBufferRHI = CreateUninitializedBuffer(RHICmdList, TEXT("RealtimeMeshBuffer-Ring"), false, static_cast<uint32>(RingSize), GetStride(),
+			BUF_Dynamic | BUF_VertexBuffer | BUF_ShaderResource);
+
+		// The view covers the whole ring, manual fetch reaches the group's current region through the base vertex index like the vertex streams
+		ShaderResourceViewRHI = nullptr;
+		if (RHISupportsManualVertexFetch(GMaxRHIShaderPlatform) && !IsInterleaved())
+		{
+			ShaderResourceViewRHI = RHICmdList.CreateShaderResourceView(FShaderResourceViewInitializer(VertexBufferRHI, GetElementFormat()));
+		}
+	}
 }
@@ -8,9 +8,49 @@
 #include "Data/RealtimeMeshShared.h"
 #include "Mesh/RealtimeMeshNaniteResourcesInterface.h"
 #include "RenderProxy/RealtimeMeshLODProxy.h"
+#include "RenderProxy/RealtimeMeshUploadScheduler.h"
+
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshUploadBudgetPerFrame(
+	TEXT("RealtimeMesh.UploadBudgetPerFrame"),
+	0,
+	TEXT("Bytes of mesh updates applied on the render thread per frame, 0 for no limit.\n")
+	TEXT("Updates over the budget wait for a later frame, meshes with a higher upload priority go first. An update is never split."));
+
+static TAutoConsoleVariable<int32> CVarRealtimeMeshUploadBudgetMaxDeferFrames(
+	TEXT("RealtimeMesh.UploadBudgetPerFrame.MaxDeferFrames"),
+	30,
+	TEXT("Render frames an update can be held back by the upload budget before it's applied regardless, 0 to wait as long as needed."));
+
+DECLARE_MEMORY_STAT(TEXT("RealtimeMeshProxy - Uploaded Bytes This Frame"), STAT_RealtimeMeshProxy_UploadedBytesThisFrame, STATGROUP_RealtimeMesh);
+DECLARE_MEMORY_STAT(TEXT("RealtimeMeshProxy - Deferred Upload Bytes"), STAT_RealtimeMeshProxy_DeferredUploadBytes, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("RealtimeMeshProxy - Deferred Command Batches"), STAT_RealtimeMeshProxy_DeferredCommandBatches, STATGROUP_RealtimeMesh);
 
 namespace RealtimeMesh
 {
+	/* Shared by every proxy so the budget is per frame, not per mesh */
+	static FRealtimeMeshUploadScheduler GRealtimeMeshUploadScheduler;
+	static FCriticalSection GRealtimeMeshUploadSchedulerLock;
+
+	static std::atomic<int64> GRealtimeMeshDeferredUploadBytes(0);
+	static std::atomic<int32> GRealtimeMeshDeferredCommandBatches(0);
+
+	/* Assumes GRealtimeMeshUploadSchedulerLock is held */
+	static void BeginUploadFrame()
+	{
+		GRealtimeMeshUploadScheduler.BeginFrame(GFrameNumberRenderThread,
+			FMath::Max(CVarRealtimeMeshUploadBudgetPerFrame.GetValueOnAnyThread(), 0),
+			FMath::Max(CVarRealtimeMeshUploadBudgetMaxDeferFrames.GetValueOnAnyThread(), 0));
+	}
+
+	static FRealtimeMeshUploadScheduler::FBatch GetScheduledBatch(uint64 UploadBytes, uint64 QueuedFrame)
+	{
+		const uint64 Frame = GFrameNumberRenderThread;
+		const uint64 FramesWaited = Frame > QueuedFrame ? Frame - QueuedFrame : 0;
+		return { UploadBytes, static_cast<uint32>(FMath::Min<uint64>(FramesWaited, MAX_uint32)) };
+	}
+
 	FRealtimeMeshProxy::FRealtimeMeshProxy(const FRealtimeMeshSharedResourcesRef& InSharedResources)
 		: SharedResources(InSharedResources)
 		, ActiveLODMask(false, REALTIME_MESH_MAX_LODS)
@@ -31,6 +71,13 @@ namespace RealtimeMesh
 		check(IsInRenderingThread());
 		Reset();
 
+		for (const FCommandBatch& Batch : PendingBatches)
+		{
+			Batch.ThreadState->FinalizeRenderThread(ERealtimeMeshProxyUpdateStatus::NoProxy);
+		}
+		PendingBatches.Empty();
+		UpdatePendingUploadStats();
+
 		while (!CommandQueue.IsEmpty())
 		{
 			auto Entry = CommandQueue.Dequeue();
@@ -188,31 +235,231 @@ namespace RealtimeMesh
 	}
 #endif
 
-	void FRealtimeMeshProxy::EnqueueCommandBatch(TArray<FRealtimeMeshProxyUpdateBuilder::TaskFunctionType>&& InTasks, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState)
+	void FRealtimeMeshProxy::EnqueueCommandBatch(TArray<FRealtimeMeshProxyTask>&& InTasks, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState, bool bRequiresProxyRecreate)
 	{
-		CommandQueue.Enqueue(FCommandBatch { MoveTemp(InTasks), ThreadState });
+		FCommandBatch Batch { MoveTemp(InTasks), ThreadState };
+		Batch.bRequiresProxyRecreate = bRequiresProxyRecreate;
+		CommandQueue.Enqueue(MoveTemp(Batch));
 	}
 
-	void FRealtimeMeshProxy::ProcessCommands(FRHICommandListBase& RHICmdList)
+	void FRealtimeMeshProxy::ProcessCommands(FRHICommandListBase& RHICmdList, bool bStopAtProxyRecreate)
 	{
 		FScopeLock Lock(&CommandQueueLock);
-		
-		bool bHadAnyUpdates = false;
+
+		DrainCommandQueue();
+		if (!bStopAtProxyRecreate)
+		{
+			bRecreateRequested = false;
+		}
+
+		if (PendingBatches.Num() == 0)
+		{
+			return;
+		}
+
+		// Batches that change what the scene proxies draw wait for them to be recreated
+		const int32 MaxToApply = bStopAtProxyRecreate ? GetNumBatchesBeforeProxyRecreate() : PendingBatches.Num();
+
+		int32 NumToApply;
+		bool bRecreateBatchGranted;
+		{
+			FScopeLock SchedulerLock(&GRealtimeMeshUploadSchedulerLock);
+			BeginUploadFrame();
+
+			if (!GRealtimeMeshUploadScheduler.IsEnabled())
+			{
+				NumToApply = MaxToApply;
+			}
+			else
+			{
+				// Batches granted by an earlier schedule were already charged to that frame's budget
+				NumToApply = FMath::Min(NumGrantedBatches, MaxToApply);
+
+				while (NumToApply < MaxToApply)
+				{
+					const FCommandBatch& Batch = PendingBatches[NumToApply];
+					if (!GRealtimeMeshUploadScheduler.TryConsume(GetScheduledBatch(Batch.GetUploadBytes(), Batch.QueuedFrame)))
+					{
+						break;
+					}
+					NumToApply++;
+				}
+			}
+			// Granted batches held back for a recreate stay paid for
+			NumGrantedBatches = FMath::Max(NumGrantedBatches - NumToApply, 0);
+			bRecreateBatchGranted = GRealtimeMeshUploadScheduler.IsEnabled() ? NumGrantedBatches > 0 : MaxToApply < PendingBatches.Num();
+
+			SET_MEMORY_STAT(STAT_RealtimeMeshProxy_UploadedBytesThisFrame, GRealtimeMeshUploadScheduler.GetUsedBytes());
+		}
+
+		ApplyCommandBatches(RHICmdList, NumToApply);
+
+		if (!bStopAtProxyRecreate)
+		{
+			bHasDeferredBatches = PendingBatches.Num() > 0;
+		}
+		else
+		{
+			bHasDeferredBatches &= PendingBatches.Num() > 0;
+
+			// The recreate requested when these batches were committed came while the budget held them back,
+			// now that they have the budget they need another one to be applied.
+			if (bHasDeferredBatches && bRecreateBatchGranted)
+			{
+				RequestProxyRecreate();
+			}
+		}
+		UpdatePendingUploadStats();
+	}
+
+	void FRealtimeMeshProxy::ProcessCommandsForFrame(FRHICommandListBase& RHICmdList, TConstArrayView<FRealtimeMeshProxyPtr> Proxies)
+	{
+		bool bBudgetEnabled;
+		{
+			FScopeLock SchedulerLock(&GRealtimeMeshUploadSchedulerLock);
+			BeginUploadFrame();
+			bBudgetEnabled = GRealtimeMeshUploadScheduler.IsEnabled();
+		}
+
+		if (bBudgetEnabled)
+		{
+			// Gather everything waiting so the budget goes to the highest priority work of all meshes, not whichever is processed first
+			TArray<FRealtimeMeshUploadScheduler::FOwner> Owners;
+			Owners.Reserve(Proxies.Num());
+			for (const FRealtimeMeshProxyPtr& Proxy : Proxies)
+			{
+				FScopeLock Lock(&Proxy->CommandQueueLock);
+				Proxy->DrainCommandQueue();
+
+				FRealtimeMeshUploadScheduler::FOwner& Owner = Owners.AddDefaulted_GetRef();
+				Owner.Priority = Proxy->SharedResources->GetUploadPriority();
+
+				const int32 NumAlreadyGranted = FMath::Min(Proxy->NumGrantedBatches, Proxy->PendingBatches.Num());
+				for (int32 BatchIndex = NumAlreadyGranted; BatchIndex < Proxy->PendingBatches.Num(); BatchIndex++)
+				{
+					const FCommandBatch& Batch = Proxy->PendingBatches[BatchIndex];
+					Owner.Batches.Add(GetScheduledBatch(Batch.GetUploadBytes(), Batch.QueuedFrame));
+				}
+			}
+
+			TArray<int32> Granted;
+			{
+				FScopeLock SchedulerLock(&GRealtimeMeshUploadSchedulerLock);
+				Granted = GRealtimeMeshUploadScheduler.Schedule(Owners);
+				SET_MEMORY_STAT(STAT_RealtimeMeshProxy_UploadedBytesThisFrame, GRealtimeMeshUploadScheduler.GetUsedBytes());
+			}
+
+			for (int32 Index = 0; Index < Proxies.Num(); Index++)
+			{
+				const FRealtimeMeshProxyPtr& Proxy = Proxies[Index];
+				if (Granted[Index] > 0)
+				{
+					FScopeLock Lock(&Proxy->CommandQueueLock);
+					Proxy->NumGrantedBatches = FMath::Min(Proxy->NumGrantedBatches, Proxy->PendingBatches.Num()) + Granted[Index];
+				}
+			}
+		}
+
+		for (const FRealtimeMeshProxyPtr& Proxy : Proxies)
+		{
+			// Proxies in use by components only apply updates that leave the components' draw commands valid,
+			// anything else waits for their scene proxies to be recreated.
+			Proxy->ProcessCommands(RHICmdList, Proxy->HasAnyReferencingComponents());
+		}
+	}
+
+	void FRealtimeMeshProxy::DrainCommandQueue()
+	{
 		while (!CommandQueue.IsEmpty())
 		{
-			auto Entry = CommandQueue.Dequeue();
-			for (const auto& Task : Entry->Tasks)
+			FCommandBatch& Batch = PendingBatches.Add_GetRef(MoveTemp(CommandQueue.Dequeue().GetValue()));
+			Batch.QueuedFrame = GFrameNumberRenderThread;
+		}
+	}
+
+	void FRealtimeMeshProxy::ApplyCommandBatches(FRHICommandListBase& RHICmdList, int32 NumBatches)
+	{
+		if (NumBatches <= 0)
+		{
+			return;
+		}
+
+		// Several updates to the same stream can be queued before we get here, only the last upload of each stream has to reach the GPU.
+		// The builder already dropped the superseded tasks within each batch, so only later batches can supersede a batch's tasks.
+		// Only batches applied here count, a batch left waiting would take the uploads of one applied now while its other tasks still run.
+		TSet<FRealtimeMeshProxyStreamTaskKey> StreamsReplacedLater;
+		for (int32 BatchIndex = NumBatches - 1; BatchIndex >= 0; BatchIndex--)
+		{
+			FRealtimeMeshProxyUpdateBuilder::RemoveSupersededStreamTasks(PendingBatches[BatchIndex].Tasks, StreamsReplacedLater);
+
+			for (const FRealtimeMeshProxyTask& Task : PendingBatches[BatchIndex].Tasks)
 			{
-				Task(RHICmdList, *this);
+				if (Task.bReplacesStream)
+				{
+					StreamsReplacedLater.Add(Task.StreamKey.GetValue());
+				}
+			}
+		}
+
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
+		{
+			const FCommandBatch& Batch = PendingBatches[BatchIndex];
+			for (const FRealtimeMeshProxyTask& Task : Batch.Tasks)
+			{
+				Task.Function(RHICmdList, *this);
 			}
-			Entry->ThreadState->FinalizeRenderThread(ERealtimeMeshProxyUpdateStatus::Updated);
-			bHadAnyUpdates = true;
+			Batch.ThreadState->FinalizeRenderThread(ERealtimeMeshProxyUpdateStatus::Updated);
 		}
+		PendingBatches.RemoveAt(0, NumBatches);
 
-		if (bHadAnyUpdates)
+		UpdatedCachedState(RHICmdList);
+	}
+
+	void FRealtimeMeshProxy::UpdatePendingUploadStats()
+	{
+		uint64 NewPendingBytes = 0;
+		for (const FCommandBatch& Batch : PendingBatches)
 		{
-			UpdatedCachedState(RHICmdList);
+			NewPendingBytes += Batch.GetUploadBytes();
 		}
+
+		// The stats cover every proxy, so each proxy only adds what changed since it last reported
+		const int64 BytesDelta = static_cast<int64>(NewPendingBytes) - static_cast<int64>(PendingUploadBytes);
+		const int32 BatchesDelta = PendingBatches.Num() - NumReportedPendingBatches;
+		const int64 TotalBytes = GRealtimeMeshDeferredUploadBytes.fetch_add(BytesDelta, std::memory_order_relaxed) + BytesDelta;
+		const int32 TotalBatches = GRealtimeMeshDeferredCommandBatches.fetch_add(BatchesDelta, std::memory_order_relaxed) + BatchesDelta;
+
+		PendingUploadBytes = NewPendingBytes;
+		NumReportedPendingBatches = PendingBatches.Num();
+
+		SET_MEMORY_STAT(STAT_RealtimeMeshProxy_DeferredUploadBytes, TotalBytes);
+		SET_DWORD_STAT(STAT_RealtimeMeshProxy_DeferredCommandBatches, TotalBatches);
+	}
+
+	int32 FRealtimeMeshProxy::GetNumBatchesBeforeProxyRecreate() const
+	{
+		const int32 FirstRecreateIndex = PendingBatches.IndexOfByPredicate([](const FCommandBatch& Batch) { return Batch.bRequiresProxyRecreate; });
+		return FirstRecreateIndex != INDEX_NONE ? FirstRecreateIndex : PendingBatches.Num();
+	}
+
+	void FRealtimeMeshProxy::RequestProxyRecreate()
+	{
+		if (bRecreateRequested)
+		{
+			return;
+		}
+		bRecreateRequested = true;
+
+		AsyncTask(ENamedThreads::GameThread, [SharedResourcesWeak = SharedResources.ToWeakPtr()]()
+		{
+			if (const auto PinnedSharedResources = SharedResourcesWeak.Pin())
+			{
+				if (PinnedSharedResources->OnRenderProxyRequiresUpdate().IsBound())
+				{
+					PinnedSharedResources->OnRenderProxyRequiresUpdate().Broadcast();
+				}
+			}
+		});
 	}
 
 	void FRealtimeMeshProxy::UpdatedCachedState(FRHICommandListBase& RHICmdList)
@@ -9,9 +9,16 @@
 #include "RenderProxy/RealtimeMeshLODProxy.h"
 #include "RenderProxy/RealtimeMeshProxy.h"
 #include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
+#include "RenderingThread.h"
+
+#include <atomic>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshProxy - Superseded Stream Tasks"), STAT_RealtimeMeshProxy_SupersededStreamTasks, STATGROUP_RealtimeMesh);
 
 namespace RealtimeMesh
 {
+	static std::atomic<uint64> GRealtimeMeshSupersededStreamTasks(0);
+
 	FRealtimeMeshCommandBatchIntermediateFuture::FRealtimeMeshCommandBatchIntermediateFuture(): FinalPromise(MakeShared<TPromise<ERealtimeMeshProxyUpdateStatus>>())
 	                                                                                            , Result(ERealtimeMeshProxyUpdateStatus::NoUpdate)
 	                                                                                            , bRenderThreadReady(false)
@@ -54,7 +61,7 @@ namespace RealtimeMesh
 	void FRealtimeMeshProxyUpdateBuilder::AddMeshTask(TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)>&& Function, bool bInRequiresProxyRecreate)
 	{
 		bRequiresProxyRecreate |= bInRequiresProxyRecreate;
-		Tasks.Add(MoveTemp(Function));
+		Tasks.Add(FRealtimeMeshProxyTask { MoveTemp(Function) });
 	}
 
 	void FRealtimeMeshProxyUpdateBuilder::AddLODTask(const FRealtimeMeshLODKey& LODKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshLODProxy&)>&& Function, bool bInRequiresProxyRecreate)
@@ -83,6 +90,23 @@ namespace RealtimeMesh
 		}, bInRequiresProxyRecreate);
 	}
 
+	void FRealtimeMeshProxyUpdateBuilder::AddSectionGroupStreamTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshStreamKey& StreamKey, uint64 UploadBytes,
+		TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionGroupProxy&)>&& Function, bool bReplacesStream, bool bInRequiresProxyRecreate)
+	{
+		const FRealtimeMeshProxyStreamTaskKey TaskKey { SectionGroupKey, StreamKey };
+
+		// Anything still queued for this stream would only be overwritten
+		if (bReplacesStream)
+		{
+			RemoveSupersededStreamTasks(Tasks, TSet<FRealtimeMeshProxyStreamTaskKey>({ TaskKey }));
+		}
+
+		AddSectionGroupTask(SectionGroupKey, MoveTemp(Function), bInRequiresProxyRecreate);
+		Tasks.Last().StreamKey = TaskKey;
+		Tasks.Last().bReplacesStream = bReplacesStream;
+		Tasks.Last().UploadBytes = UploadBytes;
+	}
+
 	void FRealtimeMeshProxyUpdateBuilder::AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionProxy&)>&& Function, bool bInRequiresProxyRecreate)
 	{
 		AddSectionGroupTask(SectionKey.SectionGroup(), [SectionKey, Func = MoveTemp(Function)](FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupProxy& SectionGroup)
@@ -98,6 +122,31 @@ namespace RealtimeMesh
 
 
 	
+	int32 FRealtimeMeshProxyUpdateBuilder::RemoveSupersededStreamTasks(TArray<FRealtimeMeshProxyTask>& InTasks, const TSet<FRealtimeMeshProxyStreamTaskKey>& ReplacedStreams)
+	{
+		if (ReplacedStreams.IsEmpty())
+		{
+			return 0;
+		}
+
+		const int32 NumRemoved = InTasks.RemoveAll([&ReplacedStreams](const FRealtimeMeshProxyTask& Task)
+		{
+			return Task.StreamKey.IsSet() && ReplacedStreams.Contains(Task.StreamKey.GetValue());
+		});
+
+		if (NumRemoved > 0)
+		{
+			INC_DWORD_STAT_BY(STAT_RealtimeMeshProxy_SupersededStreamTasks, NumRemoved);
+			GRealtimeMeshSupersededStreamTasks.fetch_add(NumRemoved, std::memory_order_relaxed);
+		}
+		return NumRemoved;
+	}
+
+	uint64 FRealtimeMeshProxyUpdateBuilder::GetNumSupersededStreamTasks()
+	{
+		return GRealtimeMeshSupersededStreamTasks.load(std::memory_order_relaxed);
+	}
+
 	TFuture<ERealtimeMeshProxyUpdateStatus> FRealtimeMeshProxyUpdateBuilder::Commit(const TSharedRef<const FRealtimeMesh>& Mesh)
 	{
 		// Skip if no tasks
@@ -121,7 +170,19 @@ namespace RealtimeMesh
 		{
 			Proxy->SetHasNaniteData_GT(bNewHasNaniteData.GetValue());
 		}
-		Proxy->EnqueueCommandBatch(MoveTemp(Tasks), ThreadState);
+		Proxy->EnqueueCommandBatch(MoveTemp(Tasks), ThreadState, bRequiresProxyRecreate);
+
+		// No scene proxy recreate is coming to apply this batch, and the view extension only gets to it when something renders.
+		if (!bRequiresProxyRecreate)
+		{
+			ENQUEUE_RENDER_COMMAND(RealtimeMeshProcessCommands)([ProxyWeak = Proxy.ToWeakPtr()](FRHICommandListImmediate& RHICmdList)
+			{
+				if (const FRealtimeMeshProxyPtr PinnedProxy = ProxyWeak.Pin())
+				{
+					PinnedProxy->ProcessCommands(RHICmdList, PinnedProxy->HasAnyReferencingComponents());
+				}
+			});
+		}
 
 		DoOnGameThread([ThreadState, MeshWeak = Mesh.ToWeakPtr(), bRecreateProxies = static_cast<bool>(bRequiresProxyRecreate)]()
 		{
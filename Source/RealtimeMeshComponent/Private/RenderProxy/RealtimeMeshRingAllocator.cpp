@@ -0,0 +1,121 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RenderProxy/RealtimeMeshRingAllocator.h"
+
+namespace RealtimeMesh
+{
+	FRealtimeMeshRingAllocator::FRealtimeMeshRingAllocator(uint64 InCapacity)
+		: Capacity(InCapacity)
+		, Head(0)
+		, Tail(0)
+		, UsedBytes(0)
+	{
+	}
+
+	void FRealtimeMeshRingAllocator::Reset(uint64 InCapacity)
+	{
+		Capacity = InCapacity;
+		Head = 0;
+		Tail = 0;
+		UsedBytes = 0;
+		PendingFences.Reset();
+	}
+
+	uint64 FRealtimeMeshRingAllocator::Allocate(uint64 Size, uint64 Alignment, uint64 Fence)
+	{
+		check(PendingFences.Num() == 0 || PendingFences.Last().Fence <= Fence);
+		Alignment = FMath::Max<uint64>(Alignment, 1);
+
+		if (Size == 0 || Size > Capacity)
+		{
+			return InvalidOffset;
+		}
+
+		// Start from the beginning whenever nothing is in flight, that gives the largest contiguous run
+		if (UsedBytes == 0)
+		{
+			Head = 0;
+			Tail = 0;
+		}
+
+		uint64 Offset = InvalidOffset;
+		const uint64 AlignedHead = AlignArbitrary(Head, Alignment);
+
+		if (UsedBytes == 0 || Head > Tail)
+		{
+			// The free space is [Head, Capacity) followed by [0, Tail)
+			if (AlignedHead + Size <= Capacity)
+			{
+				Offset = AlignedHead;
+			}
+			else if (Size <= Tail)
+			{
+				Offset = 0;
+			}
+		}
+		else if (Head < Tail)
+		{
+			// Already wrapped, the free space is [Head, Tail)
+			if (AlignedHead + Size <= Tail)
+			{
+				Offset = AlignedHead;
+			}
+		}
+		// Head == Tail with data in flight means the ring is full
+
+		if (Offset == InvalidOffset)
+		{
+			return InvalidOffset;
+		}
+
+		// Anything skipped to align or to wrap stays reserved until this fence is released
+		const uint64 NewHead = Offset + Size;
+		const uint64 Consumed = Offset >= Head ? NewHead - Head : (Capacity - Head) + NewHead;
+
+		if (PendingFences.Num() > 0 && PendingFences.Last().Fence == Fence)
+		{
+			PendingFences.Last().End = NewHead;
+			PendingFences.Last().Size += Consumed;
+		}
+		else
+		{
+			PendingFences.Add({ Fence, NewHead, Consumed });
+		}
+
+		Head = NewHead == Capacity ? 0 : NewHead;
+		UsedBytes += Consumed;
+		check(UsedBytes <= Capacity);
+		return Offset;
+	}
+
+	void FRealtimeMeshRingAllocator::RetainNewest(uint64 Fence)
+	{
+		if (PendingFences.Num() > 0 && PendingFences.Last().Fence < Fence)
+		{
+			PendingFences.Last().Fence = Fence;
+		}
+	}
+
+	void FRealtimeMeshRingAllocator::Release(uint64 CompletedFence)
+	{
+		int32 NumReleased = 0;
+		while (NumReleased < PendingFences.Num() && PendingFences[NumReleased].Fence <= CompletedFence)
+		{
+			const FFenceBlock& Block = PendingFences[NumReleased];
+			Tail = Block.End == Capacity ? 0 : Block.End;
+			UsedBytes -= Block.Size;
+			NumReleased++;
+		}
+
+		if (NumReleased > 0)
+		{
+			PendingFences.RemoveAt(0, NumReleased);
+		}
+
+		if (UsedBytes == 0)
+		{
+			Head = 0;
+			Tail = 0;
+		}
+	}
+}
@@ -12,13 +12,35 @@
 #include "RenderProxy/RealtimeMeshVertexFactory.h"
 #include "Materials/Material.h"
 
+#include <atomic>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshSectionGroupProxy - Vertex Factory Rebuilds"), STAT_RealtimeMeshSectionGroupProxy_VertexFactoryRebuilds, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshSectionGroupProxy - Ring Allocations"), STAT_RealtimeMeshSectionGroupProxy_RingAllocations, STATGROUP_RealtimeMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RealtimeMeshSectionGroupProxy - Ring Overflow Grows"), STAT_RealtimeMeshSectionGroupProxy_RingOverflowGrows, STATGROUP_RealtimeMesh);
+
 namespace RealtimeMesh
 {
+	static std::atomic<uint64> GRealtimeMeshVertexFactoryRebuilds(0);
+	static std::atomic<uint64> GRealtimeMeshRingOverflowGrows(0);
+
+	uint64 FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds()
+	{
+		return GRealtimeMeshVertexFactoryRebuilds.load(std::memory_order_relaxed);
+	}
+
+	uint64 FRealtimeMeshSectionGroupProxy::GetNumRingOverflowGrows()
+	{
+		return GRealtimeMeshRingOverflowGrows.load(std::memory_order_relaxed);
+	}
+
 	FRealtimeMeshSectionGroupProxy::FRealtimeMeshSectionGroupProxy(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionGroupKey& InKey)
 		: SharedResources(InSharedResources)
 		, Key(InKey)
 		, VertexFactory(SharedResources->CreateVertexFactory())
+		, RingBaseVertex(0)
+		, bRingDirty(false)
 		, bVertexFactoryDirty(false)
+		, bRayTracingDirty(false)
 	{
 	}
 
@@ -57,6 +79,13 @@ namespace RealtimeMesh
 	{
 		if (Config != NewConfig)
 		{
+			// Interleaved groups need a factory compiled without manual vertex fetch
+			if (Config.bInterleaveVertexStreams != NewConfig.bInterleaveVertexStreams && VertexFactory)
+			{
+				VertexFactory->ReleaseResource();
+				VertexFactory.Reset();
+			}
+			
 			Config = NewConfig;
 			bVertexFactoryDirty = true;
 		}
@@ -99,16 +128,45 @@ namespace RealtimeMesh
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::CreateOrUpdateStream);
 
+		const FRealtimeMeshStreamKey StreamKey = InStream->GetStreamKey();
+		const TSharedPtr<FRealtimeMeshGPUBuffer> ExistingBuffer = Streams.FindRef(StreamKey);
+
+		// Dynamic vertex streams are suballocated from the group's ring, so changing their size doesn't create a new buffer
+		if (UpdateRingStream(RHICmdList, InStream))
+		{
+			return;
+		}
+
+		// Same layout and size, write over the existing buffer so the vertex factory and its uniform buffer stay valid
+		if (ExistingBuffer && FRealtimeMeshGPUBuffer::ShouldReuseBuffersInPlace() && ExistingBuffer->CanApplyInPlaceUpdate(InStream))
+		{
+			const int32 PreviousNum = ExistingBuffer->Num();
+			ExistingBuffer->ApplyInPlaceUpdate(RHICmdList, InStream);
+
+			// A pooled buffer can take a different number of rows within its slack, which changes the valid range
+			if (ExistingBuffer->Num() != PreviousNum)
+			{
+				bVertexFactoryDirty = true;
+			}
+
+			// Ray tracing geometry has to be rebuilt if the positions or triangles changed
+			if (StreamKey == FRealtimeMeshStreams::Position || StreamKey == FRealtimeMeshStreams::Triangles)
+			{
+				bRayTracingDirty = true;
+			}
+			return;
+		}
+
 		// If we didn't create the buffers async, create them now
 		InStream->FinalizeInitialization(RHICmdList);
 
 		check(InStream->GetBuffer().IsValid() && InStream->GetBuffer()->GetSize() > 0);
 
 		// Release any existing stream
-		if (const TSharedPtr<FRealtimeMeshGPUBuffer>* FoundBuffer = Streams.Find(InStream->GetStreamKey()))
+		if (ExistingBuffer)
 		{			
-			(*FoundBuffer)->ReleaseUnderlyingResource();
-			Streams.Remove(InStream->GetStreamKey());
+			ExistingBuffer->ReleaseUnderlyingResource();
+			Streams.Remove(StreamKey);
 		}
 
 		// Create a new GPU buffer
@@ -117,7 +175,7 @@ namespace RealtimeMesh
 							: StaticCastSharedRef<FRealtimeMeshGPUBuffer>(MakeShared<FRealtimeMeshIndexBuffer>(InStream->GetBufferLayout()));
 
 		GPUBuffer->InitializeResources(RHICmdList, InStream);
-		Streams.Add(InStream->GetStreamKey(), GPUBuffer);
+		Streams.Add(StreamKey, GPUBuffer);
 
 		check(GPUBuffer);
 		check(GPUBuffer->IsResourceInitialized());
@@ -125,6 +183,42 @@ namespace RealtimeMesh
 		bVertexFactoryDirty = true;
 	}
 
+	void FRealtimeMeshSectionGroupProxy::UpdateStreamRange(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::UpdateStreamRange);
+
+		const FRealtimeMeshStreamKey StreamKey = InStream->GetStreamKey();
+		const TSharedPtr<FRealtimeMeshGPUBuffer> GPUBuffer = Streams.FindRef(StreamKey);
+
+		// Ring streams are patched in their staged rows, the whole group moves to a new region when the update is committed
+		if (GPUBuffer && GPUBuffer->GetStreamType() == ERealtimeMeshStreamType::Vertex)
+		{
+			const TSharedPtr<FRealtimeMeshVertexBuffer> VertexBuffer = StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(GPUBuffer);
+			if (VertexBuffer->IsRingBuffer() && VertexBuffer->StageRingUpdate(InStream))
+			{
+				bRingDirty = true;
+				return;
+			}
+		}
+
+		// The buffer, its SRV and the vertex factory bindings all stay valid, we only write the changed rows
+		if (GPUBuffer && GPUBuffer->CanApplyRangeUpdate(InStream))
+		{
+			GPUBuffer->ApplyRangeUpdate(RHICmdList, InStream);
+
+			// Ray tracing geometry has to be rebuilt if the positions or triangles changed
+			if (StreamKey == FRealtimeMeshStreams::Position || StreamKey == FRealtimeMeshStreams::Triangles)
+			{
+				bRayTracingDirty = true;
+			}
+		}
+		else
+		{
+			UE_LOG(LogRealtimeMesh, Warning, TEXT("Unable to apply range update to stream %s in section group %s. Range is outside the existing buffer or the layout differs."),
+				*StreamKey.ToString(), *Key.ToString());
+		}
+	}
+
 	void FRealtimeMeshSectionGroupProxy::RemoveStream(const FRealtimeMeshStreamKey& StreamKey)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::RemoveStream);
@@ -148,6 +242,7 @@ namespace RealtimeMesh
 
 		FMeshBatchElement& BatchElement = MeshBatch.Elements[0];		
 		BatchElement.IndexBuffer = &VertexFactory->GetIndexBuffer(bWantsDepthOnly, bIsLocalToWorldDeterminantNegative, Resources);
+		BatchElement.BaseVertexIndex = VertexFactory->GetBaseVertexIndex();
 		MeshBatch.VertexFactory = VertexFactory.Get();
 		//MeshBatch.MaterialRenderProxy = Mat;
 		
@@ -201,16 +296,30 @@ namespace RealtimeMesh
 
 		// Handle the vertex factory first so sections can query it
 
-		bool bNeedsFactoryInitialization = bVertexFactoryDirty || !VertexFactory->IsInitialized() ||
-			Algo::AnyOf(Sections, [](const FRealtimeMeshSectionProxyRef& Section) { return Section->IsRangeDirty(); });
-		
 		if (!VertexFactory)
 		{
-			VertexFactory = SharedResources->CreateVertexFactory();
+			VertexFactory = Config.bInterleaveVertexStreams? SharedResources->CreateInterleavedVertexFactory() : SharedResources->CreateVertexFactory();
+		}
+
+		// Write the staged ring streams to their next region, this only moves the base vertex so the factory stays as it is
+		const bool bRingCommitted = bRingDirty;
+		if (bRingDirty)
+		{
+			CommitVertexRing(RHICmdList);
+		}
+		if (bRingCommitted || VertexFactory->GetBaseVertexIndex() != RingBaseVertex)
+		{
+			VertexFactory->SetVertexWindow(RHICmdList, RingBaseVertex, GetNumRingVertices());
 		}
 
+		// The valid range of a ring group is kept up to date by SetVertexWindow, so section range changes don't need a rebuild there
+		bool bNeedsFactoryInitialization = bVertexFactoryDirty || !VertexFactory->IsInitialized() ||
+			(!HasVertexRing() && Algo::AnyOf(Sections, [](const FRealtimeMeshSectionProxyRef& Section) { return Section->IsRangeDirty(); }));
+
 		if (bNeedsFactoryInitialization)
 		{
+			INC_DWORD_STAT(STAT_RealtimeMeshSectionGroupProxy_VertexFactoryRebuilds);
+			GRealtimeMeshVertexFactoryRebuilds.fetch_add(1, std::memory_order_relaxed);
 			VertexFactory->Initialize(RHICmdList, Streams);
 		}
 		
@@ -239,9 +348,10 @@ namespace RealtimeMesh
 			DrawMask.SetFlag(Config.DrawType == ERealtimeMeshSectionDrawType::Static ? ERealtimeMeshDrawMask::DrawStatic : ERealtimeMeshDrawMask::DrawDynamic);
 		}
 
-		if (bNeedsFactoryInitialization)
+		if (bNeedsFactoryInitialization || bRayTracingDirty)
 		{
 			DrawMask.SetFlag(UpdateRayTracingInfo(RHICmdList)? ERealtimeMeshDrawMask::RayTracing : ERealtimeMeshDrawMask::None);
+			bRayTracingDirty = false;
 		}
 	}
 
@@ -264,6 +374,9 @@ namespace RealtimeMesh
 			Stream.Value->ReleaseUnderlyingResource();
 		}
 		Streams.Empty();
+		VertexRing.Reset(0);
+		RingBaseVertex = 0;
+		bRingDirty = false;
 
 		// Reset the sections and clear them
 		for (const auto& Section : Sections)
@@ -283,7 +396,9 @@ namespace RealtimeMesh
 		
 		RayTracingGeometry.ReleaseResource();
 
-		bool bShouldGenerateRayTracingGeometry = DrawMask.HasAnyFlags() && VertexFactory.IsValid() && IsRayTracingEnabled();
+		// Interleaved groups don't have a ray tracing capable vertex factory
+		bool bShouldGenerateRayTracingGeometry = DrawMask.HasAnyFlags() && VertexFactory.IsValid() && IsRayTracingEnabled() &&
+			!Config.bInterleaveVertexStreams && Streams.Contains(FRealtimeMeshStreams::Position);
 
 		// We need to check if the sections are contiguous with no gaps and using the entire index buffer...
 		// If it is not then we weed to allocate a ray tracing index buffer and pack the active sections down into it.
@@ -334,7 +449,7 @@ namespace RealtimeMesh
 				{
 					FRayTracingGeometrySegment Segment;
 					Segment.VertexBuffer = PositionStream->VertexBufferRHI;
-					Segment.VertexBufferOffset = 0; 
+					Segment.VertexBufferOffset = VertexFactory->GetBaseVertexIndex() * PositionStream->GetStride();
 					Segment.MaxVertices = PositionStream->Num();
 					Segment.FirstPrimitive = Section->GetStreamRange().GetMinIndex() / 3;
 					Segment.NumPrimitives = Section->GetStreamRange().NumPrimitives(3);
@@ -358,6 +473,195 @@ namespace RealtimeMesh
 		return false;
 	}
 
+	bool FRealtimeMeshSectionGroupProxy::UpdateRingStream(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream)
+	{
+		const FRealtimeMeshStreamKey StreamKey = InStream->GetStreamKey();
+		if (!StreamKey.IsVertexStream())
+		{
+			return false;
+		}
+
+		if (!FRealtimeMeshGPUBuffer::ShouldUseRingBuffer(Config.DrawType, StreamKey))
+		{
+			// The ring was turned off or the group isn't dynamic anymore, the streams can't share a base vertex with buffers of their own
+			if (HasVertexRing())
+			{
+				ReleaseVertexRing(RHICmdList);
+			}
+			return false;
+		}
+
+		// A single row is bound with a zero stride so it reads the same from any base vertex, it keeps a buffer of its own
+		const uint32 NumRows = InStream->GetNumElements();
+		if (InStream->GetStream().GetResourceDataSize() == 0 || NumRows <= 1)
+		{
+			return false;
+		}
+
+		const TSharedPtr<FRealtimeMeshGPUBuffer> ExistingBuffer = Streams.FindRef(StreamKey);
+		TSharedPtr<FRealtimeMeshVertexBuffer> ExistingRingStream;
+		if (ExistingBuffer && ExistingBuffer->GetStreamType() == ERealtimeMeshStreamType::Vertex &&
+			StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(ExistingBuffer)->IsRingBuffer())
+		{
+			ExistingRingStream = StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(ExistingBuffer);
+		}
+
+		// Every multi row stream of the group has to be in the ring, or none of them
+		if (!ExistingRingStream)
+		{
+			for (const auto& Stream : Streams)
+			{
+				if (Stream.Key != StreamKey && Stream.Value->GetStreamType() == ERealtimeMeshStreamType::Vertex && Stream.Value->Num() > 1 &&
+					!StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(Stream.Value)->IsRingBuffer())
+				{
+					return false;
+				}
+			}
+		}
+
+		// The ring holds one region per frame in flight plus the one being written. It only grows once the streams outgrow it,
+		// rounded up so a stream that keeps growing a little doesn't replace the ring every time
+		const uint64 NumRegions = FRealtimeMeshGPUBuffer::GetRingFramesInFlight() + 1;
+		if (static_cast<uint64>(NumRows) * NumRegions > VertexRing.GetCapacity())
+		{
+			const uint64 NewCapacity = static_cast<uint64>(FMath::RoundUpToPowerOfTwo(NumRows)) * NumRegions;
+			VertexRing.Reset(NewCapacity);
+			ForEachRingStream([&](FRealtimeMeshVertexBuffer& RingStream)
+			{
+				RingStream.ResizeRing(RHICmdList, static_cast<uint32>(NewCapacity));
+			});
+			bVertexFactoryDirty = true;
+		}
+
+		if (!ExistingRingStream || !ExistingRingStream->StageRingUpdate(InStream))
+		{
+			// Not in the ring yet or a different layout
+			if (ExistingBuffer)
+			{
+				ExistingBuffer->ReleaseUnderlyingResource();
+				Streams.Remove(StreamKey);
+			}
+
+			const TSharedRef<FRealtimeMeshVertexBuffer> RingStream = MakeShared<FRealtimeMeshVertexBuffer>(InStream->GetBufferLayout());
+			RingStream->InitializeRingResources(RHICmdList, InStream, static_cast<uint32>(VertexRing.GetCapacity()));
+			Streams.Add(StreamKey, RingStream);
+			bVertexFactoryDirty = true;
+		}
+
+		bRingDirty = true;
+		return true;
+	}
+
+	void FRealtimeMeshSectionGroupProxy::CommitVertexRing(FRHICommandListBase& RHICmdList)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshSectionGroupProxy::CommitVertexRing);
+
+		bRingDirty = false;
+
+		const uint32 NumRows = GetNumRingRows();
+		if (NumRows == 0)
+		{
+			// The last ring stream was removed or replaced
+			VertexRing.Reset(0);
+			RingBaseVertex = 0;
+			return;
+		}
+
+		// The bound region is drawn until this update replaces it, so it's held as long as anything written this frame.
+		// The render thread frame number is only a proxy for GPU progress, not a real fence. It assumes the GPU is never
+		// more than FramesInFlight frames behind the render thread, which the RHI's own frame pacing normally keeps true
+		const uint64 Frame = GFrameNumberRenderThread;
+		const uint64 FramesInFlight = FRealtimeMeshGPUBuffer::GetRingFramesInFlight();
+		VertexRing.RetainNewest(Frame);
+		if (Frame > FramesInFlight)
+		{
+			VertexRing.Release(Frame - FramesInFlight);
+		}
+
+		uint64 FirstRow = VertexRing.Allocate(NumRows, 1, Frame);
+		if (FirstRow == FRealtimeMeshRingAllocator::InvalidOffset)
+		{
+			// Every region is still in flight, which takes several updates of the group within a few frames. Rather than
+			// stalling the render thread on the GPU the ring moves to larger buffers, the RHI keeps the old ones alive until
+			// the GPU is done with them. The streams are rebound, so the vertex factory has to be rebuilt
+			INC_DWORD_STAT(STAT_RealtimeMeshSectionGroupProxy_RingOverflowGrows);
+			GRealtimeMeshRingOverflowGrows.fetch_add(1, std::memory_order_relaxed);
+
+			const uint64 NumRegions = FramesInFlight + 1;
+			const uint64 NewCapacity = FMath::Max(VertexRing.GetCapacity() * 2, static_cast<uint64>(FMath::RoundUpToPowerOfTwo(NumRows)) * NumRegions);
+			VertexRing.Reset(NewCapacity);
+			ForEachRingStream([&](FRealtimeMeshVertexBuffer& RingStream)
+			{
+				RingStream.ResizeRing(RHICmdList, static_cast<uint32>(NewCapacity));
+			});
+			bVertexFactoryDirty = true;
+
+			FirstRow = VertexRing.Allocate(NumRows, 1, Frame);
+			check(FirstRow != FRealtimeMeshRingAllocator::InvalidOffset);
+		}
+
+		INC_DWORD_STAT(STAT_RealtimeMeshSectionGroupProxy_RingAllocations);
+
+		// Every ring stream is written to the same rows, they all share the one base vertex
+		ForEachRingStream([&](FRealtimeMeshVertexBuffer& RingStream)
+		{
+			RingStream.UploadRingRows(RHICmdList, static_cast<uint32>(FirstRow));
+		});
+		RingBaseVertex = static_cast<uint32>(FirstRow);
+
+		// The ray tracing geometry reads the positions at the region's offset
+		bRayTracingDirty = true;
+	}
+
+	void FRealtimeMeshSectionGroupProxy::ReleaseVertexRing(FRHICommandListBase& RHICmdList)
+	{
+		ForEachRingStream([&](FRealtimeMeshVertexBuffer& RingStream)
+		{
+			RingStream.ReleaseRing(RHICmdList);
+		});
+
+		VertexRing.Reset(0);
+		RingBaseVertex = 0;
+		bRingDirty = false;
+		bVertexFactoryDirty = true;
+		bRayTracingDirty = true;
+	}
+
+	void FRealtimeMeshSectionGroupProxy::ForEachRingStream(TFunctionRef<void(FRealtimeMeshVertexBuffer&)> Func) const
+	{
+		for (const auto& Stream : Streams)
+		{
+			if (Stream.Value->GetStreamType() == ERealtimeMeshStreamType::Vertex)
+			{
+				FRealtimeMeshVertexBuffer& VertexBuffer = static_cast<FRealtimeMeshVertexBuffer&>(*Stream.Value);
+				if (VertexBuffer.IsRingBuffer())
+				{
+					Func(VertexBuffer);
+				}
+			}
+		}
+	}
+
+	uint32 FRealtimeMeshSectionGroupProxy::GetNumRingRows() const
+	{
+		uint32 NumRows = 0;
+		ForEachRingStream([&](FRealtimeMeshVertexBuffer& RingStream)
+		{
+			NumRows = FMath::Max(NumRows, static_cast<uint32>(RingStream.Num()));
+		});
+		return NumRows;
+	}
+
+	int32 FRealtimeMeshSectionGroupProxy::GetNumRingVertices() const
+	{
+		int32 NumVertices = TNumericLimits<int32>::Max();
+		ForEachRingStream([&](FRealtimeMeshVertexBuffer& RingStream)
+		{
+			NumVertices = FMath::Min(NumVertices, RingStream.Num());
+		});
+		return NumVertices == TNumericLimits<int32>::Max()? 0 : NumVertices;
+	}
+
 	void FRealtimeMeshSectionGroupProxy::RebuildSectionMap()
 	{
 		SectionMap.Empty();
@@ -0,0 +1,84 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RenderProxy/RealtimeMeshUploadScheduler.h"
+#include "Algo/StableSort.h"
+
+namespace RealtimeMesh
+{
+	FRealtimeMeshUploadScheduler::FRealtimeMeshUploadScheduler()
+		: BudgetBytes(0)
+		, MaxDeferFrames(0)
+		, CurrentFrame(0)
+		, UsedBytes(0)
+		, NumGranted(0)
+	{
+	}
+
+	void FRealtimeMeshUploadScheduler::BeginFrame(uint64 Frame, uint64 InBudgetBytes, uint32 InMaxDeferFrames)
+	{
+		BudgetBytes = InBudgetBytes;
+		MaxDeferFrames = InMaxDeferFrames;
+
+		if (Frame != CurrentFrame)
+		{
+			CurrentFrame = Frame;
+			UsedBytes = 0;
+			NumGranted = 0;
+		}
+	}
+
+	bool FRealtimeMeshUploadScheduler::TryConsume(const FBatch& Batch)
+	{
+		const bool bFits = !IsEnabled()
+			|| NumGranted == 0
+			|| (MaxDeferFrames > 0 && Batch.FramesWaited >= MaxDeferFrames)
+			|| UsedBytes + Batch.Bytes <= BudgetBytes;
+
+		if (bFits)
+		{
+			UsedBytes += Batch.Bytes;
+			NumGranted++;
+		}
+		return bFits;
+	}
+
+	TArray<int32> FRealtimeMeshUploadScheduler::Schedule(TConstArrayView<FOwner> Owners)
+	{
+		TArray<int32> Order;
+		Order.Reserve(Owners.Num());
+		for (int32 Index = 0; Index < Owners.Num(); Index++)
+		{
+			Order.Add(Index);
+		}
+
+		// Stable so owners that tie keep the order they were passed in
+		Algo::StableSort(Order, [&Owners](int32 A, int32 B)
+		{
+			if (Owners[A].Priority != Owners[B].Priority)
+			{
+				return Owners[A].Priority > Owners[B].Priority;
+			}
+			const uint32 WaitedA = Owners[A].Batches.Num() > 0 ? Owners[A].Batches[0].FramesWaited : 0;
+			const uint32 WaitedB = Owners[B].Batches.Num() > 0 ? Owners[B].Batches[0].FramesWaited : 0;
+			return WaitedA > WaitedB;
+		});
+
+		TArray<int32> Granted;
+		Granted.SetNumZeroed(Owners.Num());
+
+		for (const int32 OwnerIndex : Order)
+		{
+			// A batch that doesn't fit holds back everything queued after it on the same owner, smaller work of other owners can still fit
+			for (const FBatch& Batch : Owners[OwnerIndex].Batches)
+			{
+				if (!TryConsume(Batch))
+				{
+					break;
+				}
+				Granted[OwnerIndex]++;
+			}
+		}
+
+		return Granted;
+	}
+}
@@ -139,19 +139,21 @@ namespace RealtimeMesh
 
 	
 
-	TUniformBufferRef<FLocalVertexFactoryUniformShaderParameters> CreateRealtimeMeshVFUniformBuffer(
+	static FLocalVertexFactoryUniformShaderParameters GetRealtimeMeshVFUniformParameters(
 		const FRealtimeMeshLocalVertexFactory* RealtimeMeshVertexFactory, uint32 LODLightmapDataIndex)
 	{
 		FLocalVertexFactoryUniformShaderParameters UniformParameters;
 
 		constexpr FColorVertexBuffer* OverrideColorVertexBuffer = nullptr;
-		constexpr int32 BaseVertexIndex = 0;
+		// Only non zero for ring backed section groups, where manual fetch has to add it itself on platforms whose vertex id doesn't include it
+		const int32 BaseVertexIndex = static_cast<int32>(RealtimeMeshVertexFactory->GetBaseVertexIndex());
 		constexpr int32 PreSkinBaseVertexIndex = 0;
 
 		UniformParameters.LODLightmapDataIndex = LODLightmapDataIndex;
 		int32 ColorIndexMask = 0;
 
-		if (RHISupportsManualVertexFetch(GMaxRHIShaderPlatform))
+		// Interleaved factories are compiled without manual vertex fetch and have no per stream views
+		if (RHISupportsManualVertexFetch(GMaxRHIShaderPlatform) && RealtimeMeshVertexFactory->GetPositionsSRV() != nullptr)
 		{
 			UniformParameters.VertexFetch_PositionBuffer = RealtimeMeshVertexFactory->GetPositionsSRV();
 			UniformParameters.VertexFetch_PreSkinPositionBuffer = RealtimeMeshVertexFactory->GetPreSkinPositionSRV();
@@ -191,7 +193,14 @@ namespace RealtimeMesh
 		UniformParameters.VertexFetch_Parameters = {ColorIndexMask, NumTexCoords, LightMapCoordinateIndex, EffectiveBaseVertexIndex};
 		UniformParameters.PreSkinBaseVertexIndex = EffectivePreSkinBaseVertexIndex;
 
-		return TUniformBufferRef<FLocalVertexFactoryUniformShaderParameters>::CreateUniformBufferImmediate(UniformParameters, UniformBuffer_MultiFrame);
+		return UniformParameters;
+	}
+
+	TUniformBufferRef<FLocalVertexFactoryUniformShaderParameters> CreateRealtimeMeshVFUniformBuffer(
+		const FRealtimeMeshLocalVertexFactory* RealtimeMeshVertexFactory, uint32 LODLightmapDataIndex)
+	{
+		return TUniformBufferRef<FLocalVertexFactoryUniformShaderParameters>::CreateUniformBufferImmediate(
+			GetRealtimeMeshVFUniformParameters(RealtimeMeshVertexFactory, LODLightmapDataIndex), UniformBuffer_MultiFrame);
 	}
 
 
@@ -331,6 +340,181 @@ namespace RealtimeMesh
 		}
 	}
 
+	void FRealtimeMeshInterleavedVertexFactory::Initialize(FRHICommandListBase& RHICmdList, const TMap<FRealtimeMeshStreamKey, TSharedPtr<FRealtimeMeshGPUBuffer>>& Buffers)
+	{
+		const TSharedPtr<FRealtimeMeshVertexBuffer> InterleavedBuffer =
+			StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(FindBuffer(Buffers, ERealtimeMeshStreamType::Vertex, FRealtimeMeshStreams::InterleavedStreamName));
+
+		// Nothing packed yet, bind the separate streams through the declaration like the local factory
+		if (!InterleavedBuffer.IsValid() || !InterleavedBuffer->IsInterleaved())
+		{
+			FRealtimeMeshLocalVertexFactory::Initialize(RHICmdList, Buffers);
+			return;
+		}
+
+		const FRealtimeMeshInterleavedLayout& Layout = InterleavedBuffer->GetInterleavedLayout();
+		
+		FDataType DataType;
+
+		InUseVertexBuffers.Empty();
+		InUseVertexBuffers.Add(InterleavedBuffer);
+		bool bIsValid = true;
+
+		const FInt32Range ValidVertexRange(0, InterleavedBuffer->Num());
+		FInt32Range ValidIndexRange(0, TNumericLimits<int32>::Max());
+
+		// Binds NumElements consecutive elements of a packed stream as one component, returns false if the stream wasn't packed
+		const auto BindElements = [&](FVertexStreamComponent& OutStreamComponent, const FRealtimeMeshStreamKey& StreamKey, int32 ElementIndex, int32 NumElements, EVertexStreamUsage Usage)
+		{
+			const FRealtimeMeshInterleavedElement* Element = Layout.Find(StreamKey);
+			if (Element == nullptr || ElementIndex + NumElements > Element->Layout.GetNumElements())
+			{
+				return false;
+			}
+
+			const FRealtimeMeshElementType SourceType = Element->Layout.GetElementType();
+			const FRealtimeMeshElementType ComponentType(SourceType.GetDatumType(), SourceType.GetNumDatums() * NumElements);
+			const EVertexElementType VertexType = FRealtimeMeshBufferLayoutUtilities::GetElementTypeDetails(ComponentType).GetVertexType();
+			if (VertexType == VET_None)
+			{
+				return false;
+			}
+
+			const uint32 ElementStride = Element->Size / Element->Layout.GetNumElements();
+			OutStreamComponent = FVertexStreamComponent(InterleavedBuffer.Get(), Element->Offset + ElementIndex * ElementStride, Layout.GetStride(), VertexType, Usage);
+			return true;
+		};
+
+		// Bind Position
+		bIsValid &= BindElements(DataType.PositionComponent, FRealtimeMeshStreams::Position, 0, 1, EVertexStreamUsage::Default);
+
+		// Bind Tangents
+		if (!BindElements(DataType.TangentBasisComponents[0], FRealtimeMeshStreams::Tangents, 0, 1, EVertexStreamUsage::ManualFetch) ||
+			!BindElements(DataType.TangentBasisComponents[1], FRealtimeMeshStreams::Tangents, 1, 1, EVertexStreamUsage::ManualFetch))
+		{
+			DataType.TangentBasisComponents[0] = FVertexStreamComponent(&GRealtimeMeshNullTangentVertexBuffer, 0, 0, VET_Short4, EVertexStreamUsage::ManualFetch);
+			DataType.TangentBasisComponents[1] = FVertexStreamComponent(&GRealtimeMeshNullTangentVertexBuffer, sizeof(FPackedRGBA16N), 0, VET_Short4, EVertexStreamUsage::ManualFetch);
+		}
+
+		// Bind Color, a single color was already repeated for every row when packing
+		if (!BindElements(DataType.ColorComponent, FRealtimeMeshStreams::Color, 0, 1, EVertexStreamUsage::ManualFetch))
+		{
+			DataType.ColorComponent = FVertexStreamComponent(&GRealtimeMeshNullColorVertexBuffer, 0, 0, VET_Color, EVertexStreamUsage::ManualFetch);
+		}
+
+		// Bind TexCoords, in pairs where the doubled type is a valid vertex format
+		DataType.NumTexCoords = 0;
+		DataType.TextureCoordinates.Empty();
+		if (const FRealtimeMeshInterleavedElement* TexCoordElement = Layout.Find(FRealtimeMeshStreams::TexCoords))
+		{
+			const int32 NumTexCoords = TexCoordElement->Layout.GetNumElements();
+			for (int32 Index = 0; Index < NumTexCoords && DataType.TextureCoordinates.Num() < MAX_STATIC_TEXCOORDS / 2;)
+			{
+				FVertexStreamComponent Component;
+				const int32 NumBound = (NumTexCoords - Index >= 2 && BindElements(Component, FRealtimeMeshStreams::TexCoords, Index, 2, EVertexStreamUsage::ManualFetch))? 2 :
+					BindElements(Component, FRealtimeMeshStreams::TexCoords, Index, 1, EVertexStreamUsage::ManualFetch)? 1 : 0;
+				if (NumBound == 0)
+				{
+					bIsValid = false;
+					break;
+				}
+				DataType.TextureCoordinates.Add(Component);
+				Index += NumBound;
+			}
+			DataType.NumTexCoords = NumTexCoords;
+		}
+		else
+		{
+			DataType.NumTexCoords = 1;
+			DataType.TextureCoordinates.Add(FVertexStreamComponent(&GRealtimeMeshNullTexCoordVertexBuffer, 0, 0, VET_Float2, EVertexStreamUsage::ManualFetch));
+		}
+
+		// Bind all index buffers
+		BindIndexBuffer(bIsValid, ValidIndexRange, IndexBuffer, Buffers, FRealtimeMeshStreams::TrianglesStreamName);
+		bIsValid &= IndexBuffer != nullptr;
+
+		ReleaseResource();
+
+		if (bIsValid)
+		{
+			Data = DataType;
+			ValidRange = FRealtimeMeshStreamRange(ValidVertexRange, ValidIndexRange);
+			
+			InitResource(RHICmdList);
+		}
+		else
+		{
+			Data = FDataType();
+			ValidRange = FRealtimeMeshStreamRange(0, 0, 0, 0);
+			InUseVertexBuffers.Empty();
+		}
+	}
+
+	bool FRealtimeMeshLocalVertexFactory::CanFetchStreamLayout(const FRealtimeMeshStreamKey& StreamKey, const FRealtimeMeshBufferLayout& Layout)
+	{
+		if (StreamKey == FRealtimeMeshStreams::Position)
+		{
+			return Layout.GetElementType() != GetRealtimeMeshDataElementType<FRealtimeMeshQuantizedPosition>();
+		}
+
+		if (StreamKey == FRealtimeMeshStreams::Tangents)
+		{
+			return Layout.GetElementType() != GetRealtimeMeshDataElementType<FRealtimeMeshOctahedralNormal>() &&
+				Layout.GetElementType() != GetRealtimeMeshDataElementType<FRealtimeMeshPackedRGB10A2N>();
+		}
+
+		return true;
+	}
+
+	bool FRealtimeMeshLocalVertexFactory::DecodeStreamForFetch(FRealtimeMeshStream& Stream, const FRealtimeMeshPositionQuantization& PositionQuantization)
+	{
+		if (CanFetchStreamLayout(Stream.GetStreamKey(), Stream.GetLayout()))
+		{
+			return false;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshLocalVertexFactory::DecodeStreamForFetch);
+
+		if (Stream.GetStreamKey() == FRealtimeMeshStreams::Position)
+		{
+			FRealtimeMeshStream DecodedStream(Stream.GetStreamKey(), GetRealtimeMeshBufferLayout<FVector3f>());
+			DecodedStream.SetNumUninitialized(Stream.Num());
+
+			// Read through a const view so shared storage isn't detached just to decode it
+			const FRealtimeMeshQuantizedPosition* QuantizedPositions = AsConst(Stream).GetData<FRealtimeMeshQuantizedPosition>();
+			FVector3f* Positions = DecodedStream.GetData<FVector3f>();
+			for (int32 Index = 0; Index < Stream.Num(); Index++)
+			{
+				Positions[Index] = PositionQuantization.Dequantize(QuantizedPositions[Index]);
+			}
+
+			Stream = MoveTemp(DecodedStream);
+			return true;
+		}
+
+		return Stream.ConvertTo<FRealtimeMeshTangentsNormalPrecision>();
+	}
+
+	void FRealtimeMeshLocalVertexFactory::SetVertexWindow(FRHICommandListBase& RHICmdList, uint32 InBaseVertexIndex, int32 NumVertices)
+	{
+		const bool bBaseChanged = InBaseVertexIndex != BaseVertexIndex;
+		FRealtimeMeshVertexFactory::SetVertexWindow(RHICmdList, InBaseVertexIndex, NumVertices);
+
+		if (!IsInitialized())
+		{
+			return;
+		}
+
+		// The bindings didn't change, only how many of the rows hold the group's current vertices
+		ValidRange = FRealtimeMeshStreamRange(FInt32Range(0, NumVertices), ValidRange.Indices);
+
+		// Where the vertex id includes the draw's base vertex the views are already read at the right rows
+		if (bBaseChanged && UniformBuffer.IsValid() && !RHISupportsAbsoluteVertexID(GMaxRHIShaderPlatform))
+		{
+			UniformBuffer.UpdateUniformBufferImmediate(RHICmdList, GetRealtimeMeshVFUniformParameters(this, Data.LODLightmapDataIndex));
+		}
+	}
+
 	bool FRealtimeMeshLocalVertexFactory::GatherVertexBufferResources(FRealtimeMeshResourceReferenceList& ActiveResources) const
 	{
 		TArray<TSharedPtr<FRealtimeMeshVertexBuffer>> TempBuffers;
@@ -488,6 +672,13 @@ namespace RealtimeMesh
 		}
 	}
 
+	void FRealtimeMeshInterleavedVertexFactory::ModifyCompilationEnvironment(const FVertexFactoryShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		// Set first so the local factory doesn't turn it back on
+		OutEnvironment.SetDefine(TEXT("MANUAL_VERTEX_FETCH"), TEXT("0"));
+		FRealtimeMeshLocalVertexFactory::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	}
+
 	void FRealtimeMeshLocalVertexFactory::GetVertexElements(ERHIFeatureLevel::Type FeatureLevel, EVertexInputStreamType InputStreamType, bool bSupportsManualVertexFetch,
 		FDataType& Data, FVertexDeclarationElementList& Elements)
 	{
@@ -693,4 +884,17 @@ IMPLEMENT_VERTEX_FACTORY_TYPE(FRealtimeMeshLocalVertexFactory, "/Engine/Private/
                               | EVertexFactoryFlags::SupportsManualVertexFetch
 							  | EVertexFactoryFlags::SupportsPSOPrecaching
 							  | EVertexFactoryFlags::SupportsLumenMeshCards
+);
+
+IMPLEMENT_VERTEX_FACTORY_PARAMETER_TYPE(FRealtimeMeshInterleavedVertexFactory, SF_Vertex, FRealtimeMeshVertexFactoryShaderParameters);
+
+// Without manual vertex fetch the hit shaders can't read the attributes, so this type isn't used for ray tracing
+IMPLEMENT_VERTEX_FACTORY_TYPE(FRealtimeMeshInterleavedVertexFactory, "/Engine/Private/LocalVertexFactory.ush",
+                              EVertexFactoryFlags::UsedWithMaterials
+                              | EVertexFactoryFlags::SupportsDynamicLighting
+                              | EVertexFactoryFlags::SupportsPrecisePrevWorldPos
+                              | EVertexFactoryFlags::SupportsPositionOnly
+                              | EVertexFactoryFlags::SupportsCachingMeshDrawCommands
+                              | EVertexFactoryFlags::SupportsPrimitiveIdStream
+							  | EVertexFactoryFlags::SupportsLumenMeshCards
 );
\ No newline at end of file
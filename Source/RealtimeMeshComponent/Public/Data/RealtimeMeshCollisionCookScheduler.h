@@ -0,0 +1,121 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RealtimeMeshCollision.h"
+#include "Async/Future.h"
+#include <atomic>
+
+class FQueuedThreadPool;
+
+namespace RealtimeMesh
+{
+	/**
+	 * Handed to a collision cook so it can stop at safe points once a newer request for the same owner
+	 * has made it obsolete.
+	 */
+	struct FRealtimeMeshCollisionCookToken
+	{
+	private:
+		TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> bCancelled;
+	public:
+		FRealtimeMeshCollisionCookToken() = default;
+		FRealtimeMeshCollisionCookToken(const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& InCancelled)
+			: bCancelled(InCancelled) { }
+
+		bool IsCancelled() const { return bCancelled.IsValid() && bCancelled->load(std::memory_order_relaxed); }
+	};
+
+	struct FRealtimeMeshCollisionCookStats
+	{
+		/* Owners waiting for a cook slot */
+		int32 QueueDepth = 0;
+		/* Cooks currently running or waiting for their result to be applied */
+		int32 NumInFlight = 0;
+		/* Highest number of cooks that were running at the same time */
+		int32 MaxInFlight = 0;
+		uint64 NumScheduled = 0;
+		/* Requests merged into an already pending request for the same owner */
+		uint64 NumCoalesced = 0;
+		/* In flight cooks that were superseded before they finished */
+		uint64 NumCancelled = 0;
+		uint64 NumCompleted = 0;
+		/* Time from the oldest coalesced request being scheduled to its cook finishing */
+		double LastLatencySeconds = 0.0;
+		double MaxLatencySeconds = 0.0;
+	};
+
+	/**
+	 * Runs collision cooks on a dedicated worker pool.
+	 * Keeps at most one pending request per owner, so an owner edited every frame only cooks its latest state,
+	 * cancels in flight cooks that a newer request supersedes, and limits the number of concurrent cooks
+	 * through RealtimeMesh.Collision.MaxConcurrentCooks. A cook stays in flight until its result has been applied,
+	 * so a superseded cook can still be stopped between finishing on the worker and applying on the game thread.
+	 * Waiters of coalesced or cancelled requests receive the result of the request that replaced them.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshCollisionCookScheduler
+	{
+	public:
+		/* Runs on a worker thread. The returned future resolves once the cooked collision has been applied, which should check the token as well */
+		using FCookFunction = TUniqueFunction<TFuture<ERealtimeMeshCollisionUpdateResult>(const FRealtimeMeshCollisionCookToken&)>;
+
+	private:
+		struct FRequest
+		{
+			FCookFunction CookFunction;
+			TArray<TSharedRef<TPromise<ERealtimeMeshCollisionUpdateResult>>> Waiters;
+			double FirstScheduledTime = 0.0;
+		};
+
+		struct FOwnerState
+		{
+			TOptional<FRequest> Pending;
+			TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> InFlightCancelled;
+			bool bQueued = false;
+		};
+
+		class FCookWork;
+
+		mutable FCriticalSection Lock;
+		TMap<const void*, FOwnerState> Owners;
+		TArray<const void*> Queue;
+		FRealtimeMeshCollisionCookStats Stats;
+		TUniquePtr<FQueuedThreadPool> ThreadPool;
+		/* Lets cooks still waiting on the game thread apply know whether the scheduler is still around */
+		TSharedRef<uint8, ESPMode::ThreadSafe> AliveHandle;
+		bool bShuttingDown = false;
+
+	public:
+		FRealtimeMeshCollisionCookScheduler();
+		~FRealtimeMeshCollisionCookScheduler();
+
+		/**
+		 * Schedules a cook for the given owner, replacing any cook for it that hasn't started yet and cancelling any that is running.
+		 * @param Owner Identity of the mesh the cook belongs to, only used as a key
+		 * @param CookFunction Cook to run, should check the token between expensive steps
+		 */
+		TFuture<ERealtimeMeshCollisionUpdateResult> Schedule(const void* Owner, FCookFunction&& CookFunction);
+
+		/* Drops any pending cook for the owner and cancels a running one or one waiting to be applied, waiters receive Ignored */
+		void Cancel(const void* Owner);
+
+		FRealtimeMeshCollisionCookStats GetStats() const;
+
+		static int32 GetMaxConcurrentCooks();
+
+		static FRealtimeMeshCollisionCookScheduler& Get();
+		/* The scheduler if it has been created and not torn down yet, for owners cancelling their cooks without creating it */
+		static FRealtimeMeshCollisionCookScheduler* TryGet();
+		static void TearDown();
+
+	private:
+		void DispatchQueuedCooks();
+		void StartCook(const void* Owner, FRequest&& Request, const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& Cancelled);
+		void OnCookReturned(const void* Owner, FRequest&& Request, const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& Cancelled,
+			TFuture<ERealtimeMeshCollisionUpdateResult>&& Result);
+		void OnCookFinished(const void* Owner, FRequest&& Request, const TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe>& Cancelled,
+			TFuture<ERealtimeMeshCollisionUpdateResult>&& Result);
+		void UpdateStatCounters() const;
+	};
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RealtimeMeshCollision.h"
+
+namespace RealtimeMesh
+{
+	struct FRealtimeMeshCollisionDiskCacheStats
+	{
+		uint64 Hits = 0;
+		uint64 Misses = 0;
+		/* Entries that failed validation and were deleted */
+		uint64 Corrupt = 0;
+		uint64 Writes = 0;
+		uint64 Evictions = 0;
+	};
+
+	/**
+	 * Local file cache of cooked complex collision, so procedural meshes that don't change between sessions
+	 * aren't cooked again every time they're loaded.
+	 * Entries are plain files named by the cook hash of the collision mesh (see URealtimeMeshCollisionTools::GetComplexMeshCookHash)
+	 * and are validated on read, anything that fails validation is deleted and treated as a miss.
+	 * The least recently used entries are evicted once the directory grows past the size limit.
+	 *
+	 * Disabled by default, controlled through RealtimeMesh.Collision.DiskCache.Enable, .Directory and .MaxSizeMB
+	 * which can be set per project in the [SystemSettings] section of DefaultEngine.ini.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshCollisionDiskCache
+	{
+	private:
+		mutable FCriticalSection Lock;
+		FString Directory;
+		int64 MaxSizeBytes;
+		/* Size of the entries on disk, INDEX_NONE until the directory has been scanned */
+		int64 CurrentSizeBytes;
+		FRealtimeMeshCollisionDiskCacheStats Stats;
+
+	public:
+		FRealtimeMeshCollisionDiskCache(const FString& InDirectory = FString(), int64 InMaxSizeBytes = 0);
+
+		/* Loads the cooked data for the key, returns false on a miss or a corrupt entry */
+		bool TryLoad(uint64 Key, TSharedPtr<FRealtimeMeshCookedTriMeshData>& OutCooked);
+
+		/* Writes the cooked data for the key, evicting old entries if the cache is over its size limit */
+		void Store(uint64 Key, FRealtimeMeshCookedTriMeshData& Cooked);
+
+		FString GetEntryPath(uint64 Key) const;
+		const FString& GetDirectory() const { return Directory; }
+		FRealtimeMeshCollisionDiskCacheStats GetStats() const;
+
+		/* Returns the cache configured by the console variables, or null when the cache is disabled */
+		static FRealtimeMeshCollisionDiskCache* Get();
+
+	private:
+		void Configure(const FString& InDirectory, int64 InMaxSizeBytes);
+		void EvictToSizeLimit();
+	};
+}
@@ -5,6 +5,7 @@
 #include "RealtimeMeshCore.h"
 #include "RealtimeMeshLOD.h"
 #include "RealtimeMeshCollisionLibrary.h"
+#include "RealtimeMeshCollisionCookScheduler.h"
 #include "RealtimeMeshUpdateBuilder.h"
 #include "Data/RealtimeMeshShared.h"
 #include "Async/Async.h"
@@ -195,7 +196,8 @@ namespace RealtimeMesh
 		int32 GetNextCollisionUpdateVersion() { return CollisionUpdateVersionCounter.Increment(); }
 		FRealtimeMeshProxyRef CreateRenderProxy(bool bForceRecreate = false) const;
 
-		TFuture<ERealtimeMeshCollisionUpdateResult> UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey);
+		TFuture<ERealtimeMeshCollisionUpdateResult> UpdateCollision(FRealtimeMeshCollisionInfo&& InCollisionData, int32 NewCollisionKey,
+			const FRealtimeMeshCollisionCookToken& CookToken = FRealtimeMeshCollisionCookToken());
 
 		void MarkForEndOfFrameUpdate() const;
 		void MarkBoundsDirtyIfNotOverridden(FRealtimeMeshUpdateContext& UpdateContext);
@@ -8,9 +8,26 @@
 #include "Data/RealtimeMeshShared.h"
 #include "Core/RealtimeMeshKeys.h"
 #include "Core/RealtimeMeshSectionGroupConfig.h"
+#include "Core/RealtimeMeshInterleavedLayout.h"
 
 namespace RealtimeMesh
 {
+	struct FRealtimeMeshSectionGroupStreamUpdateData;
+
+	/* Layout and size of a stream as it was last sent to the proxy */
+	struct FRealtimeMeshProxyStreamShape
+	{
+		FRealtimeMeshBufferLayout Layout;
+		int32 Num = 0;
+		FRealtimeMeshInterleavedLayout InterleavedLayout;
+
+		bool operator==(const FRealtimeMeshProxyStreamShape& Other) const
+		{
+			return Layout == Other.Layout && Num == Other.Num && InterleavedLayout == Other.InterleavedLayout;
+		}
+		bool operator!=(const FRealtimeMeshProxyStreamShape& Other) const { return !(*this == Other); }
+	};
+
 	class REALTIMEMESHCOMPONENT_API FRealtimeMeshSectionGroup : public TSharedFromThis<FRealtimeMeshSectionGroup>
 	{
 	protected:
@@ -21,12 +38,16 @@ namespace RealtimeMesh
 		TSet<FRealtimeMeshSectionRef, FRealtimeMeshSectionRefKeyFuncs> Sections;
 		FRealtimeMeshSectionGroupConfig Config;
 		FRealtimeMeshBounds Bounds;
+		TMap<FRealtimeMeshStreamKey, FRealtimeMeshProxyStreamShape> ProxyStreamShapes;
+		/* Last full upload of each stream sent to the proxy, stays valid until the render thread is done with it */
+		TMap<FRealtimeMeshStreamKey, TWeakPtr<FRealtimeMeshSectionGroupStreamUpdateData>> PendingProxyUploads;
 
 	public:
 		FRealtimeMeshSectionGroup(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionGroupKey& InKey);
 		virtual ~FRealtimeMeshSectionGroup() = default;
 
 		const FRealtimeMeshSectionGroupKey& GetKey(const FRealtimeMeshLockContext& LockContext) const { return Key; }
+		const FRealtimeMeshSectionGroupConfig& GetConfig(const FRealtimeMeshLockContext& LockContext) const { return Config; }
 		FRealtimeMeshStreamRange GetInUseRange(const FRealtimeMeshLockContext& LockContext) const;
 		TOptional<FBoxSphereBounds3f> GetLocalBounds(const FRealtimeMeshLockContext& LockContext) const;
 		bool HasSections(const FRealtimeMeshLockContext& LockContext) const;
@@ -88,6 +109,14 @@ namespace RealtimeMesh
 		virtual void UpdateConfig(FRealtimeMeshUpdateContext& UpdateContext, TFunction<void(FRealtimeMeshSectionGroupConfig&)> EditFunc);
 
 		virtual void CreateOrUpdateStream(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& Stream);
+
+		/**
+		 * @brief Writes a sub-range of rows into an existing stream without recreating its GPU buffer
+		 * @param UpdateContext Update context used for this operation
+		 * @param RangeData Stream containing only the rows to write, must use the same key and layout as the existing stream
+		 * @param DestinationIndex First row in the existing stream to write to
+		 */
+		virtual void UpdateStreamRange(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& RangeData, int32 DestinationIndex);
 		virtual void RemoveStream(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey);
 
 		virtual void SetAllStreams(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStreamSet&& InStreams);
@@ -110,6 +139,27 @@ namespace RealtimeMesh
 		
 		void MarkBoundsDirtyIfNotOverridden(FRealtimeMeshUpdateContext& UpdateContext);
 
+		/* Whether changes to this stream are sent to the render proxy as their own GPU buffer */
+		virtual bool ShouldSendStreamToProxy(const FRealtimeMeshStreamKey& StreamKey) const { return SharedResources->WantsStreamOnGPU(StreamKey); }
+
+		/* Decodes a stream in a compressed layout the vertex factory can't read into one it can, using this group's position quantization */
+		void DecodeStreamForProxy(FRealtimeMeshStream& Stream) const;
+
+		/*
+		 * Records the layout and size of a stream being sent to the proxy. Returns true when they match what the proxy already has,
+		 * in which case the proxy writes the update over its existing buffer and the vertex factory and cached draw commands stay valid.
+		 */
+		bool UpdateProxyStreamShape(const FRealtimeMeshSectionGroupStreamUpdateData& UpdateData);
+
+		/*
+		 * Queues a full upload of a stream to the proxy. It replaces any upload of the same stream the render thread hasn't processed yet,
+		 * and while one is still queued the new buffer is left for the render thread to create so rapid updates only create the last one.
+		 */
+		void SendStreamToProxy(FRealtimeMeshUpdateContext& UpdateContext, const TSharedRef<FRealtimeMeshSectionGroupStreamUpdateData>& UpdateData, bool bUpdatesInPlace);
+
+		/* Queues removing a stream from the proxy, dropping any upload of it still queued */
+		void RemoveStreamFromProxy(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey);
+
 	};
 
 	struct FRealtimeMeshSectionGroupRefKeyFuncs : BaseKeyFuncs<TSharedRef<FRealtimeMeshSectionGroup>, FRealtimeMeshSectionGroupKey, false>
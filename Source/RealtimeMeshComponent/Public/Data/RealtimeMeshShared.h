@@ -8,6 +8,8 @@
 #include "Core/RealtimeMeshDataStream.h"
 #include "Async/Async.h"
 
+#include <atomic>
+
 struct FRealtimeMeshSimpleGeometry;
 struct FRealtimeMeshCollisionConfiguration;
 struct FRealtimeMeshCollisionInfo;
@@ -107,10 +109,14 @@ namespace RealtimeMesh
 		FRealtimeMeshSimpleEvent OnRenderProxyRequiresUpdateEvent;
 		FRealtimeMeshSimpleEvent OnBoundsChangedEvent;
 
+		/* Read by the render thread when RealtimeMesh.UploadBudgetPerFrame limits uploads, higher goes first */
+		std::atomic<float> UploadPriority;
+
 	public:
 		virtual ~FRealtimeMeshSharedResources() = default;
 
 		FRealtimeMeshSharedResources()
+			: UploadPriority(0.0f)
 		{
 		}
 
@@ -133,6 +139,9 @@ namespace RealtimeMesh
 		FName GetMeshName() const { return MeshName; }
 		void SetMeshName(FName InName) { MeshName = InName; }
 
+		float GetUploadPriority() const { return UploadPriority.load(std::memory_order_relaxed); }
+		void SetUploadPriority(float InPriority) { UploadPriority.store(InPriority, std::memory_order_relaxed); }
+
 		URealtimeMesh* GetOwningMesh() const { return OwningMesh.Get(); }
 		FRealtimeMeshPtr GetOwner() const { return Owner.Pin(); }
 		FRealtimeMeshProxyPtr GetProxy() const { return Proxy.Pin(); }
@@ -147,6 +156,7 @@ namespace RealtimeMesh
 				FRealtimeMeshStreams::Tangents,
 				FRealtimeMeshStreams::TexCoords,
 				FRealtimeMeshStreams::Color,
+				FRealtimeMeshStreams::Interleaved,
 				FRealtimeMeshStreams::Triangles
 			};
 			return WantedStreams.Contains(StreamKey);
@@ -328,6 +338,7 @@ namespace RealtimeMesh
 		virtual FRealtimeMeshUpdateStateRef CreateUpdateState() const;
 		
 		virtual FRealtimeMeshVertexFactoryRef CreateVertexFactory() const;
+		virtual FRealtimeMeshVertexFactoryRef CreateInterleavedVertexFactory() const;
 		virtual FRealtimeMeshSectionProxyRef CreateSectionProxy(const FRealtimeMeshSectionKey& InKey) const;
 		virtual FRealtimeMeshSectionGroupProxyRef CreateSectionGroupProxy(const FRealtimeMeshSectionGroupKey& InKey) const;
 		virtual FRealtimeMeshLODProxyRef CreateLODProxy(const FRealtimeMeshLODKey& InKey) const;
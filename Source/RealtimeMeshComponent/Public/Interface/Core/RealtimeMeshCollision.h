@@ -28,6 +28,14 @@ struct FRealtimeMeshCollisionConfiguration
 	bool bFlipNormals;
 	bool bDeformableMesh;	
 	bool bMergeAllMeshes;
+	// LOD the complex collision is generated from, clamped to the last valid LOD
+	int32 ComplexCollisionLOD;
+	// Weld vertices and drop degenerate triangles when cooking the complex collision
+	bool bCleanComplexMesh;
+	// Max distance between vertices that are welded when cleaning
+	float ComplexMeshWeldTolerance;
+	// Size of the grid cells the complex collision of each section group is split into, 0 keeps one mesh per section group
+	float ComplexCollisionChunkSize;
 	
 	FRealtimeMeshCollisionConfiguration()
 		: bUseComplexAsSimpleCollision(true)
@@ -36,6 +44,10 @@ struct FRealtimeMeshCollisionConfiguration
 		, bFlipNormals(false)
 		, bDeformableMesh(false)
 		, bMergeAllMeshes(false)
+		, ComplexCollisionLOD(0)
+		, bCleanComplexMesh(false)
+		, ComplexMeshWeldTolerance(0.01f)
+		, ComplexCollisionChunkSize(0.0f)
 	{ }
 
 	friend FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionConfiguration& Config);
@@ -412,6 +424,8 @@ public:
 	TArray<int32> ConsumeVertexRemap() { return MoveTemp(VertexRemap); }
 	TArray<int32> ConsumeFaceRemap() { return MoveTemp(FaceRemap); }
 	FRealtimeMeshCollisionMeshCookedUVData ConsumeUVInfo() { return MoveTemp(UVInfo); }	
+
+	friend FArchive& operator<<(FArchive& Ar, FRealtimeMeshCookedTriMeshData& CookedData);
 };
 
 struct REALTIMEMESHCOMPONENT_INTERFACE_API FRealtimeMeshCollisionMesh
@@ -422,6 +436,8 @@ private:
 	TArray<uint16> Materials;
 	TArray<TArray<FVector2f>> TexCoords;
 	bool bFlipNormals;
+	bool bCleanMesh;
+	float WeldTolerance;
 	
 	mutable TSharedPtr<FRealtimeMeshCookedTriMeshData> Cooked;
 	
@@ -430,6 +446,8 @@ public:
 	
 	FRealtimeMeshCollisionMesh()
 		: bFlipNormals(true)
+		, bCleanMesh(false)
+		, WeldTolerance(0.01f)
 	{ }
 	
 	void SetVertices(const TArray<FVector3f>& InVertices) { Vertices = InVertices; ReleaseCooked(); }
@@ -451,11 +469,18 @@ public:
 	void SetTexCoords(TArray<TArray<FVector2f>>&& InTexCoords) { TexCoords = MoveTemp(InTexCoords); ReleaseCooked(); }
 	void ClearTexCoords() { TexCoords.Empty(); ReleaseCooked(); }
 	const TArray<TArray<FVector2f>>& GetTexCoords() const { return TexCoords; }
+
+	/* When enabled the cook welds vertices within the tolerance and drops the triangles that become degenerate, see RealtimeMeshAlgo::WeldVertices */
+	void SetCleanSettings(bool bInCleanMesh, float InWeldTolerance) { bCleanMesh = bInCleanMesh; WeldTolerance = FMath::Max(InWeldTolerance, 0.0f); ReleaseCooked(); }
+	bool ShouldCleanMesh() const { return bCleanMesh; }
+	float GetWeldTolerance() const { return WeldTolerance; }
 	
 	bool NeedsCook() const { return !Cooked.IsValid(); }
 	bool HasCookedMesh() const { return Cooked.IsValid() && Cooked->HasMesh(); }
 	TSharedPtr<FRealtimeMeshCookedTriMeshData> GetCooked() const { return Cooked; }
 	void ReleaseCooked() const { Cooked.Reset(); }
+	/* Attaches an existing cook of the same geometry, so a cached cook can be handed out without keeping a copy of the geometry it came from */
+	void SetCooked(const TSharedPtr<FRealtimeMeshCookedTriMeshData>& InCooked) { Cooked = InCooked; }
 
 	
 	friend FArchive& operator<<(FArchive& Ar, FRealtimeMeshCollisionMesh& Shape);
@@ -6,35 +6,169 @@
 
 namespace RealtimeMesh
 {
-	TMap<FRealtimeMeshElementConversionKey, FRealtimeMeshElementConverters> FRealtimeMeshTypeConversionUtilities::TypeConversionMap;
+	TMap<FRealtimeMeshElementConversionKey, TUniquePtr<FRealtimeMeshElementConverters>> FRealtimeMeshTypeConversionUtilities::TypeConversionMap;
 
-	bool FRealtimeMeshTypeConversionUtilities::CanConvert(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType)
-	{
-		return TypeConversionMap.Contains(FRealtimeMeshElementConversionKey(FromType, ToType));
-	}
-
-	const FRealtimeMeshElementConverters& FRealtimeMeshTypeConversionUtilities::GetTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType)
-	{
-		return TypeConversionMap.FindChecked(FRealtimeMeshElementConversionKey(FromType, ToType));
-	}
+	// Zero initialized before any registration runs
+	const FRealtimeMeshElementConverters* FRealtimeMeshTypeConversionUtilities::DispatchTable[NumElementTypeIndices * NumElementTypeIndices] = { };
 
 	void FRealtimeMeshTypeConversionUtilities::RegisterTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType,
 	                                                                 const FRealtimeMeshElementConverters& Converters)
 	{
-		TypeConversionMap.Add(FRealtimeMeshElementConversionKey(FromType, ToType), Converters);
+		check(FromType.IsValid() && ToType.IsValid());
+		check(static_cast<int32>(FromType.GetDatumType()) < NumDatumTypes && static_cast<int32>(ToType.GetDatumType()) < NumDatumTypes);
+
+		const TUniquePtr<FRealtimeMeshElementConverters>& Entry =
+			TypeConversionMap.Add(FRealtimeMeshElementConversionKey(FromType, ToType), MakeUnique<FRealtimeMeshElementConverters>(Converters));
+		DispatchTable[GetDispatchIndex(FromType, ToType)] = Entry.Get();
 	}
 
 	void FRealtimeMeshTypeConversionUtilities::UnregisterTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType)
 	{
+		DispatchTable[GetDispatchIndex(FromType, ToType)] = nullptr;
 		TypeConversionMap.Remove(FRealtimeMeshElementConversionKey(FromType, ToType));
 	}
 
 
+	namespace ConversionKernels
+	{
+		static_assert(sizeof(FFloat16) == sizeof(uint16));
+		static_assert(sizeof(FVector2DHalf) == sizeof(FFloat16) * 2);
+		static_assert(sizeof(FVector2f) == sizeof(float) * 2);
+		static_assert(sizeof(FVector4f) == sizeof(float) * 4);
+
+		// Halves are converted 8 at a time, which is what the platform wide half conversion handles
+		static constexpr uint32 HalfBatchSize = 8;
+
+		static void ConvertFloatsToHalves(const float* RESTRICT Source, FFloat16* RESTRICT Destination, uint32 Count)
+		{
+			uint32 Index = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+			uint16* RESTRICT Encoded = reinterpret_cast<uint16*>(Destination);
+			for (; Index + HalfBatchSize <= Count; Index += HalfBatchSize)
+			{
+				FPlatformMath::WideVectorStoreHalf(Encoded + Index, Source + Index);
+			}
+#endif
+			for (; Index < Count; Index++)
+			{
+				Destination[Index] = FFloat16(Source[Index]);
+			}
+		}
+
+		static void ConvertHalvesToFloats(const FFloat16* RESTRICT Source, float* RESTRICT Destination, uint32 Count)
+		{
+			uint32 Index = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+			const uint16* RESTRICT Encoded = reinterpret_cast<const uint16*>(Source);
+			for (; Index + HalfBatchSize <= Count; Index += HalfBatchSize)
+			{
+				FPlatformMath::WideVectorLoadHalf(Destination + Index, Encoded + Index);
+			}
+#endif
+			for (; Index < Count; Index++)
+			{
+				Destination[Index] = Source[Index].GetFloat();
+			}
+		}
+
+		// Signed normalized packing, RoundToInt(Value * MaxValue) clamped to the integer range
+		template <typename PackedType, typename ComponentType>
+		static void PackSignedNormalized(const FVector4f* RESTRICT Source, PackedType* RESTRICT Destination, uint32 Count)
+		{
+			constexpr float MaxValue = static_cast<float>(TNumericLimits<ComponentType>::Max());
+			constexpr float MinValue = static_cast<float>(TNumericLimits<ComponentType>::Min());
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+			const VectorRegister4Float Scale = VectorSetFloat1(MaxValue);
+			const VectorRegister4Float RoundingOffset = VectorSetFloat1(0.5f);
+			const VectorRegister4Float Min = VectorSetFloat1(MinValue);
+			const VectorRegister4Float Max = VectorSetFloat1(MaxValue);
+
+			for (uint32 Index = 0; Index < Count; Index++)
+			{
+				// Multiply and add kept separate so the rounding matches the scalar path on platforms with fused multiply add
+				VectorRegister4Float Value = VectorMultiply(VectorLoad(&Source[Index].X), Scale);
+				Value = VectorFloor(VectorAdd(Value, RoundingOffset));
+				Value = VectorMin(VectorMax(Value, Min), Max);
+
+				alignas(16) int32 Packed[4];
+				VectorIntStoreAligned(VectorFloatToInt(Value), Packed);
+
+				ComponentType* RESTRICT Components = reinterpret_cast<ComponentType*>(&Destination[Index]);
+				Components[0] = static_cast<ComponentType>(Packed[0]);
+				Components[1] = static_cast<ComponentType>(Packed[1]);
+				Components[2] = static_cast<ComponentType>(Packed[2]);
+				Components[3] = static_cast<ComponentType>(Packed[3]);
+			}
+#else
+			for (uint32 Index = 0; Index < Count; Index++)
+			{
+				Destination[Index] = PackedType(Source[Index]);
+			}
+#endif
+		}
+
+		template <typename PackedType, typename ComponentType>
+		static void UnpackSignedNormalized(const PackedType* RESTRICT Source, FVector4f* RESTRICT Destination, uint32 Count)
+		{
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+			const VectorRegister4Float InvScale = VectorSetFloat1(1.0f / static_cast<float>(TNumericLimits<ComponentType>::Max()));
+
+			for (uint32 Index = 0; Index < Count; Index++)
+			{
+				const ComponentType* RESTRICT Components = reinterpret_cast<const ComponentType*>(&Source[Index]);
+				const VectorRegister4Float Value = MakeVectorRegister(
+					static_cast<float>(Components[0]), static_cast<float>(Components[1]), static_cast<float>(Components[2]), static_cast<float>(Components[3]));
+				VectorStore(VectorMultiply(Value, InvScale), &Destination[Index].X);
+			}
+#else
+			for (uint32 Index = 0; Index < Count; Index++)
+			{
+				Destination[Index] = Source[Index].ToFVector4f();
+			}
+#endif
+		}
+
+		// Index conversions are simple enough to leave to the compiler's auto vectorization, the vector register api has no narrowing
+		template <typename FromType, typename ToType>
+		static void ConvertIntegers(const FromType* RESTRICT Source, ToType* RESTRICT Destination, uint32 Count)
+		{
+			for (uint32 Index = 0; Index < Count; Index++)
+			{
+				Destination[Index] = static_cast<ToType>(Source[Index]);
+			}
+		}
+
+		void ConvertArray(const float* Source, FFloat16* Destination, uint32 Count) { ConvertFloatsToHalves(Source, Destination, Count); }
+		void ConvertArray(const FFloat16* Source, float* Destination, uint32 Count) { ConvertHalvesToFloats(Source, Destination, Count); }
+
+		void ConvertArray(const FVector2f* Source, FVector2DHalf* Destination, uint32 Count)
+		{
+			ConvertFloatsToHalves(&Source->X, &Destination->X, Count * 2);
+		}
+
+		void ConvertArray(const FVector2DHalf* Source, FVector2f* Destination, uint32 Count)
+		{
+			ConvertHalvesToFloats(&Source->X, &Destination->X, Count * 2);
+		}
+
+		void ConvertArray(const FVector4f* Source, FPackedNormal* Destination, uint32 Count) { PackSignedNormalized<FPackedNormal, int8>(Source, Destination, Count); }
+		void ConvertArray(const FPackedNormal* Source, FVector4f* Destination, uint32 Count) { UnpackSignedNormalized<FPackedNormal, int8>(Source, Destination, Count); }
+		void ConvertArray(const FVector4f* Source, FPackedRGBA16N* Destination, uint32 Count) { PackSignedNormalized<FPackedRGBA16N, int16>(Source, Destination, Count); }
+		void ConvertArray(const FPackedRGBA16N* Source, FVector4f* Destination, uint32 Count) { UnpackSignedNormalized<FPackedRGBA16N, int16>(Source, Destination, Count); }
+
+		void ConvertArray(const int32* Source, uint16* Destination, uint32 Count) { ConvertIntegers(Source, Destination, Count); }
+		void ConvertArray(const uint32* Source, uint16* Destination, uint32 Count) { ConvertIntegers(Source, Destination, Count); }
+		void ConvertArray(const uint16* Source, int32* Destination, uint32 Count) { ConvertIntegers(Source, Destination, Count); }
+		void ConvertArray(const uint16* Source, uint32* Destination, uint32 Count) { ConvertIntegers(Source, Destination, Count); }
+	}
+
+
 	// UInt16 
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint16, uint16);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint16, int16);
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint16, uint32);
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint16, int32);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(uint16, uint32, ConversionKernels::ConvertArray);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(uint16, int32, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint16, float);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint16, FFloat16);
 
@@ -48,7 +182,7 @@ namespace RealtimeMesh
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(int16, FFloat16);
 
 	// UInt32
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint32, uint16);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(uint32, uint16, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint32, int16);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint32, uint32);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint32, int32);
@@ -56,7 +190,7 @@ namespace RealtimeMesh
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(uint32, FFloat16);
 
 	// Int32
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(int32, uint16);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(int32, uint16, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(int32, int16);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(int32, uint32);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(int32, int32);
@@ -65,19 +199,19 @@ namespace RealtimeMesh
 
 	// float
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(float, float);
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(float, FFloat16);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(float, FFloat16, ConversionKernels::ConvertArray);
 
 	// FFloat16
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FFloat16, float);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(FFloat16, float, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FFloat16, FFloat16);
 
 	// FVector2DHalf
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector2DHalf, FVector2DHalf);
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector2DHalf, FVector2f);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(FVector2DHalf, FVector2f, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector2DHalf, FVector2d);
 
 	// FVector2f
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector2f, FVector2DHalf);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(FVector2f, FVector2DHalf, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector2f, FVector2f);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector2f, FVector2d);
 
@@ -97,8 +231,8 @@ namespace RealtimeMesh
 	// FVector4f
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4f, FVector4f);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4f, FVector4d);
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4f, FPackedNormal);
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4f, FPackedRGBA16N);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(FVector4f, FPackedNormal, ConversionKernels::ConvertArray);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(FVector4f, FPackedRGBA16N, ConversionKernels::ConvertArray);
 
 	// FVector4d
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4d, FVector4f);
@@ -108,17 +242,54 @@ namespace RealtimeMesh
 
 
 	// FPackedNormal
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedNormal, FVector4f, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_WITH_KERNEL(FPackedNormal, FVector4f, { Destination = Source.ToFVector4f(); }, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedNormal, FVector4d, { Destination = Source.ToFVector4(); });
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FPackedNormal, FPackedNormal);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedNormal, FPackedRGBA16N, { Destination = Source.ToFVector4f(); });
 
 	// FPackedRGBA16N	
-	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedRGBA16N, FVector4f, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_WITH_KERNEL(FPackedRGBA16N, FVector4f, { Destination = Source.ToFVector4f(); }, ConversionKernels::ConvertArray);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedRGBA16N, FVector4d, { Destination = Source.ToFVector4(); });
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedRGBA16N, FPackedNormal, { Destination = Source.ToFVector4f(); });
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FPackedRGBA16N, FPackedRGBA16N);
 
+	// FRealtimeMeshOctahedralNormal
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector3f, FRealtimeMeshOctahedralNormal);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector3d, FRealtimeMeshOctahedralNormal);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4f, FRealtimeMeshOctahedralNormal);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4d, FRealtimeMeshOctahedralNormal);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedNormal, FRealtimeMeshOctahedralNormal, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedRGBA16N, FRealtimeMeshOctahedralNormal, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FVector3f, { Destination = Source.ToFVector3f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FVector3d, { Destination = FVector3d(Source.ToFVector3f()); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FVector4f, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FVector4d, { Destination = FVector4d(Source.ToFVector4f()); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FPackedNormal, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FPackedRGBA16N, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshOctahedralNormal, FRealtimeMeshPackedRGB10A2N, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FRealtimeMeshOctahedralNormal, FRealtimeMeshOctahedralNormal);
+
+	// FRealtimeMeshPackedRGB10A2N
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector3f, FRealtimeMeshPackedRGB10A2N);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector3d, FRealtimeMeshPackedRGB10A2N);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4f, FRealtimeMeshPackedRGB10A2N);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FVector4d, FRealtimeMeshPackedRGB10A2N);
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedNormal, FRealtimeMeshPackedRGB10A2N, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FPackedRGBA16N, FRealtimeMeshPackedRGB10A2N, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FVector3f, { Destination = Source.ToFVector3f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FVector3d, { Destination = FVector3d(Source.ToFVector3f()); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FVector4f, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FVector4d, { Destination = FVector4d(Source.ToFVector4f()); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FPackedNormal, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FPackedRGBA16N, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshPackedRGB10A2N, FRealtimeMeshOctahedralNormal, { Destination = Source.ToFVector4f(); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FRealtimeMeshPackedRGB10A2N, FRealtimeMeshPackedRGB10A2N);
+
+	// FRealtimeMeshQuantizedPosition, these give the position on the quantization grid, apply the section group's FRealtimeMeshPositionQuantization
+	// to get it in local space. Converting into quantized positions needs the quantization, see FRealtimeMeshPositionQuantization::Quantize
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FRealtimeMeshQuantizedPosition, FVector3f, { Destination = FVector3f(Source.X, Source.Y, Source.Z); });
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FRealtimeMeshQuantizedPosition, FRealtimeMeshQuantizedPosition);
+
 	// FColor
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FColor, FColor);
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FColor, FLinearColor, { Destination = FLinearColor::FromSRGBColor(Source); })
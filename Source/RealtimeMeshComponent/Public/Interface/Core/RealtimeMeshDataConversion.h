@@ -3,6 +3,7 @@
 #pragma once
 
 #include "RealtimeMeshDataTypes.h"
+#include "Templates/UniquePtr.h"
 
 namespace RealtimeMesh
 {
@@ -55,14 +56,51 @@ namespace RealtimeMesh
 		}
 	};
 
+	/*
+	 * Registry of the converters between element types.
+	 * Every element type (datum type x datum count) maps to a dense index, and lookups go through a flat
+	 * table indexed by the from/to pair so they don't need to hash anything. The table is filled in as
+	 * converters are registered, at startup for the built in ones. Registering isn't thread safe against
+	 * concurrent lookups, converters should be registered before they're used.
+	 */
 	struct REALTIMEMESHCOMPONENT_INTERFACE_API FRealtimeMeshTypeConversionUtilities
 	{
 	private:
-		static TMap<FRealtimeMeshElementConversionKey, FRealtimeMeshElementConverters> TypeConversionMap;
+		// Sized from the datum type sentinel so new datum types grow the table, NumDatums is a 3 bit field
+		static constexpr int32 NumDatumTypes = static_cast<int32>(ERealtimeMeshDatumType::Count);
+		static constexpr int32 MaxNumDatums = 8;
+		static constexpr int32 NumElementTypeIndices = NumDatumTypes * MaxNumDatums;
+		static_assert(NumDatumTypes > static_cast<int32>(ERealtimeMeshDatumType::Int16Octahedral), "ERealtimeMeshDatumType::Count must be the last datum type");
+
+		// Owns the converters, they're heap allocated so references to them stay valid as others are registered
+		static TMap<FRealtimeMeshElementConversionKey, TUniquePtr<FRealtimeMeshElementConverters>> TypeConversionMap;
+		static const FRealtimeMeshElementConverters* DispatchTable[NumElementTypeIndices * NumElementTypeIndices];
+
+		static FORCEINLINE int32 GetElementTypeIndex(const FRealtimeMeshElementType& Type)
+		{
+			// Out of range types (e.g. from corrupt serialized data) map to Unknown, which never has converters
+			const int32 DatumIndex = static_cast<int32>(Type.GetDatumType());
+			return (DatumIndex < NumDatumTypes ? DatumIndex : static_cast<int32>(ERealtimeMeshDatumType::Unknown)) * MaxNumDatums + Type.GetNumDatums();
+		}
+
+		static FORCEINLINE int32 GetDispatchIndex(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType)
+		{
+			return GetElementTypeIndex(FromType) * NumElementTypeIndices + GetElementTypeIndex(ToType);
+		}
 
 	public:
-		static bool CanConvert(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType);
-		static const FRealtimeMeshElementConverters& GetTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType);
+		static FORCEINLINE bool CanConvert(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType)
+		{
+			return DispatchTable[GetDispatchIndex(FromType, ToType)] != nullptr;
+		}
+
+		static FORCEINLINE const FRealtimeMeshElementConverters& GetTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType)
+		{
+			const FRealtimeMeshElementConverters* Converters = DispatchTable[GetDispatchIndex(FromType, ToType)];
+			checkf(Converters, TEXT("No converter registered from %s to %s"), *FromType.ToString(), *ToType.ToString());
+			return *Converters;
+		}
+
 		static void RegisterTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType,
 		                                  const FRealtimeMeshElementConverters& Converters);
 		static void UnregisterTypeConverter(const FRealtimeMeshElementType& FromType, const FRealtimeMeshElementType& ToType);
@@ -110,6 +148,51 @@ namespace RealtimeMesh
 #define RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL(FromElementType, ToElementType) \
 	RMC_DEFINE_ELEMENT_TYPE_CONVERTER(FromElementType, ToElementType, { Destination = ToElementType(Source); });
 
+// Same as RMC_DEFINE_ELEMENT_TYPE_CONVERTER but contiguous arrays go through a dedicated bulk kernel instead of the per element converter
+#define RMC_DEFINE_ELEMENT_TYPE_CONVERTER_WITH_KERNEL(FromElementType, ToElementType, ElementConverter, ArrayKernel) \
+	FRealtimeMeshTypeConverterRegistration<FromElementType, ToElementType> GRegister##FromElementType##To##ToElementType(FRealtimeMeshElementConverters( \
+			[](const void* SourceElement, void* DestinationElement) { \
+				const FromElementType& Source = *static_cast<const FromElementType*>(SourceElement); \
+				ToElementType& Destination = *static_cast<ToElementType*>(DestinationElement); \
+				ElementConverter \
+			}, \
+			[](const void* SourceArr, void* DestinationArr, uint32 Count) { \
+				ArrayKernel(static_cast<const FromElementType*>(SourceArr), static_cast<ToElementType*>(DestinationArr), Count); \
+			} \
+		) \
+	);
+
+#define RMC_DEFINE_ELEMENT_TYPE_CONVERTER_TRIVIAL_WITH_KERNEL(FromElementType, ToElementType, ArrayKernel) \
+	RMC_DEFINE_ELEMENT_TYPE_CONVERTER_WITH_KERNEL(FromElementType, ToElementType, { Destination = ToElementType(Source); }, ArrayKernel);
+
+
+	/*
+	 * Bulk conversion kernels for the conversions that dominate stream building and conversion.
+	 * These use the vector intrinsics when they're available and fall back to the same scalar
+	 * conversion as the per element converters otherwise, and for any tail elements.
+	 * Source and destination must not overlap.
+	 */
+	namespace ConversionKernels
+	{
+		// Half precision, identical to FFloat16's own conversion
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const float* Source, FFloat16* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FFloat16* Source, float* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FVector2f* Source, FVector2DHalf* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FVector2DHalf* Source, FVector2f* Destination, uint32 Count);
+
+		// Packed normals, rounded to nearest the same way as the FPackedNormal/FPackedRGBA16N constructors
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FVector4f* Source, FPackedNormal* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FPackedNormal* Source, FVector4f* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FVector4f* Source, FPackedRGBA16N* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const FPackedRGBA16N* Source, FVector4f* Destination, uint32 Count);
+
+		// Index narrowing/widening, truncating like the trivial converters
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const int32* Source, uint16* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const uint32* Source, uint16* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const uint16* Source, int32* Destination, uint32 Count);
+		REALTIMEMESHCOMPONENT_INTERFACE_API void ConvertArray(const uint16* Source, uint32* Destination, uint32 Count);
+	}
+
 
 	template<typename SourceType, typename DestinationType>
 	FORCEINLINE_DEBUGGABLE DestinationType ConvertRealtimeMeshType(const SourceType& Source)
@@ -4,6 +4,7 @@
 #include "RealtimeMeshDataStream.h"
 
 #include <string>
+#include <atomic>
 
 
 namespace RealtimeMesh::NatVis
@@ -38,6 +39,7 @@ namespace RealtimeMesh::NatVis
 			};
 			break;
 		case ERealtimeMeshDatumType::Int16:
+		case ERealtimeMeshDatumType::Int16Octahedral:
 			DatumReader = [](const FRealtimeMeshStream& Stream, int32 Row, int32 ElementIndex,
 			                 int32 DatumIndex) -> std::string
 			{
@@ -144,6 +146,19 @@ namespace RealtimeMesh::NatVis
 }
 
 
+static std::atomic<uint64> GRealtimeMeshStreamBytesCopied(0);
+
+uint64 RealtimeMesh::FRealtimeMeshStream::GetTotalBytesCopied()
+{
+	return GRealtimeMeshStreamBytesCopied.load(std::memory_order_relaxed);
+}
+
+void RealtimeMesh::FRealtimeMeshStream::TrackBytesCopied(uint64 NumBytes)
+{
+	GRealtimeMeshStreamBytesCopied.fetch_add(NumBytes, std::memory_order_relaxed);
+}
+
+
 void RealtimeMesh::FRealtimeMeshStreamLinkage::HandleStreamRemoved(FRealtimeMeshStream* Stream)
 {
 	RemoveStream(Stream);
@@ -21,6 +21,7 @@ namespace RealtimeMesh
 		inline static const FName TangentsStreamName = FName(TEXT("Tangents"));
 		inline static const FName TexCoordsStreamName = FName(TEXT("TexCoords"));
 		inline static const FName ColorStreamName = FName(TEXT("Color"));
+		inline static const FName InterleavedStreamName = FName(TEXT("Interleaved"));
 
 		inline static const FName TrianglesStreamName = FName(TEXT("Triangles"));
 		inline static const FName DepthOnlyTrianglesStreamName = FName(TEXT("DepthOnlyTriangles"));
@@ -37,6 +38,8 @@ namespace RealtimeMesh
 		inline static const FRealtimeMeshStreamKey Tangents = FRealtimeMeshStreamKey(ERealtimeMeshStreamType::Vertex, TangentsStreamName);
 		inline static const FRealtimeMeshStreamKey TexCoords = FRealtimeMeshStreamKey(ERealtimeMeshStreamType::Vertex, TexCoordsStreamName);
 		inline static const FRealtimeMeshStreamKey Color = FRealtimeMeshStreamKey(ERealtimeMeshStreamType::Vertex, ColorStreamName);
+		// GPU only stream holding position/tangents/texcoords/color packed per vertex, see FRealtimeMeshInterleavedLayout
+		inline static const FRealtimeMeshStreamKey Interleaved = FRealtimeMeshStreamKey(ERealtimeMeshStreamType::Vertex, InterleavedStreamName);
 
 		inline static const FRealtimeMeshStreamKey Triangles = FRealtimeMeshStreamKey(ERealtimeMeshStreamType::Index, TrianglesStreamName);
 		inline static const FRealtimeMeshStreamKey DepthOnlyTriangles = FRealtimeMeshStreamKey(ERealtimeMeshStreamType::Index, DepthOnlyTrianglesStreamName);
@@ -187,11 +190,25 @@ namespace RealtimeMesh
 		using ElementAllocatorType = AllocatorType::ForAnyElementType;
 		using USizeType = TMakeUnsigned<SizeType>::Type;
 
+		/*
+		 * Immutable ref-counted allocation shared between streams.
+		 * Once a stream has been converted to shared storage, copies of it only add a reference,
+		 * and any mutation detaches the stream back into its own allocation (copy on write).
+		 */
+		struct FSharedStorage
+		{
+			ElementAllocatorType Allocator;
+		};
+		using FSharedStoragePtr = TSharedPtr<FSharedStorage, ESPMode::ThreadSafe>;
+
 		FRealtimeMeshBufferLayout Layout;
 
 		ElementAllocatorType Allocator;
+		FSharedStoragePtr SharedStorage;
 		SizeType ArrayNum;
 		SizeType ArrayMax;
+		SizeType DirtyRangeStart;
+		SizeType DirtyRangeEnd;
 		FRealtimeMeshStreamLinkage* Linkage;
 		
 		FRealtimeMeshStreamKey StreamKey;
@@ -200,6 +217,9 @@ namespace RealtimeMesh
 		uint8 ElementStride;
 		uint8 Alignment;
 
+		// Writes go straight to the shared storage instead of detaching, never copied to other streams
+		bool bWritesSharedStorage;
+
 		FORCEINLINE void CacheStrides()
 		{
 			ElementStride = FRealtimeMeshBufferLayoutUtilities::GetElementStride(Layout.GetElementType());
@@ -211,8 +231,11 @@ namespace RealtimeMesh
 			: Layout(FRealtimeMeshBufferLayout::Invalid)
 			, ArrayNum(0)
 			, ArrayMax(Allocator.GetInitialCapacity())
+			, DirtyRangeStart(0)
+			, DirtyRangeEnd(0)
 			, Linkage(nullptr)
 			, StreamKey(ERealtimeMeshStreamType::Unknown, NAME_None)
+			, bWritesSharedStorage(false)
 		{
 			CacheStrides();
 		}
@@ -221,8 +244,11 @@ namespace RealtimeMesh
 			: Layout(InLayout)
 			, ArrayNum(0)
 			, ArrayMax(Allocator.GetInitialCapacity())
+			, DirtyRangeStart(0)
+			, DirtyRangeEnd(0)
 			, Linkage(nullptr)
 			, StreamKey(InStreamKey)
+			, bWritesSharedStorage(false)
 		{
 			CacheStrides();
 		}
@@ -231,27 +257,44 @@ namespace RealtimeMesh
 			: Layout(Other.Layout)
 			, ArrayNum(0)
 			, ArrayMax(Allocator.GetInitialCapacity())
+			, DirtyRangeStart(Other.DirtyRangeStart)
+			, DirtyRangeEnd(Other.DirtyRangeEnd)
 			, Linkage(nullptr)
 			, StreamKey(Other.StreamKey)
+			, bWritesSharedStorage(false)
 		{
 			CacheStrides();
+
+			// Shared storage is immutable, so we can just reference it
+			if (Other.IsSharedStorage())
+			{
+				SharedStorage = Other.SharedStorage;
+				ArrayNum = Other.ArrayNum;
+				ArrayMax = Other.ArrayMax;
+				return;
+			}
 			
 			ResizeAllocation(Other.Num());
 			ArrayNum = Other.Num();
-			FMemory::Memcpy(Allocator.GetAllocation(), Other.Allocator.GetAllocation(), Other.Num() * GetStride());			
+			FMemory::Memcpy(Allocator.GetAllocation(), Other.Allocator.GetAllocation(), Other.Num() * GetStride());
+			TrackBytesCopied(Other.Num() * GetStride());
 		}
 		
 		explicit FRealtimeMeshStream(FRealtimeMeshStream&& Other) noexcept
 			: Layout(Other.Layout)
 			, ArrayNum(Other.ArrayNum)
 			, ArrayMax(Other.ArrayMax)
+			, DirtyRangeStart(Other.DirtyRangeStart)
+			, DirtyRangeEnd(Other.DirtyRangeEnd)
 			, Linkage(nullptr)
 			, StreamKey(Other.StreamKey)
+			, bWritesSharedStorage(false)
 		{
 			CacheStrides();
 			
 			Other.UnLink();
 			Allocator.MoveToEmpty(Other.Allocator);
+			SharedStorage = MoveTemp(Other.SharedStorage);
 
 			Other.Layout = FRealtimeMeshBufferLayout::Invalid;
 			Other.ArrayNum = 0;
@@ -280,13 +323,30 @@ namespace RealtimeMesh
 			StreamKey = Other.StreamKey;
 			Layout = Other.Layout;			
 			CacheStrides();
+			DirtyRangeStart = Other.DirtyRangeStart;
+			DirtyRangeEnd = Other.DirtyRangeEnd;
 
 			UnLink();
-			
+
+			// Shared storage is immutable, so we can just reference it and drop our own allocation
+			if (Other.IsSharedStorage())
+			{
+				if (this != &Other)
+				{
+					ReleaseAllocation();
+					SharedStorage = Other.SharedStorage;
+					ArrayNum = Other.ArrayNum;
+					ArrayMax = Other.ArrayMax;
+				}
+				return *this;
+			}
+
+			DetachSharedStorage(false);
 			ResizeAllocation(Other.Num(), false);			
 			ArrayNum = Other.Num();
 			
 			FMemory::Memcpy(Allocator.GetAllocation(), Other.Allocator.GetAllocation(), Other.Num() * GetStride());
+			TrackBytesCopied(Other.Num() * GetStride());
 			
 			return *this;
 		}
@@ -299,9 +359,14 @@ namespace RealtimeMesh
 			StreamKey = MoveTemp(Other.StreamKey);
 			Layout = MoveTemp(Other.Layout);		
 			CacheStrides();
+			DirtyRangeStart = Other.DirtyRangeStart;
+			DirtyRangeEnd = Other.DirtyRangeEnd;
 			
+			ReleaseAllocation();
 			ArrayNum = Other.ArrayNum;
+			ArrayMax = Other.ArrayMax;
 			Allocator.MoveToEmpty(Other.Allocator);
+			SharedStorage = MoveTemp(Other.SharedStorage);
 
 			Other.ArrayNum = 0;
 			Other.ArrayMax = Other.Allocator.GetInitialCapacity();
@@ -311,6 +376,105 @@ namespace RealtimeMesh
 
 
 	public:
+		/**
+		 * @brief Moves the data of this stream into immutable ref-counted storage.
+		 *
+		 * @details After this, copying the stream (copy constructor/assignment, FRealtimeMeshStreamSet::AddStream etc)
+		 * only adds a reference to the same bytes instead of copying them. Any mutation of this stream or one of its copies
+		 * will detach that stream into its own allocation first, copying the data only if it's still referenced elsewhere.
+		 * This is used to let the CPU side copy of a stream and the GPU upload share the same memory.
+		 */
+		void ConvertToSharedStorage()
+		{
+			if (!SharedStorage.IsValid())
+			{
+				SharedStorage = MakeShared<FSharedStorage, ESPMode::ThreadSafe>();
+				SharedStorage->Allocator.MoveToEmpty(Allocator);
+			}
+		}
+
+		/**
+		 * @brief Is this stream currently referencing shared immutable storage.
+		 */
+		bool IsSharedStorage() const { return SharedStorage.IsValid(); }
+
+		/**
+		 * @brief Is this stream referencing the same shared storage as another stream.
+		 */
+		bool SharesStorageWith(const FRealtimeMeshStream& Other) const { return SharedStorage.IsValid() && SharedStorage == Other.SharedStorage; }
+
+		/**
+		 * @brief Is the other stream the only other reference to this stream's shared storage.
+		 */
+		bool IsSharedStorageOnlySharedWith(const FRealtimeMeshStream& Other) const { return SharesStorageWith(Other) && SharedStorage.GetSharedReferenceCount() == 2; }
+
+		/**
+		 * @brief Write element data straight into the shared storage instead of detaching from it.
+		 * @details Only for when the caller guarantees nothing reads the other references while writing, like a
+		 * pending upload that will send the edited rows anyway. Resizing still detaches as usual.
+		 */
+		void SetWritesSharedStorage(bool bInWritesSharedStorage) { bWritesSharedStorage = bInWritesSharedStorage; }
+
+		/**
+		 * @brief Get the total number of bytes copied between streams, through copies or copy-on-write detaches.
+		 *
+		 * @details This is a process wide counter intended for profiling and tests.
+		 */
+		static uint64 GetTotalBytesCopied();
+
+		/**
+		 * @brief Marks a range of rows as modified.
+		 *
+		 * @details The dirty range is the hull of all ranges marked since the last ClearDirtyRange.
+		 * SetRange, FillRange, ZeroRange and SetGenerated mark the rows they write automatically,
+		 * writes made directly through GetData/GetDataAtVertex/array views need to be marked by the caller.
+		 * This is used to upload only the modified part of a stream to the GPU.
+		 *
+		 * @param StartIndex The first row that was modified.
+		 * @param Count The number of rows that were modified.
+		 */
+		void MarkRangeDirty(int32 StartIndex, int32 Count)
+		{
+			if (Count <= 0)
+			{
+				return;
+			}
+
+			if (HasDirtyRange())
+			{
+				DirtyRangeStart = FMath::Min(DirtyRangeStart, StartIndex);
+				DirtyRangeEnd = FMath::Max(DirtyRangeEnd, StartIndex + Count);
+			}
+			else
+			{
+				DirtyRangeStart = StartIndex;
+				DirtyRangeEnd = StartIndex + Count;
+			}
+		}
+
+		/**
+		 * @brief Does this stream have any rows marked as modified since the last ClearDirtyRange.
+		 */
+		bool HasDirtyRange() const { return DirtyRangeEnd > DirtyRangeStart; }
+
+		/**
+		 * @brief Get the range of rows [Start, End) marked as modified, clamped to the current size of the stream.
+		 */
+		TRange<int32> GetDirtyRange() const
+		{
+			const int32 End = FMath::Min(DirtyRangeEnd, ArrayNum);
+			return End > DirtyRangeStart ? TRange<int32>(DirtyRangeStart, End) : TRange<int32>::Empty();
+		}
+
+		/**
+		 * @brief Clears the modified range tracking.
+		 */
+		void ClearDirtyRange()
+		{
+			DirtyRangeStart = 0;
+			DirtyRangeEnd = 0;
+		}
+		
 		/**
 		 * @brief Get the name of this RealtimeMeshStream.
 		 *
@@ -428,16 +592,19 @@ namespace RealtimeMesh
 			{
 				const auto& Converter = FRealtimeMeshTypeConversionUtilities::GetTypeConverter(FromType, ToType);
 
-				// Move existing data to temp allocator
+				// Move existing data to temp allocator, shared storage we just keep a reference to while we convert out of it
 				ElementAllocatorType OldData;				
 				OldData.MoveToEmpty(Allocator);
+				const FSharedStoragePtr OldSharedStorage = MoveTemp(SharedStorage);
+				const void* OldDataPtr = OldSharedStorage.IsValid()? OldSharedStorage->Allocator.GetAllocation() : OldData.GetAllocation();
 
 				// Resize allocator to correct size for new data type
-				Allocator.ResizeAllocation(0, ArrayMax, GetStride());
+				const uint32 NewStride = FRealtimeMeshBufferLayoutUtilities::GetElementStride(ToType) * NewLayout.GetNumElements();
+				Allocator.ResizeAllocation(0, ArrayMax, NewStride, FRealtimeMeshBufferLayoutUtilities::GetElementAlignment(ToType));
 
 				// Now convert data from the temp array into the new allocation
 				const SIZE_T ElementCount = ArrayNum * GetNumElements();
-				Converter.ConvertContiguousArray(OldData.GetAllocation(), Allocator.GetAllocation(), ElementCount);
+				Converter.ConvertContiguousArray(OldDataPtr, Allocator.GetAllocation(), ElementCount);
 				Layout = NewLayout;
 				CacheStrides();
 				return true;
@@ -501,7 +668,7 @@ namespace RealtimeMesh
 			check(sizeof(DataType) == GetElementStride());
 			check(GetRealtimeMeshDataElementType<DataType>() == GetLayout().GetElementType());
 
-			return MakeArrayView(reinterpret_cast<const DataType*>(GetData()), Num() * GetNumElements());
+			return MakeArrayView(reinterpret_cast<const DataType*>(GetAllocation()), Num() * GetNumElements());
 		}
 		
 		template <typename DataType>
@@ -513,15 +680,15 @@ namespace RealtimeMesh
 			return MakeArrayView(reinterpret_cast<const DataType*>(GetData()), Num() * GetNumElements());
 		}
 
-		virtual const void* GetResourceData() const override { return Allocator.GetAllocation(); }
+		virtual const void* GetResourceData() const override { return GetAllocation(); }
 		virtual uint32 GetResourceDataSize() const override { return Num() * GetStride(); }
 		virtual void Discard() override	{ }
 		virtual bool IsStatic() const override { return false; }
 		virtual bool GetAllowCPUAccess() const override { return false; }
 		virtual void SetAllowCPUAccess(bool bInNeedsCPUAccess) override { }
 
-		const uint8* GetData() const { return reinterpret_cast<const uint8*>(Allocator.GetAllocation()); }
-		uint8* GetData() { return reinterpret_cast<uint8*>(Allocator.GetAllocation()); }
+		const uint8* GetData() const { return reinterpret_cast<const uint8*>(GetAllocation()); }
+		uint8* GetData() { return reinterpret_cast<uint8*>(GetMutableAllocation()); }
 
 
 		const uint8* GetDataRawAtVertex(int32 VertexIndex) const
@@ -551,10 +718,10 @@ namespace RealtimeMesh
 		}
 
 		template <typename ElementType>
-		const ElementType* GetData() const { return reinterpret_cast<const ElementType*>(Allocator.GetAllocation()); }
+		const ElementType* GetData() const { return reinterpret_cast<const ElementType*>(GetAllocation()); }
 
 		template <typename ElementType>
-		ElementType* GetData() { return reinterpret_cast<ElementType*>(Allocator.GetAllocation()); }
+		ElementType* GetData() { return reinterpret_cast<ElementType*>(GetMutableAllocation()); }
 
 
 		template <typename ElementType>
@@ -597,6 +764,7 @@ namespace RealtimeMesh
 		FORCEINLINE SizeType AddUninitialized()
 		{
 			CheckInvariants();
+			DetachSharedStorage();
 
 			const USizeType OldNum = static_cast<USizeType>(ArrayNum);
 			const USizeType NewNum = OldNum + static_cast<USizeType>(1);
@@ -613,6 +781,7 @@ namespace RealtimeMesh
 		{
 			CheckInvariants();
 			checkSlow(Count >= 0);
+			DetachSharedStorage();
 
 			const USizeType OldNum = static_cast<USizeType>(ArrayNum);
 			const USizeType NewNum = OldNum + static_cast<USizeType>(Count);
@@ -633,7 +802,7 @@ namespace RealtimeMesh
 			CheckInvariants();
 
 			const SizeType Index = AddUninitialized(Count);
-			FMemory::Memzero(reinterpret_cast<uint8*>(Allocator.GetAllocation()) + Index * GetStride(), Count * GetStride());
+			FMemory::Memzero(GetData() + Index * GetStride(), Count * GetStride());
 			return Index;
 		}
 
@@ -656,6 +825,7 @@ namespace RealtimeMesh
 
 			ArrayNum = 0;
 			BroadcastNumChanged();
+			DetachSharedStorage(false);
 
 			if (ExpectedUseSize > ArrayMax || ArrayMax > (ExpectedUseSize + MaxSlack))
 			{
@@ -716,6 +886,8 @@ namespace RealtimeMesh
 				CheckNotNegative(Index, TEXT("Index"));
 				checkSlow(Index + Count <= ArrayNum);
 
+				DetachSharedStorage();
+
 				// Skip memmove in the common case that there is nothing to move.
 				if (const SizeType NumToMove = ArrayNum - Index - Count)
 				{
@@ -743,7 +915,8 @@ namespace RealtimeMesh
 			CheckNotNegative(Num, TEXT("Num"));
 			checkSlow(StartIndex + Num <= ArrayNum);
 
-			FMemory::Memzero(reinterpret_cast<uint8*>(Allocator.GetAllocation()) + StartIndex * GetStride(), Num * GetStride());
+			FMemory::Memzero(GetData() + StartIndex * GetStride(), Num * GetStride());
+			MarkRangeDirty(StartIndex, Num);
 		}
 
 		void FillRange(int32 StartIndex, int32 Num, const FRealtimeMeshStreamDefaultRowValue& Value)
@@ -768,7 +941,8 @@ namespace RealtimeMesh
 			{
 				FMemory::Memcpy(Dst, SrcRow, GetStride());
 				Dst += GetStride();
-			}			
+			}
+			MarkRangeDirty(StartIndex, Num);
 		}
 		
 
@@ -783,6 +957,8 @@ namespace RealtimeMesh
 				return;
 			}
 
+			MarkRangeDirty(StartIndex, Num);
+
 			const auto SourceLayout = GetRealtimeMeshBufferLayout<DataType>();
 			
 			// Can we do a simple bitwise copy? This is the fastest option, but only works if the types line up exactly
@@ -927,6 +1103,7 @@ namespace RealtimeMesh
 
 		void SetRange(uint32 DestinationIndex, const FRealtimeMeshBufferLayout& SourceLayout, const uint8* const SourceData, uint32 SourceCount)
 		{
+			MarkRangeDirty(DestinationIndex, SourceCount);
 			CopyStreamDataIntoStream(Layout, GetDataRawAtVertex(DestinationIndex), 0, SourceLayout, SourceData, SourceCount);
 		}
 		
@@ -939,6 +1116,7 @@ namespace RealtimeMesh
 			}
 			
 			RangeCheck(StartIndex + Count - 1);
+			MarkRangeDirty(StartIndex, Count);
 
 			const auto SourceLayout = GetRealtimeMeshBufferLayout<VertexType>();
 			
@@ -990,6 +1168,7 @@ namespace RealtimeMesh
 			// TODO: Upgrade this like SetGenerated
 			RangeCheck(StartIndex + Count - 1);
 			ElementCheck(ElementIndex);
+			MarkRangeDirty(StartIndex, Count);
 			
 			ElementType* DataPtr = GetDataAtVertex<ElementType>(StartIndex, ElementIndex);
 
@@ -1003,7 +1182,7 @@ namespace RealtimeMesh
 		template <typename VertexType>
 		void CopyRange(int32 StartIndex, TArrayView<VertexType> OutputElements) const
 		{
-			CopyRange(StartIndex, GetRealtimeMeshBufferLayout<VertexType>(), OutputElements.GetData(), OutputElements.Num());
+			CopyRange(StartIndex, GetRealtimeMeshBufferLayout<VertexType>(), reinterpret_cast<uint8*>(OutputElements.GetData()), OutputElements.Num());
 		}
 		
 		template <typename VertexType>
@@ -1082,10 +1261,64 @@ namespace RealtimeMesh
 			}
 		}
 
+		FORCEINLINE const void* GetAllocation() const
+		{
+			return SharedStorage.IsValid()? SharedStorage->Allocator.GetAllocation() : Allocator.GetAllocation();
+		}
+
+		FORCEINLINE void* GetMutableAllocation()
+		{
+			if (bWritesSharedStorage && SharedStorage.IsValid())
+			{
+				return SharedStorage->Allocator.GetAllocation();
+			}
+			DetachSharedStorage();
+			return Allocator.GetAllocation();
+		}
+
+		FORCEINLINE void DetachSharedStorage(bool bKeepElements = true)
+		{
+			if (SharedStorage.IsValid())
+			{
+				DetachSharedStorageSlow(bKeepElements);
+			}
+		}
+
+		void DetachSharedStorageSlow(bool bKeepElements)
+		{
+			check(Allocator.GetAllocation() == nullptr);
+			
+			if (SharedStorage.IsUnique())
+			{
+				// We're the last reference, so we can just take the allocation back
+				Allocator.MoveToEmpty(SharedStorage->Allocator);
+			}
+			else
+			{
+				Allocator.ResizeAllocation(0, ArrayMax, Stride, Alignment);
+				if (bKeepElements && ArrayNum > 0)
+				{
+					FMemory::Memcpy(Allocator.GetAllocation(), SharedStorage->Allocator.GetAllocation(), ArrayNum * GetStride());
+					TrackBytesCopied(ArrayNum * GetStride());
+				}
+			}
+			SharedStorage.Reset();
+		}
+
+		void ReleaseAllocation()
+		{
+			SharedStorage.Reset();
+			ElementAllocatorType OldData;
+			OldData.MoveToEmpty(Allocator);
+		}
+
+		static void TrackBytesCopied(uint64 NumBytes);
+
 		void ResizeAllocation(USizeType NewNum, bool bKeepElements = true)
 		{
 			if (NewNum != ArrayMax)
 			{
+				DetachSharedStorage(bKeepElements);
 				Allocator.ResizeAllocation(bKeepElements? ArrayNum : 0, NewNum, Stride, Alignment);
 				ArrayMax = NewNum;
 				BroadcastAllocatedSizeChanged();
@@ -1098,6 +1331,7 @@ namespace RealtimeMesh
 
 			if (NewAllocationSize != ArrayMax)
 			{
+				DetachSharedStorage();
 				Allocator.ResizeAllocation(ArrayNum, NewAllocationSize, Stride, Alignment);
 				ArrayMax = NewAllocationSize;
 				BroadcastAllocatedSizeChanged();
@@ -1110,6 +1344,7 @@ namespace RealtimeMesh
 
 			if (NewAllocationSize != ArrayMax)
 			{
+				DetachSharedStorage();
 				Allocator.ResizeAllocation(ArrayNum, NewAllocationSize, Stride, Alignment);
 				ArrayMax = NewAllocationSize;
 				BroadcastAllocatedSizeChanged();
@@ -87,6 +87,10 @@ namespace RealtimeMesh
 			FRealtimeMeshElementType(ERealtimeMeshDatumType::RGB10A2, 1),
 			FRealtimeMeshElementTypeDetails(VET_URGB10A2N, IET_None, PF_A2B10G10R10, sizeof(uint32), alignof(uint32))
 		},
+		{
+			FRealtimeMeshElementType(ERealtimeMeshDatumType::Int16Octahedral, 2),
+			FRealtimeMeshElementTypeDetails(VET_Short2N, IET_None, PF_G16R16_SNORM, sizeof(int16) * 2, alignof(int16))
+		},
 		{
 			FRealtimeMeshElementType(ERealtimeMeshDatumType::Int16, 1),
 			FRealtimeMeshElementTypeDetails(VET_None, IET_Int16, PF_R16_SINT, sizeof(int16), alignof(int16))
@@ -142,6 +146,8 @@ namespace RealtimeMesh
 
 		case ERealtimeMeshDatumType::RGB10A2:
 			return "RGB10A2";
+		case ERealtimeMeshDatumType::Int16Octahedral:
+			return "Int16Octahedral";
 
 		case ERealtimeMeshDatumType::Unknown:
 		default:
@@ -162,6 +168,7 @@ namespace RealtimeMesh
 		case ERealtimeMeshDatumType::UInt16:
 			return sizeof(uint16);
 		case ERealtimeMeshDatumType::Int16:
+		case ERealtimeMeshDatumType::Int16Octahedral:
 			return sizeof(int16);
 
 		case ERealtimeMeshDatumType::UInt32:
@@ -198,6 +205,7 @@ namespace RealtimeMesh
 		case ERealtimeMeshDatumType::UInt16:
 			return alignof(uint16);
 		case ERealtimeMeshDatumType::Int16:
+		case ERealtimeMeshDatumType::Int16Octahedral:
 			return alignof(int16);
 
 		case ERealtimeMeshDatumType::UInt32:
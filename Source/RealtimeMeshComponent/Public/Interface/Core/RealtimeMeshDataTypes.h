@@ -43,6 +43,177 @@ namespace RealtimeMesh
 		enum { Value = N };
 	};
 
+	/*
+	 * Unit vector packed into 32 bits with an octahedral mapping, stored as two 16 bit normalized values.
+	 * The lowest bit of Y holds the sign of W so it can be used as the normal of a tangent frame.
+	 */
+	struct FRealtimeMeshOctahedralNormal
+	{
+		int16 X;
+		int16 Y;
+
+		FRealtimeMeshOctahedralNormal() = default;
+		FRealtimeMeshOctahedralNormal(const FVector3f& InVector) { Set(InVector, 1.0f); }
+		FRealtimeMeshOctahedralNormal(const FVector3d& InVector) { Set(FVector3f(InVector), 1.0f); }
+		FRealtimeMeshOctahedralNormal(const FVector4f& InVector) { Set(FVector3f(InVector), InVector.W); }
+		FRealtimeMeshOctahedralNormal(const FVector4d& InVector) { Set(FVector3f(InVector), InVector.W); }
+
+		void Set(const FVector3f& InVector, float InW)
+		{
+			const float L1Norm = FMath::Abs(InVector.X) + FMath::Abs(InVector.Y) + FMath::Abs(InVector.Z);
+			float U = 0.0f;
+			float V = 0.0f;
+			if (L1Norm > UE_SMALL_NUMBER)
+			{
+				U = InVector.X / L1Norm;
+				V = InVector.Y / L1Norm;
+				if (InVector.Z < 0.0f)
+				{
+					// Fold the lower hemisphere over the diagonals
+					const float FoldedU = (1.0f - FMath::Abs(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+					const float FoldedV = (1.0f - FMath::Abs(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+					U = FoldedU;
+					V = FoldedV;
+				}
+			}
+
+			X = static_cast<int16>(FMath::Clamp<int32>(FMath::RoundToInt(U * MAX_int16), -MAX_int16, MAX_int16));
+			const int32 PackedY = FMath::Clamp<int32>(FMath::RoundToInt(V * MAX_int16), -MAX_int16, MAX_int16);
+			Y = static_cast<int16>((PackedY & ~1) | (InW < 0.0f ? 1 : 0));
+		}
+
+		FVector3f ToFVector3f() const
+		{
+			const float U = FMath::Clamp(X / static_cast<float>(MAX_int16), -1.0f, 1.0f);
+			const float V = FMath::Clamp((Y & ~1) / static_cast<float>(MAX_int16), -1.0f, 1.0f);
+
+			FVector3f Result(U, V, 1.0f - FMath::Abs(U) - FMath::Abs(V));
+			const float Fold = FMath::Max(-Result.Z, 0.0f);
+			Result.X += Result.X >= 0.0f ? -Fold : Fold;
+			Result.Y += Result.Y >= 0.0f ? -Fold : Fold;
+			return Result.GetUnsafeNormal();
+		}
+
+		FVector4f ToFVector4f() const { return FVector4f(ToFVector3f(), GetW()); }
+
+		float GetW() const { return (Y & 1) ? -1.0f : 1.0f; }
+
+		FORCEINLINE bool operator==(const FRealtimeMeshOctahedralNormal& Other) const { return X == Other.X && Y == Other.Y; }
+		FORCEINLINE bool operator!=(const FRealtimeMeshOctahedralNormal& Other) const { return X != Other.X || Y != Other.Y; }
+	};
+
+	/*
+	 * Vector packed into 10:10:10:2 bits with the same layout as the R10G10B10A2 formats.
+	 * XYZ are biased into the unsigned range so a unorm fetch decodes with a single multiply add,
+	 * W only keeps its sign.
+	 */
+	struct FRealtimeMeshPackedRGB10A2N
+	{
+		uint32 Packed;
+
+		FRealtimeMeshPackedRGB10A2N() = default;
+		FRealtimeMeshPackedRGB10A2N(const FVector3f& InVector) { Set(FVector4f(InVector, 1.0f)); }
+		FRealtimeMeshPackedRGB10A2N(const FVector3d& InVector) { Set(FVector4f(FVector3f(InVector), 1.0f)); }
+		FRealtimeMeshPackedRGB10A2N(const FVector4f& InVector) { Set(InVector); }
+		FRealtimeMeshPackedRGB10A2N(const FVector4d& InVector) { Set(FVector4f(InVector)); }
+
+		void Set(const FVector4f& InVector)
+		{
+			auto Pack = [](float Value) -> uint32
+			{
+				return static_cast<uint32>(FMath::Clamp<int32>(FMath::RoundToInt((Value * 0.5f + 0.5f) * 1023.0f), 0, 1023));
+			};
+			Packed = Pack(InVector.X) | (Pack(InVector.Y) << 10) | (Pack(InVector.Z) << 20) | ((InVector.W < 0.0f ? 0u : 3u) << 30);
+		}
+
+		FVector3f ToFVector3f() const
+		{
+			auto Unpack = [](uint32 Value) -> float
+			{
+				return static_cast<float>(Value & 1023) * (2.0f / 1023.0f) - 1.0f;
+			};
+			return FVector3f(Unpack(Packed), Unpack(Packed >> 10), Unpack(Packed >> 20));
+		}
+
+		FVector4f ToFVector4f() const { return FVector4f(ToFVector3f(), GetW()); }
+
+		float GetW() const { return (Packed >> 30) >= 2 ? 1.0f : -1.0f; }
+
+		FORCEINLINE bool operator==(const FRealtimeMeshPackedRGB10A2N& Other) const { return Packed == Other.Packed; }
+		FORCEINLINE bool operator!=(const FRealtimeMeshPackedRGB10A2N& Other) const { return Packed != Other.Packed; }
+	};
+
+	/*
+	 * Position quantized to 16 bits per axis within the bounds described by a FRealtimeMeshPositionQuantization.
+	 * W is padding so rows stay 8 bytes.
+	 */
+	struct FRealtimeMeshQuantizedPosition
+	{
+		uint16 X;
+		uint16 Y;
+		uint16 Z;
+		uint16 W;
+
+		FORCEINLINE bool operator==(const FRealtimeMeshQuantizedPosition& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z && W == Other.W; }
+		FORCEINLINE bool operator!=(const FRealtimeMeshQuantizedPosition& Other) const { return !(*this == Other); }
+	};
+
+	/*
+	 * Scale and bias that map quantized positions back to local space, Position = Quantized * Scale + Bias.
+	 * Each section group carries its own in its config.
+	 */
+	struct FRealtimeMeshPositionQuantization
+	{
+		FVector3f Scale;
+		FVector3f Bias;
+
+		FRealtimeMeshPositionQuantization()
+			: Scale(FVector3f::OneVector)
+			, Bias(FVector3f::ZeroVector)
+		{ }
+
+		FRealtimeMeshPositionQuantization(const FVector3f& InScale, const FVector3f& InBias)
+			: Scale(InScale)
+			, Bias(InBias)
+		{ }
+
+		/* Spreads the full 16 bit range over the supplied bounds */
+		static FRealtimeMeshPositionQuantization FromBounds(const FBox3f& Bounds)
+		{
+			if (!Bounds.IsValid)
+			{
+				return FRealtimeMeshPositionQuantization(FVector3f::ZeroVector, FVector3f::ZeroVector);
+			}
+			return FRealtimeMeshPositionQuantization((Bounds.Max - Bounds.Min) / static_cast<float>(MAX_uint16), Bounds.Min);
+		}
+
+		FRealtimeMeshQuantizedPosition Quantize(const FVector3f& Position) const
+		{
+			auto QuantizeAxis = [](float Value, float AxisScale, float AxisBias) -> uint16
+			{
+				return AxisScale > 0.0f? static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt((Value - AxisBias) / AxisScale), 0, MAX_uint16)) : 0;
+			};
+			return FRealtimeMeshQuantizedPosition
+			{
+				QuantizeAxis(Position.X, Scale.X, Bias.X),
+				QuantizeAxis(Position.Y, Scale.Y, Bias.Y),
+				QuantizeAxis(Position.Z, Scale.Z, Bias.Z),
+				0
+			};
+		}
+
+		FVector3f Dequantize(const FRealtimeMeshQuantizedPosition& Position) const
+		{
+			return FVector3f(Position.X, Position.Y, Position.Z) * Scale + Bias;
+		}
+
+		/* Largest distance per axis between a position within the bounds and its dequantized value */
+		FVector3f GetMaxError() const { return Scale * 0.5f; }
+
+		bool operator==(const FRealtimeMeshPositionQuantization& Other) const { return Scale == Other.Scale && Bias == Other.Bias; }
+		bool operator!=(const FRealtimeMeshPositionQuantization& Other) const { return !(*this == Other); }
+	};
+
 	namespace Internal
 	{
 		template<typename NormalType>
@@ -60,6 +231,16 @@ namespace RealtimeMesh
 		{
 			Normal.W = static_cast<int16>(FMath::Clamp<int32>(FMath::RoundToInt(Sign * MIN_int16), MIN_int16, MAX_int16));
 		}
+		template<>
+		inline void SetRealtimeMeshNormalWToSign<FRealtimeMeshOctahedralNormal>(FRealtimeMeshOctahedralNormal& Normal, float Sign)
+		{
+			Normal.Set(Normal.ToFVector3f(), Sign);
+		}
+		template<>
+		inline void SetRealtimeMeshNormalWToSign<FRealtimeMeshPackedRGB10A2N>(FRealtimeMeshPackedRGB10A2N& Normal, float Sign)
+		{
+			Normal.Packed = (Normal.Packed & 0x3FFFFFFF) | ((Sign < 0.0f ? 0u : 3u) << 30);
+		}
 
 		inline FVector4f GetTangentAsVector(const FVector4f& Input)
 		{
@@ -75,6 +256,16 @@ namespace RealtimeMesh
 		{
 			return Input.ToFVector4f();
 		}
+
+		inline FVector4f GetTangentAsVector(const FRealtimeMeshOctahedralNormal& Input)
+		{
+			return Input.ToFVector4f();
+		}
+
+		inline FVector4f GetTangentAsVector(const FRealtimeMeshPackedRGB10A2N& Input)
+		{
+			return Input.ToFVector4f();
+		}
 		
 	}
 
@@ -132,11 +323,21 @@ namespace RealtimeMesh
 			: Tangent(Other.Tangent.ToFVector4f()), Normal(Other.Normal.ToFVector4f())
 		{
 		}
+		
+		TRealtimeMeshTangents(const TRealtimeMeshTangents<FRealtimeMeshOctahedralNormal>& Other)
+			: Tangent(Other.Tangent.ToFVector4f()), Normal(Other.Normal.ToFVector4f())
+		{
+		}
+		
+		TRealtimeMeshTangents(const TRealtimeMeshTangents<FRealtimeMeshPackedRGB10A2N>& Other)
+			: Tangent(Other.Tangent.ToFVector4f()), Normal(Other.Normal.ToFVector4f())
+		{
+		}
 
 		FVector3f GetNormal() const { return Internal::GetTangentAsVector(Normal); }
 		FVector3f GetTangent() const { return Internal::GetTangentAsVector(Tangent); }
 
-		bool IsBinormalFlipped() const { return Normal.W < 0.0f; }
+		bool IsBinormalFlipped() const { return Internal::GetTangentAsVector(Normal).W < 0.0f; }
 
 		void SetFlipBinormal(bool bShouldFlipBinormal)
 		{
@@ -200,6 +401,8 @@ namespace RealtimeMesh
 
 	using FRealtimeMeshTangentsHighPrecision = TRealtimeMeshTangents<FPackedRGBA16N>;
 	using FRealtimeMeshTangentsNormalPrecision = TRealtimeMeshTangents<FPackedNormal>;
+	using FRealtimeMeshTangentsOctahedral = TRealtimeMeshTangents<FRealtimeMeshOctahedralNormal>;
+	using FRealtimeMeshTangentsPackedRGB10A2N = TRealtimeMeshTangents<FRealtimeMeshPackedRGB10A2N>;
 	
 
 	template <typename ChannelType, int32 ChannelCount>
@@ -436,6 +639,11 @@ namespace RealtimeMesh
 		Int8Float,
 		// Specific type for a tightly packed element
 		RGB10A2,
+		// Customized version of Int16, a pair of them hold an octahedral encoded unit vector
+		Int16Octahedral,
+
+		// Number of datum types, not a valid type. New types go above this
+		Count,
 	};
 
 	enum EIndexElementType
@@ -639,6 +847,9 @@ namespace RealtimeMesh
 	RMC_DEFINE_ELEMENT_TYPE(FVector4d, ERealtimeMeshDatumType::Double, 4);
 	RMC_DEFINE_ELEMENT_TYPE(FIntVector, ERealtimeMeshDatumType::Int32, 3);
 	RMC_DEFINE_ELEMENT_TYPE(FIntPoint, ERealtimeMeshDatumType::Int32, 2);
+	RMC_DEFINE_ELEMENT_TYPE(FRealtimeMeshOctahedralNormal, ERealtimeMeshDatumType::Int16Octahedral, 2);
+	RMC_DEFINE_ELEMENT_TYPE(FRealtimeMeshPackedRGB10A2N, ERealtimeMeshDatumType::RGB10A2, 1);
+	RMC_DEFINE_ELEMENT_TYPE(FRealtimeMeshQuantizedPosition, ERealtimeMeshDatumType::UInt16, 4);
 
 	
 
@@ -765,6 +976,10 @@ namespace RealtimeMesh
 	static_assert(FRealtimeMeshBufferTypeTraits<FRealtimeMeshTexCoordsNormal>::IsValid);
 	static_assert(FRealtimeMeshBufferTypeTraits<FRealtimeMeshTangentsHighPrecision>::IsValid);
 	static_assert(FRealtimeMeshBufferTypeTraits<FIndex3UI>::IsValid);
+	static_assert(FRealtimeMeshBufferTypeTraits<FRealtimeMeshTangentsOctahedral>::IsValid);
+	static_assert(sizeof(FRealtimeMeshOctahedralNormal) == 4);
+	static_assert(sizeof(FRealtimeMeshPackedRGB10A2N) == 4);
+	static_assert(sizeof(FRealtimeMeshQuantizedPosition) == 8);
 
 	 
 #if WITH_EDITORONLY_DATA
@@ -0,0 +1,123 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "RealtimeMeshInterleavedLayout.h"
+
+namespace RealtimeMesh
+{
+	TConstArrayView<FRealtimeMeshStreamKey> FRealtimeMeshInterleavedLayout::GetInterleavableStreams()
+	{
+		static const FRealtimeMeshStreamKey InterleavableStreams[] =
+		{
+			FRealtimeMeshStreams::Position,
+			FRealtimeMeshStreams::Tangents,
+			FRealtimeMeshStreams::TexCoords,
+			FRealtimeMeshStreams::Color,
+		};
+		return InterleavableStreams;
+	}
+
+	bool FRealtimeMeshInterleavedLayout::CanInterleaveStream(const FRealtimeMeshStreamKey& StreamKey)
+	{
+		return GetInterleavableStreams().Contains(StreamKey);
+	}
+
+	FRealtimeMeshInterleavedLayout FRealtimeMeshInterleavedLayout::Create(const FRealtimeMeshStreamSet& Streams)
+	{
+		FRealtimeMeshInterleavedLayout Layout;
+
+		const FRealtimeMeshStream* PositionStream = Streams.Find(FRealtimeMeshStreams::Position);
+		if (PositionStream == nullptr || PositionStream->Num() == 0)
+		{
+			return Layout;
+		}
+
+		int32 NumVertices = TNumericLimits<int32>::Max();
+		uint32 Offset = 0;
+		for (const FRealtimeMeshStreamKey& StreamKey : GetInterleavableStreams())
+		{
+			const FRealtimeMeshStream* Stream = Streams.Find(StreamKey);
+			if (Stream == nullptr || Stream->Num() == 0)
+			{
+				continue;
+			}
+
+			// A single color applies to every vertex, same as the zero stride binding of a separate color buffer
+			if (!(StreamKey == FRealtimeMeshStreams::Color && Stream->Num() == 1))
+			{
+				NumVertices = FMath::Min(NumVertices, Stream->Num());
+			}
+
+			FRealtimeMeshInterleavedElement& Element = Layout.Elements.AddDefaulted_GetRef();
+			Element.StreamKey = StreamKey;
+			Element.Layout = Stream->GetLayout();
+			Element.Offset = Offset;
+			Element.Size = Stream->GetStride();
+			Offset = Align(Offset + Element.Size, 4);
+		}
+
+		// The packed row is described as uint32's, and memory layouts store the stride in a byte
+		if (Offset > MAX_uint8 - 3)
+		{
+			return FRealtimeMeshInterleavedLayout();
+		}
+
+		Layout.Stride = Offset;
+		Layout.NumVertices = NumVertices;
+		return Layout;
+	}
+
+	const FRealtimeMeshInterleavedElement* FRealtimeMeshInterleavedLayout::Find(const FRealtimeMeshStreamKey& StreamKey) const
+	{
+		return Elements.FindByPredicate([&StreamKey](const FRealtimeMeshInterleavedElement& Element) { return Element.StreamKey == StreamKey; });
+	}
+
+	FRealtimeMeshBufferLayout FRealtimeMeshInterleavedLayout::GetBufferLayout() const
+	{
+		return IsValid()
+			? FRealtimeMeshBufferLayout(GetRealtimeMeshDataElementType<uint32>(), Stride / sizeof(uint32))
+			: FRealtimeMeshBufferLayout::Invalid;
+	}
+
+	bool FRealtimeMeshInterleavedLayout::Pack(const FRealtimeMeshStreamSet& Streams, FRealtimeMeshStream& OutStream) const
+	{
+		return PackRange(Streams, 0, NumVertices, OutStream);
+	}
+
+	bool FRealtimeMeshInterleavedLayout::PackRange(const FRealtimeMeshStreamSet& Streams, int32 StartIndex, int32 Count, FRealtimeMeshStream& OutStream) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FRealtimeMeshInterleavedLayout::PackRange);
+
+		if (!IsValid() || StartIndex < 0 || Count <= 0 || StartIndex + Count > NumVertices)
+		{
+			return false;
+		}
+
+		for (const FRealtimeMeshInterleavedElement& Element : Elements)
+		{
+			const FRealtimeMeshStream* Stream = Streams.Find(Element.StreamKey);
+			if (Stream == nullptr || Stream->GetLayout() != Element.Layout || (Stream->Num() < NumVertices && Stream->Num() != 1))
+			{
+				return false;
+			}
+		}
+
+		OutStream = FRealtimeMeshStream(FRealtimeMeshStreams::Interleaved, GetBufferLayout());
+		// Zeroed so the alignment padding doesn't upload garbage
+		OutStream.SetNumZeroed(Count);
+
+		uint8* DestData = OutStream.GetData();
+		for (const FRealtimeMeshInterleavedElement& Element : Elements)
+		{
+			const FRealtimeMeshStream& Stream = Streams.FindChecked(Element.StreamKey);
+			const uint8* SourceData = Stream.GetData();
+			const bool bRepeatFirstRow = Stream.Num() < NumVertices;
+
+			for (int32 Index = 0; Index < Count; Index++)
+			{
+				FMemory::Memcpy(DestData + Index * Stride + Element.Offset, SourceData + (bRepeatFirstRow ? 0 : (StartIndex + Index) * Element.Size), Element.Size);
+			}
+		}
+
+		return true;
+	}
+}
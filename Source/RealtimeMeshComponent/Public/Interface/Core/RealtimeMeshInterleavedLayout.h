@@ -0,0 +1,70 @@
+﻿// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "RealtimeMeshDataStream.h"
+
+namespace RealtimeMesh
+{
+	/*
+	 * Where one source stream lives within each row of an interleaved vertex buffer.
+	 */
+	struct FRealtimeMeshInterleavedElement
+	{
+		FRealtimeMeshStreamKey StreamKey;
+		FRealtimeMeshBufferLayout Layout;
+		uint32 Offset = 0;
+		uint32 Size = 0;
+
+		bool operator==(const FRealtimeMeshInterleavedElement& Other) const
+		{
+			return StreamKey == Other.StreamKey && Layout == Other.Layout && Offset == Other.Offset && Size == Other.Size;
+		}
+		bool operator!=(const FRealtimeMeshInterleavedElement& Other) const { return !(*this == Other); }
+	};
+
+	/*
+	 * Stride and offset table used to pack the vertex streams of a section group into a single strided buffer.
+	 * Position, tangents, texcoords and color are packed in that order, each starting on a 4 byte boundary.
+	 */
+	struct REALTIMEMESHCOMPONENT_INTERFACE_API FRealtimeMeshInterleavedLayout
+	{
+	private:
+		TArray<FRealtimeMeshInterleavedElement, TInlineAllocator<4>> Elements;
+		uint32 Stride = 0;
+		int32 NumVertices = 0;
+
+	public:
+		/* Vertex streams that can be packed, in the order they are packed */
+		static TConstArrayView<FRealtimeMeshStreamKey> GetInterleavableStreams();
+		static bool CanInterleaveStream(const FRealtimeMeshStreamKey& StreamKey);
+
+		/*
+		 * Builds the layout for the interleavable streams in the set.
+		 * Streams are trimmed to the shortest one, except a single row color stream which is repeated for every vertex.
+		 * The layout is invalid if there is no position stream.
+		 */
+		static FRealtimeMeshInterleavedLayout Create(const FRealtimeMeshStreamSet& Streams);
+
+		bool IsValid() const { return Elements.Num() > 0 && Stride > 0 && NumVertices > 0; }
+		uint32 GetStride() const { return Stride; }
+		int32 GetNumVertices() const { return NumVertices; }
+		TConstArrayView<FRealtimeMeshInterleavedElement> GetElements() const { return Elements; }
+		const FRealtimeMeshInterleavedElement* Find(const FRealtimeMeshStreamKey& StreamKey) const;
+
+		/* Layout of the packed stream, each row is Stride / 4 uint32's */
+		FRealtimeMeshBufferLayout GetBufferLayout() const;
+
+		/* Packs the streams into a single stream under FRealtimeMeshStreams::Interleaved. Streams must match the ones the layout was created from. */
+		bool Pack(const FRealtimeMeshStreamSet& Streams, FRealtimeMeshStream& OutStream) const;
+
+		/* Packs rows [StartIndex, StartIndex + Count) only, for writing over part of a buffer packed with this same layout */
+		bool PackRange(const FRealtimeMeshStreamSet& Streams, int32 StartIndex, int32 Count, FRealtimeMeshStream& OutStream) const;
+
+		bool operator==(const FRealtimeMeshInterleavedLayout& Other) const
+		{
+			return Stride == Other.Stride && NumVertices == Other.NumVertices && Elements == Other.Elements;
+		}
+		bool operator!=(const FRealtimeMeshInterleavedLayout& Other) const { return !(*this == Other); }
+	};
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreFwd.h"
+#include "RealtimeMeshDataTypes.h"
 
 /* The rendering path to use for this section.
  * Static has lower overhead but requires a proxy recreation on change for all components
@@ -17,14 +18,24 @@ enum class ERealtimeMeshSectionDrawType : uint8
 struct FRealtimeMeshSectionGroupConfig
 {
 	ERealtimeMeshSectionDrawType DrawType;
+
+	/* Maps a FRealtimeMeshQuantizedPosition position stream back to local space.
+	 * Positions are decoded with it when they're sent to the GPU, so it should be set before the position stream. */
+	RealtimeMesh::FRealtimeMeshPositionQuantization PositionQuantization;
+
+	/* Pack position/tangents/texcoords/color into a single strided GPU buffer instead of one buffer per stream.
+	 * Only simple meshes support this as the packing is done from their CPU copy of the streams. Range edits only repack and upload the rows they change.
+	 * Interleaved section groups are drawn without manual vertex fetch and aren't added to ray tracing scenes. */
+	bool bInterleaveVertexStreams;
 	
-	FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType InDrawType = ERealtimeMeshSectionDrawType::Static)
+	FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType InDrawType = ERealtimeMeshSectionDrawType::Static, bool bInInterleaveVertexStreams = false)
 		: DrawType(InDrawType)
+		, bInterleaveVertexStreams(bInInterleaveVertexStreams)
 	{ }
 
 	bool operator==(const FRealtimeMeshSectionGroupConfig& Other) const
 	{
-		return DrawType == Other.DrawType;
+		return DrawType == Other.DrawType && PositionQuantization == Other.PositionQuantization && bInterleaveVertexStreams == Other.bInterleaveVertexStreams;
 	}
 
 	bool operator!=(const FRealtimeMeshSectionGroupConfig& Other) const
@@ -306,226 +306,183 @@ namespace RealtimeMeshAlgo
 	                                                                      const RealtimeMesh::FRealtimeMeshStream& Indices, TMap<int32, FRealtimeMeshStreamRange>& OutStreamRanges);
 
 
+	/*
+	 * Flat vertex adjacency used for tangent generation.
+	 * Both relations are stored CSR style, the entries for vertex V are [Offsets[V], Offsets[V + 1]) of the matching array.
+	 */
+	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshVertexAdjacency
+	{
+		// Triangles referencing each vertex, in ascending triangle order
+		TArray<int32> VertexTriangleOffsets;
+		TArray<int32> VertexTriangles;
+
+		// Other vertices sharing the position of each vertex, only built when finding duplicates
+		TArray<int32> DuplicateOffsets;
+		TArray<int32> Duplicates;
+
+		/*
+		 * @brief Builds the adjacency for a triangle list.
+		 * @param Indices Flat triangle list, every index must be less than Vertices.Num()
+		 * @param Vertices Vertex positions
+		 * @param bFindDuplicates Whether to find vertices with matching positions, used for smoothing normals across UV seams
+		 */
+		void Build(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices, bool bFindDuplicates);
+
+		/*
+		 * @brief Builds the adjacency for the Triangles and Position streams of a stream set, for use with UpdateTangents.
+		 * @param StreamSet Stream set to build for
+		 * @param bFindDuplicates Whether to find vertices with matching positions, should match bComputeSmoothNormals of GenerateTangents
+		 * @return False if the stream set has no Triangles or Position stream
+		 */
+		bool Build(const RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bFindDuplicates);
+
+		int32 NumVertices() const { return FMath::Max(VertexTriangleOffsets.Num() - 1, 0); }
+		bool HasDuplicates() const { return DuplicateOffsets.Num() > 0; }
+
+		TConstArrayView<const int32> GetVertexTriangles(int32 VertexIndex) const
+		{
+			return MakeArrayView(VertexTriangles.GetData() + VertexTriangleOffsets[VertexIndex], VertexTriangleOffsets[VertexIndex + 1] - VertexTriangleOffsets[VertexIndex]);
+		}
+
+		TConstArrayView<const int32> GetDuplicates(int32 VertexIndex) const
+		{
+			return HasDuplicates()
+				? MakeArrayView(Duplicates.GetData() + DuplicateOffsets[VertexIndex], DuplicateOffsets[VertexIndex + 1] - DuplicateOffsets[VertexIndex])
+				: TConstArrayView<const int32>();
+		}
+	};
+
+	/*
+	 * @brief Generates normals and tangents for every vertex from prebuilt adjacency, in parallel.
+	 * @param Indices Flat triangle list, every index must be less than Vertices.Num()
+	 * @param Vertices Vertex positions
+	 * @param UVs Texture coordinates to align the tangents with, or empty to derive them from the triangle edges
+	 * @param Adjacency Adjacency built from the same indices and vertices
+	 * @param OutTangentX Receives the tangent for each vertex
+	 * @param OutTangentY Receives the binormal for each vertex
+	 * @param OutTangentZ Receives the normal for each vertex
+	 */
+	REALTIMEMESHCOMPONENT_API void GenerateTangentsFromAdjacency(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices,
+	                                                             TConstArrayView<const FVector2f> UVs, const FRealtimeMeshVertexAdjacency& Adjacency,
+	                                                             TArrayView<FVector3f> OutTangentX, TArrayView<FVector3f> OutTangentY, TArrayView<FVector3f> OutTangentZ);
+
+	/*
+	 * @brief Generates MikkTSpace equivalent tangents for every vertex from prebuilt adjacency and normals, in parallel.
+	 * Face tangents are taken from the UV derivatives, projected onto the plane of the vertex normal and weighted
+	 * by the corner angle. Faces are grouped by UV orientation like MikkTSpace does. Where the faces around a vertex
+	 * disagree on orientation MikkTSpace would split the vertex, here it isn't split since tangents are stored per vertex.
+	 * Instead the orientation with the most weight around the vertex wins and provides both the tangent and the binormal
+	 * sign, so faces of the other orientation get a tangent frame that doesn't match their UVs. Split such vertices
+	 * beforehand when mirrored UVs meet at a shared vertex.
+	 * Duplicate vertices with matching UV and normal are treated as the same vertex, matching MikkTSpace's welding.
+	 * @param Indices Flat triangle list, every index must be less than Vertices.Num()
+	 * @param Vertices Vertex positions
+	 * @param UVs Texture coordinates to align the tangents with
+	 * @param Normals Normal for each vertex, the tangent basis is built around these
+	 * @param Adjacency Adjacency built from the same indices and vertices
+	 * @param OutTangentX Receives the tangent for each vertex
+	 * @param OutTangentY Receives the binormal for each vertex
+	 */
+	REALTIMEMESHCOMPONENT_API void GenerateMikkTSpaceTangentsFromAdjacency(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices,
+	                                                                       TConstArrayView<const FVector2f> UVs, TConstArrayView<const FVector3f> Normals,
+	                                                                       const FRealtimeMeshVertexAdjacency& Adjacency,
+	                                                                       TArrayView<FVector3f> OutTangentX, TArrayView<FVector3f> OutTangentY);
+
 	template <typename TriangleType>
 	void GenerateTangents(TConstArrayView<const TriangleType> Triangles, TConstArrayView<const FVector3f> Vertices,
 	                      const TFunction<FVector2f(int32)>& UVGetter, const TFunctionRef<void(int32, FVector3f, FVector3f)>& TangentsSetter, bool bComputeSmoothNormals = true)
 	{
-		uint32 NumIndices = Triangles.Num();
-		uint32 NumVertices = Vertices.Num();
-
-		// Calculate the duplicate vertices map if we're wanting smooth normals.  Don't find duplicates if we don't want smooth normals
-		// that will cause it to only smooth across faces sharing a common vertex, not across faces with vertices of common position
-		TMultiMap<uint32, uint32> DuplicateVertexMap;
-
-		if (bComputeSmoothNormals)
+		const int32 NumVertices = Vertices.Num();
+		if (NumVertices == 0)
 		{
-			using namespace Private;
-
-			TArray<FRealtimeMeshVertexSortElement> VertexSorter;
-			VertexSorter.Empty(NumVertices);
-			for (uint32 Index = 0; Index < NumVertices; Index++)
-			{
-				new(VertexSorter)FRealtimeMeshVertexSortElement(Index, Vertices[Index]);
-			}
-
-			// Sort the list
-			VertexSorter.Sort(FRuntimeMeshVertexSortingFunction());
-
-			// Map out the duplicates.
-			for (uint32 Index = 0; Index < NumVertices; Index++)
-			{
-				uint32 SrcVertIdx = VertexSorter[Index].Index;
-				float Value = VertexSorter[Index].Value;
-
-				// Search forward adding pairs both ways
-				for (uint32 SubIndex = Index + 1; SubIndex < NumVertices; SubIndex++)
-				{
-					if (FMath::Abs(VertexSorter[SubIndex].Value - Value) > THRESH_POINTS_ARE_SAME * 4.01f)
-					{
-						// No more possible duplicates
-						break;
-					}
-
-					uint32 OtherVertIdx = VertexSorter[SubIndex].Index;
-					if (Vertices[SrcVertIdx].Equals(Vertices[OtherVertIdx]))
-					{
-						DuplicateVertexMap.AddUnique(SrcVertIdx, OtherVertIdx);
-						DuplicateVertexMap.AddUnique(OtherVertIdx, SrcVertIdx);
-					}
-				}
-			}
+			return;
 		}
 
-		// Number of triangles
-		const uint32 NumTris = NumIndices / 3;
-
-		// Map of vertex to triangles in Triangles array
-		TMultiMap<uint32, uint32> VertToTriMap;
-		// Map of vertex to triangles to consider for normal calculation
-		TMultiMap<uint32, uint32> VertToTriSmoothMap;
-
-		// Normal/tangents for each face
-		TArray<FVector3f> FaceTangentX, FaceTangentY, FaceTangentZ;
-		FaceTangentX.AddUninitialized(NumTris);
-		FaceTangentY.AddUninitialized(NumTris);
-		FaceTangentZ.AddUninitialized(NumTris);
-
-		// Iterate over triangles
-		for (uint32 TriIdx = 0; TriIdx < NumTris; TriIdx++)
+		// Flatten the triangles into clamped indices so the shared implementation only has to deal with one index type
+		TArray<uint32> Indices;
+		Indices.SetNumUninitialized((Triangles.Num() / 3) * 3);
+		for (int32 Index = 0; Index < Indices.Num(); Index++)
 		{
-			uint32 CornerIndex[3];
-			FVector3f P[3];
-
-			for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
-			{
-				// Find vert index (clamped within range)
-				uint32 VertIndex = FMath::Min(uint32(Triangles[(TriIdx * 3) + CornerIdx]), NumVertices - 1);
-
-				CornerIndex[CornerIdx] = VertIndex;
-				P[CornerIdx] = Vertices[VertIndex];
-
-				// Find/add this vert to index buffer
-				TArray<uint32> VertOverlaps;
-				DuplicateVertexMap.MultiFind(VertIndex, VertOverlaps);
-
-				// Remember which triangles map to this vert
-				VertToTriMap.AddUnique(VertIndex, TriIdx);
-				VertToTriSmoothMap.AddUnique(VertIndex, TriIdx);
-
-				// Also update map of triangles that 'overlap' this vert (ie don't match UV, but do match smoothing) and should be considered when calculating normal
-				for (int32 OverlapIdx = 0; OverlapIdx < VertOverlaps.Num(); OverlapIdx++)
-				{
-					// For each vert we overlap..
-					int32 OverlapVertIdx = VertOverlaps[OverlapIdx];
-
-					// Add this triangle to that vert
-					VertToTriSmoothMap.AddUnique(OverlapVertIdx, TriIdx);
-
-					// And add all of its triangles to us
-					TArray<uint32> OverlapTris;
-					VertToTriMap.MultiFind(OverlapVertIdx, OverlapTris);
-					for (int32 OverlapTriIdx = 0; OverlapTriIdx < OverlapTris.Num(); OverlapTriIdx++)
-					{
-						VertToTriSmoothMap.AddUnique(VertIndex, OverlapTris[OverlapTriIdx]);
-					}
-				}
-			}
-
-			// Calculate triangle edge vectors and normal
-			const FVector3f Edge21 = P[1] - P[2];
-			const FVector3f Edge20 = P[0] - P[2];
-			const FVector3f TriNormal = (Edge21 ^ Edge20).GetSafeNormal();
-
-			// If we have UVs, use those to calculate
-			if (UVGetter)
-			{
-				const FVector2f T1 = UVGetter(CornerIndex[0]);
-				const FVector2f T2 = UVGetter(CornerIndex[1]);
-				const FVector2f T3 = UVGetter(CornerIndex[2]);
-
-				// 			float X1 = P[1].X - P[0].X;
-				// 			float X2 = P[2].X - P[0].X;
-				// 			float Y1 = P[1].Y - P[0].Y;
-				// 			float Y2 = P[2].Y - P[0].Y;
-				// 			float Z1 = P[1].Z - P[0].Z;
-				// 			float Z2 = P[2].Z - P[0].Z;
-				// 
-				// 			float S1 = U1.X - U0.X;
-				// 			float S2 = U2.X - U0.X;
-				// 			float T1 = U1.Y - U0.Y;
-				// 			float T2 = U2.Y - U0.Y;
-				// 
-				// 			float R = 1.0f / (S1 * T2 - S2 * T1);
-				// 			FaceTangentX[TriIdx] = FVector((T2 * X1 - T1 * X2) * R, (T2 * Y1 - T1 * Y2) * R,
-				// 				(T2 * Z1 - T1 * Z2) * R);
-				// 			FaceTangentY[TriIdx] = FVector((S1 * X2 - S2 * X1) * R, (S1 * Y2 - S2 * Y1) * R,
-				// 				(S1 * Z2 - S2 * Z1) * R);
-
-
-				FMatrix44f ParameterToLocal(
-					FPlane4f(P[1].X - P[0].X, P[1].Y - P[0].Y, P[1].Z - P[0].Z, 0),
-					FPlane4f(P[2].X - P[0].X, P[2].Y - P[0].Y, P[2].Z - P[0].Z, 0),
-					FPlane4f(P[0].X, P[0].Y, P[0].Z, 0),
-					FPlane4f(0, 0, 0, 1)
-				);
-
-				FMatrix44f ParameterToTexture(
-					FPlane4f(T2.X - T1.X, T2.Y - T1.Y, 0, 0),
-					FPlane4f(T3.X - T1.X, T3.Y - T1.Y, 0, 0),
-					FPlane4f(T1.X, T1.Y, 1, 0),
-					FPlane4f(0, 0, 0, 1)
-				);
-
-				// Use InverseSlow to catch singular matrices.  Inverse can miss this sometimes.
-				const FMatrix44f TextureToLocal = ParameterToTexture.Inverse() * ParameterToLocal;
-
-				FaceTangentX[TriIdx] = TextureToLocal.TransformVector(FVector3f(1, 0, 0)).GetSafeNormal();
-				FaceTangentY[TriIdx] = TextureToLocal.TransformVector(FVector3f(0, 1, 0)).GetSafeNormal();
-			}
-			else
-			{
-				FaceTangentX[TriIdx] = Edge20.GetSafeNormal();
-				FaceTangentY[TriIdx] = (FaceTangentX[TriIdx] ^ TriNormal).GetSafeNormal();
-			}
-
-			FaceTangentZ[TriIdx] = TriNormal;
+			Indices[Index] = FMath::Min(uint32(Triangles[Index]), uint32(NumVertices - 1));
 		}
 
-
-		// Arrays to accumulate tangents into
-		TArray<FVector3f> VertexTangentXSum, VertexTangentYSum, VertexTangentZSum;
-		VertexTangentXSum.AddZeroed(NumVertices);
-		VertexTangentYSum.AddZeroed(NumVertices);
-		VertexTangentZSum.AddZeroed(NumVertices);
-
-		// For each vertex..
-		for (uint32 VertxIdx = 0; VertxIdx < NumVertices; VertxIdx++)
+		TArray<FVector2f> UVs;
+		if (UVGetter)
 		{
-			// Find relevant triangles for normal
-			TArray<uint32> SmoothTris;
-			VertToTriSmoothMap.MultiFind(VertxIdx, SmoothTris);
-
-			for (int i = 0; i < SmoothTris.Num(); i++)
+			UVs.SetNumUninitialized(NumVertices);
+			for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
 			{
-				uint32 TriIdx = SmoothTris[i];
-				VertexTangentZSum[VertxIdx] += FaceTangentZ[TriIdx];
-			}
-
-			// Find relevant triangles for tangents
-			TArray<uint32> TangentTris;
-			VertToTriMap.MultiFind(VertxIdx, TangentTris);
-
-			for (int i = 0; i < TangentTris.Num(); i++)
-			{
-				uint32 TriIdx = TangentTris[i];
-				VertexTangentXSum[VertxIdx] += FaceTangentX[TriIdx];
-				VertexTangentYSum[VertxIdx] += FaceTangentY[TriIdx];
+				UVs[VertIdx] = UVGetter(VertIdx);
 			}
 		}
 
-		// Finally, normalize tangents and build output arrays	
-		for (uint32 VertxIdx = 0; VertxIdx < NumVertices; VertxIdx++)
-		{
-			FVector3f& TangentX = VertexTangentXSum[VertxIdx];
-			FVector3f& TangentY = VertexTangentYSum[VertxIdx];
-			FVector3f& TangentZ = VertexTangentZSum[VertxIdx];
+		// Don't find duplicates if we don't want smooth normals, that will cause it to only smooth
+		// across faces sharing a common vertex, not across faces with vertices of common position
+		FRealtimeMeshVertexAdjacency Adjacency;
+		Adjacency.Build(Indices, Vertices, bComputeSmoothNormals);
 
-			TangentX.Normalize();
-			//TangentY.Normalize();
-			TangentZ.Normalize();
+		TArray<FVector3f> TangentX, TangentY, TangentZ;
+		TangentX.SetNumUninitialized(NumVertices);
+		TangentY.SetNumUninitialized(NumVertices);
+		TangentZ.SetNumUninitialized(NumVertices);
 
-			// Use Gram-Schmidt orthogonalization to make sure X is orthonormal with Z
-			TangentX -= TangentZ * (TangentZ | TangentX);
-			TangentX.Normalize();
-			TangentY.Normalize();
+		GenerateTangentsFromAdjacency(Indices, Vertices, UVs, Adjacency, TangentX, TangentY, TangentZ);
 
-			TangentsSetter(VertxIdx, TangentX, TangentZ);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			TangentsSetter(VertIdx, TangentX[VertIdx], TangentZ[VertIdx]);
 		}
 	}
 
 
-	
-	REALTIMEMESHCOMPONENT_API void GenerateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bComputeSmoothNormals = true);
+	enum class ETangentGenerationMode : uint8
+	{
+		// Tangents are the sum of the UV aligned tangents of the faces around each vertex
+		FaceAveraged,
+		// Tangents match the MikkTSpace convention used by baked normal maps, requires TexCoords
+		MikkTSpace,
+	};
+
+	/*
+	 * @brief Generates the Tangents stream from the Position, TexCoords and Triangles streams.
+	 * @param StreamSet Stream set to generate for, any existing Tangents stream is replaced
+	 * @param bComputeSmoothNormals Whether to smooth normals across vertices sharing a position
+	 * @param Mode How to build the tangents around the generated normals, MikkTSpace falls back to FaceAveraged without TexCoords
+	 */
+	REALTIMEMESHCOMPONENT_API void GenerateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, bool bComputeSmoothNormals = true,
+	                                                ETangentGenerationMode Mode = ETangentGenerationMode::FaceAveraged);
+
+	/*
+	 * @brief Regenerates the Tangents stream only around a set of modified vertices, writing into the existing stream.
+	 * The modified vertices are expanded to the triangles around them, every vertex of those triangles (and the vertices
+	 * sharing their position when smoothing) gets the same result a full GenerateTangents would give it.
+	 * Falls back to a full GenerateTangents when there's no Tangents stream or the adjacency doesn't match the stream set.
+	 * @param StreamSet Stream set with the modified positions/UVs and the tangents generated before the modification
+	 * @param Adjacency Adjacency built for this stream set, can be kept while the triangles are unchanged. Whether it has duplicates decides normal smoothing
+	 * @param DirtyVertices Vertices whose position or UV was modified
+	 * @param Mode How to build the tangents around the generated normals, should match the mode the stream was generated with
+	 * @return The range of vertices that were rewritten, this is also marked dirty on the Tangents stream for a partial upload
+	 */
+	REALTIMEMESHCOMPONENT_API FInt32Range UpdateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, const FRealtimeMeshVertexAdjacency& Adjacency,
+	                                                     TConstArrayView<const int32> DirtyVertices, ETangentGenerationMode Mode = ETangentGenerationMode::FaceAveraged);
+
+	/*
+	 * @brief Regenerates the Tangents stream only around the vertices of a modified range, see above.
+	 */
+	REALTIMEMESHCOMPONENT_API FInt32Range UpdateTangents(RealtimeMesh::FRealtimeMeshStreamSet& StreamSet, const FRealtimeMeshVertexAdjacency& Adjacency,
+	                                                     const FRealtimeMeshStreamRange& DirtyRange, ETangentGenerationMode Mode = ETangentGenerationMode::FaceAveraged);
+
+	/*
+	 * @brief Welds vertices closer together than the tolerance, in parallel, using a spatial hash so it stays linear in the vertex count.
+	 * Each vertex is merged into the lowest index vertex within the tolerance of it, following chains of merges,
+	 * so the result is the same regardless of how the work was split between threads.
+	 * @param Vertices Vertex positions
+	 * @param Tolerance Max distance between two vertices that are welded, zero only welds identical positions
+	 * @param OutVertexMap Receives the index of the welded vertex for each input vertex
+	 * @param OutWeldedVertices Receives the input index each welded vertex takes its position from, in ascending order
+	 * @return Number of welded vertices
+	 */
+	REALTIMEMESHCOMPONENT_API int32 WeldVertices(TConstArrayView<const FVector3f> Vertices, float Tolerance, TArray<int32>& OutVertexMap, TArray<int32>& OutWeldedVertices);
 
 	
 	REALTIMEMESHCOMPONENT_API TOptional<TMap<int32, FRealtimeMeshStreamRange>> GetStreamRangesFromPolyGroups(const RealtimeMesh::FRealtimeMeshStreamSet& Streams,
@@ -252,6 +252,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
 	void SetShouldSerializeMeshData(bool bNewShouldSerializeMeshData) { bShouldSerializeMeshData = bNewShouldSerializeMeshData; }
 
+	/**
+	 * Get how urgently this mesh's updates are uploaded to the GPU when RealtimeMesh.UploadBudgetPerFrame limits uploads per frame.
+	 * @return The upload priority, higher goes first.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	float GetUploadPriority() const;
+
+	/**
+	 * Set how urgently this mesh's updates are uploaded to the GPU when RealtimeMesh.UploadBudgetPerFrame limits uploads per frame.
+	 * Updates that don't fit in a frame's budget wait for a later frame, meshes with a higher priority are uploaded first.
+	 * @param NewPriority New priority, for example based on distance to the camera or importance. Defaults to 0.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Components|RealtimeMesh")
+	void SetUploadPriority(float NewPriority);
+
 public:
 	//	Begin UObject interface
 	virtual UWorld* GetWorld() const override;
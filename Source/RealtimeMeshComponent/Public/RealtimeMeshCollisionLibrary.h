@@ -6,9 +6,41 @@
 #include "Interface_CollisionDataProviderCore.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Core/RealtimeMeshCollision.h"
+#include "Async/Future.h"
 #include "RealtimeMeshCollisionLibrary.generated.h"
 
 
+struct FRealtimeMeshConvexDecompositionSettings
+{
+	/* Upper limit on the number of hulls produced */
+	int32 MaxHulls = 8;
+	/* Upper limit on the vertices of each hull, larger hulls are reduced to their most extreme points */
+	int32 MaxVerticesPerHull = 32;
+	/* Splitting stops once the best split removes less than this fraction of the volume of the hull around the whole mesh */
+	float MinVolumeReduction = 0.01f;
+	/* Only decompose the triangles of this polygroup, INDEX_NONE decomposes every triangle */
+	int32 PolyGroup = INDEX_NONE;
+	/* Cook the hulls along with the decomposition so the geometry is ready to hand to the mesh */
+	bool bCookHulls = true;
+};
+
+enum class ERealtimeMeshCollisionFitShape : uint8
+{
+	None,
+	Box,
+	Sphere,
+	Capsule,
+};
+
+struct FRealtimeMeshCollisionFitResult
+{
+	ERealtimeMeshCollisionFitShape Shape = ERealtimeMeshCollisionFitShape::None;
+	/* Index of the added shape in its shape set of the simple geometry */
+	int32 Index = INDEX_NONE;
+	/* Fit quality of the best shape, whether or not it was added */
+	float Quality = 0.0f;
+};
+
 UCLASS()
 class REALTIMEMESHCOMPONENT_API URealtimeMeshCollisionTools : public UBlueprintFunctionLibrary
 {
@@ -23,6 +55,24 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Realtime Mesh|Collision")
 	static void CookComplexMesh(FRealtimeMeshCollisionMesh& CollisionMesh);
+
+	/**
+	 * Cooks the streams directly, converting positions straight into the chaos particles and reading the indices in place,
+	 * so none of the intermediate copies of AppendStreamsToCollisionMesh + CookComplexMesh are made.
+	 * Only the cooked data is stored in the collision mesh, its vertex/triangle arrays are left empty, the clean settings set on it are kept and used.
+	 * @param MaterialIndex Material for every triangle, unless polygroups are used as materials
+	 * @param bPolyGroupsAsMaterials Use the polygroup stream, when present, as the per triangle material
+	 */
+	static bool CookComplexMeshFromStreams(FRealtimeMeshCollisionMesh& CollisionMesh, const RealtimeMesh::FRealtimeMeshStreamSet& Streams,
+		int32 MaterialIndex, bool bPolyGroupsAsMaterials = false);
+
+	/* Process wide count of complex meshes cooked by CookComplexMesh, disk cache hits aren't counted. Intended for profiling and tests */
+	static uint64 GetNumComplexMeshCooks();
+
+	/* Hash of everything that affects the cooked result of the mesh, its geometry plus the cook options */
+	static uint64 GetComplexMeshCookHash(const FRealtimeMeshCollisionMesh& CollisionMesh);
+	static uint64 GetComplexMeshCookHash(const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 MaterialIndex, bool bPolyGroupsAsMaterials,
+		bool bCleanMesh = false, float WeldTolerance = 0.0f);
 	
 	static void CopySimpleGeometryToBodySetup(const FRealtimeMeshSimpleGeometry& SimpleGeom, UBodySetup* BodySetup);
 	static void CopyComplexGeometryToBodySetup(const FRealtimeMeshComplexGeometry& ComplexGeom, UBodySetup* BodySetup, TArray<FRealtimeMeshCollisionMeshCookedUVData>& OutUVData);
@@ -30,6 +80,42 @@ public:
 	
 	static bool AppendStreamsToCollisionMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 MaterialIndex);
 	static bool AppendStreamsToCollisionMesh(FRealtimeMeshCollisionMesh& CollisionMesh, const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 MaterialIndex, int32 FirstTriangle, int32 TriangleCount);
+
+	/**
+	 * Builds an approximate convex decomposition of the streams, or of one of their polygroups, on the realtime mesh thread pool.
+	 * The triangles are split in two along whichever axis removes the most empty hull volume, always splitting the part that gains the most,
+	 * until the hull budget is reached or no split is worth it. The candidate splits and the final hulls are computed in parallel.
+	 * The source data is copied before returning so the streams are free to change. Call from the game thread.
+	 */
+	static TFuture<FRealtimeMeshSimpleGeometry> ComputeConvexDecomposition(const RealtimeMesh::FRealtimeMeshStreamSet& Streams,
+		const FRealtimeMeshConvexDecompositionSettings& Settings = FRealtimeMeshConvexDecompositionSettings());
+
+	/* Runs the decomposition of ComputeConvexDecomposition on the calling thread */
+	static FRealtimeMeshSimpleGeometry BuildConvexDecomposition(TConstArrayView<FVector3f> Vertices, TConstArrayView<RealtimeMesh::TIndex3<int32>> Triangles,
+		const FRealtimeMeshConvexDecompositionSettings& Settings);
+
+	/**
+	 * Fits an oriented box, starting from the principal axes of the points and refining the orientation to minimize the volume.
+	 * Like the other fits this returns the fit quality, the volume of the convex hull of the points divided by the volume of the shape.
+	 * 1 is a perfect fit, anything approaching 0 means the shape is a poor stand in for the mesh.
+	 */
+	static float FitBox(TConstArrayView<FVector3f> Points, FRealtimeMeshCollisionBox& OutBox);
+
+	/* Fits a bounding sphere, starting from the extremes along the principal axis and refining towards the minimum sphere */
+	static float FitSphere(TConstArrayView<FVector3f> Points, FRealtimeMeshCollisionSphere& OutSphere);
+
+	/* Fits a capsule along whichever principal axis gives the smallest volume, trading radius against length */
+	static float FitCapsule(TConstArrayView<FVector3f> Points, FRealtimeMeshCollisionCapsule& OutCapsule);
+
+	/* Gathers the vertices used by the triangles of the polygroup, or by every triangle when PolyGroup is INDEX_NONE */
+	static bool GatherCollisionFitPoints(const RealtimeMesh::FRealtimeMeshStreamSet& Streams, int32 PolyGroup, TArray<FVector3f>& OutPoints);
+
+	/**
+	 * Fits a box, sphere and capsule to the triangles of the polygroup and adds whichever fits best to the simple geometry.
+	 * Nothing is added when no shape reaches MinQuality, in which case the caller should keep using complex collision for it.
+	 */
+	static FRealtimeMeshCollisionFitResult FitSimpleCollision(const RealtimeMesh::FRealtimeMeshStreamSet& Streams, FRealtimeMeshSimpleGeometry& SimpleGeometry,
+		int32 PolyGroup = INDEX_NONE, float MinQuality = 0.8f);
 };
 
 
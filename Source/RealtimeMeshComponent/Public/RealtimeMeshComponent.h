@@ -69,6 +69,9 @@ public:
 	UFUNCTION()
 	void OnRep_RealtimeMesh(class URealtimeMesh *OldRealtimeMesh);
 
+	/* Process wide count of collision updates that swapped the shapes of an existing body instead of recreating it. Intended for profiling and tests */
+	static uint64 GetNumCollisionUpdatesInPlace();
+
 public:
 	void GetStreamingRenderAssetInfo(FStreamingTextureLevelContext& LevelContext, TArray<FStreamingRenderAssetPrimitiveInfo>& OutStreamingRenderAssets) const
 	{
@@ -125,5 +128,8 @@ private:
 
 	virtual void UpdateCollision();
 
+	/* Swaps the shapes of the existing body for the ones in the current body setup, returns false when the physics state has to be recreated instead */
+	bool UpdateCollisionInPlace();
+
 	friend class FRealtimeMeshDetailsCustomization;
 };
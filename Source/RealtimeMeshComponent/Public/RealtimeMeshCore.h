@@ -30,6 +30,11 @@ namespace RealtimeMesh
 			CollisionOverhaul = 11,
 			DrawTypeMovedToSectionGroup = 12,
 			ActorSupportsOptionalConstructionDefer = 13,
+			SectionGroupStoresPositionQuantization = 14,
+			SectionGroupInterleavedVertexStreams = 15,
+			CollisionSourceSelection = 16,
+			CollisionMeshCleaning = 17,
+			CollisionChunking = 18,
 
 			// -----<new versions can be added above this line>-------------------------------------------------
 			VersionPlusOne,
@@ -219,6 +219,23 @@ struct FRealtimeMeshCollisionConfiguration
 	
 	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite)
 	bool bMergeAllMeshes = false;
+
+	/* LOD the complex collision is generated from, clamped to the last valid LOD */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0))
+	int32 ComplexCollisionLOD = 0;
+
+	/* Weld vertices and drop degenerate triangles when cooking the complex collision, avoids snagging on seams at the cost of a slower cook */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite)
+	bool bCleanComplexMesh = false;
+
+	/* Max distance between vertices that are welded when cleaning */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0, EditCondition="bCleanComplexMesh"))
+	float ComplexMeshWeldTolerance = 0.01f;
+
+	/* Size of the grid cells the complex collision of each section group is split into. Every cell is cooked on its own,
+	 * so an edit only re-cooks the cells it touches. 0 keeps a single collision mesh per section group */
+	UPROPERTY(Category="RealtimeMesh|Collision", EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0))
+	float ComplexCollisionChunkSize = 0.0f;
 };
 
 
@@ -318,6 +335,8 @@ private:
 	TArray<uint16> Materials;
 	TArray<TArray<FVector2f>> TexCoords;
 	bool bFlipNormals;
+	bool bCleanMesh;
+	float WeldTolerance;
 	
 	mutable TSharedPtr<FRealtimeMeshCookedTriMeshData> Cooked;
 	
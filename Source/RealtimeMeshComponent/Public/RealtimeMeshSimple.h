@@ -92,16 +92,43 @@ namespace RealtimeMesh
 		// Store the actual mesh data on CPU side, this is so we can support fire-and-forget
 		FRealtimeMeshStreamSet Streams;
 
+		// Optional collision only mesh data, used for the complex collision of this group instead of Streams
+		FRealtimeMeshStreamSet CollisionStreams;
+
 		// Handler for setting up section config based on found poly groups
 		FRealtimeMeshPolyGroupConfigHandler ConfigHandler;
 
 		// Should we auto create sections for the poly groups
 		uint8 bAutoCreateSectionsForPolygonGroups : 1;
 
+		// Rows of the interleaved stream changed since it was last packed, unbounded when the whole stream needs repacking
+		FInt32Range InterleavedDirtyRows;
+
+		// Last cooked complex collision for this group, reused while the collision content hash is unchanged. Only the cook is kept, not the geometry it came from
+		mutable FCriticalSection CollisionCacheLock;
+		mutable TSharedPtr<FRealtimeMeshCookedTriMeshData> CachedCollisionCook;
+		mutable uint64 CachedCollisionHash;
+		mutable bool bHasCachedCollision;
+
+		// Cooked collision of each grid cell when the collision is chunked, reused per cell while that cell's triangles are unchanged
+		struct FCachedCollisionChunk
+		{
+			uint64 Hash;
+			TSharedPtr<FRealtimeMeshCookedTriMeshData> Cook;
+		};
+		mutable TMap<FIntVector, FCachedCollisionChunk> CachedCollisionChunks;
+		mutable uint64 CachedCollisionChunksHash;
+		mutable bool bHasCachedCollisionChunks;
+
 	public:
 		FRealtimeMeshSectionGroupSimple(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionGroupKey& InKey)
 			: FRealtimeMeshSectionGroup(InSharedResources, InKey)
 			, bAutoCreateSectionsForPolygonGroups(true)
+			, InterleavedDirtyRows(FInt32Range::Empty())
+			, CachedCollisionHash(0)
+			, bHasCachedCollision(false)
+			, CachedCollisionChunksHash(0)
+			, bHasCachedCollisionChunks(false)
 		{
 		}
 
@@ -121,6 +148,15 @@ namespace RealtimeMesh
 		 */
 		const FRealtimeMeshStream* GetStream(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshStreamKey StreamKey) const;
 
+		/*
+		 * @brief Set a collision only stream set, used for the complex collision of this group instead of the render streams
+		 * @details Needs at least position and triangle streams. The whole set is used regardless of the sections collision flags,
+		 * with each triangle using its polygroup index as the material index when there is a polygroup stream.
+		 */
+		void SetCollisionStreams(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStreamSet&& InCollisionStreams);
+		void ClearCollisionStreams(FRealtimeMeshUpdateContext& UpdateContext);
+		bool HasCollisionStreams(const FRealtimeMeshLockContext& LockContext) const { return CollisionStreams.Contains(FRealtimeMeshStreams::Position) && CollisionStreams.Contains(FRealtimeMeshStreams::Triangles); }
+
 		void SetPolyGroupSectionHandler(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshPolyGroupConfigHandler& NewHandler);
 		void ClearPolyGroupSectionHandler(FRealtimeMeshUpdateContext& UpdateContext);
 
@@ -131,6 +167,23 @@ namespace RealtimeMesh
 		void ProcessMeshData(const FRealtimeMeshLockContext& LockContext, TFunctionRef<void(const FRealtimeMeshStreamSet&)> ProcessFunc) const;
 		
 		void EditMeshData(FRealtimeMeshUpdateContext& UpdateContext, TFunctionRef<TSet<FRealtimeMeshStreamKey>(FRealtimeMeshStreamSet&)> EditFunc);
+
+		/*
+		 * @brief Edit the stream data in place, uploading only the modified rows where possible.
+		 * @details Streams whose size and layout are unchanged only upload their dirty range (see FRealtimeMeshStream::MarkRangeDirty)
+		 * instead of recreating the GPU buffer. Any other returned stream is fully updated like EditMeshData.
+		 * @param EditFunc Function to edit the mesh data, returns the set of streams that were modified.
+		 */
+		void EditMeshDataRanges(FRealtimeMeshUpdateContext& UpdateContext, TFunctionRef<TSet<FRealtimeMeshStreamKey>(FRealtimeMeshStreamSet&)> EditFunc);
+
+		using FRealtimeMeshSectionGroup::UpdateConfig;
+		/*
+		 * @brief Update the config of this section group
+		 * @details Switches the vertex streams between their own GPU buffers and the interleaved buffer when that setting changes.
+		 * Re-uploads a quantized position stream if the position quantization changed, as it is decoded on upload.
+		 * @param EditFunc Function to edit the config
+		 */
+		virtual void UpdateConfig(FRealtimeMeshUpdateContext& UpdateContext, TFunction<void(FRealtimeMeshSectionGroupConfig&)> EditFunc) override;
 		
 		/*
 		 * @brief Create or update a stream in the mesh data
@@ -139,6 +192,13 @@ namespace RealtimeMesh
 		 */
 		virtual void CreateOrUpdateStream(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& Stream) override;
 
+		/*
+		 * @brief Write a sub-range of rows into an existing stream in the mesh data
+		 * @param RangeData Stream containing the rows to write, converted to the layout of the existing stream if necessary
+		 * @param DestinationIndex First row in the existing stream to write to
+		 */
+		virtual void UpdateStreamRange(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshStream&& RangeData, int32 DestinationIndex) override;
+
 		/*
 		 * @brief Remove a stream from the mesh data
 		 * @param ProxyBuilder Running command queue that we send RT commands too. This is used for command batching.
@@ -176,12 +236,59 @@ namespace RealtimeMesh
 		 * @brief Generate the collision mesh data for this section group, used to setup PhysX/Chaos collision
 		 */
 		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshCollisionMesh& CollisionMesh) const;
+
+		/*
+		 * @brief Get the cooked collision mesh for this section group, only generating and cooking it again when the collision content changed
+		 * @details The cached cook is keyed by GetComplexCollisionHash, see RealtimeMesh.Collision.CacheSectionGroupCooks
+		 * @return Whether the section group has any collision, false as well when the cook token was cancelled before the cook
+		 */
+		virtual bool GetCookedComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshCollisionMesh& OutCollisionMesh,
+			const FRealtimeMeshCollisionCookToken& CookToken = FRealtimeMeshCollisionCookToken()) const;
+
+		/*
+		 * @brief Get the cooked collision for this section group split into the cells of a uniform grid, one collision mesh per cell
+		 * @details Triangles belong to the cell containing their centroid. Every cell is cached on its own, so an edit only
+		 * re-cooks the cells whose triangles changed
+		 * @return Whether the section group has any collision, false as well when the cook token was cancelled part way, which leaves the cache as it was
+		 */
+		virtual bool GetCookedComplexCollisionChunks(const FRealtimeMeshLockContext& LockContext, float ChunkSize, TArray<FRealtimeMeshCollisionMesh>& OutCollisionMeshes,
+			const FRealtimeMeshCollisionCookToken& CookToken = FRealtimeMeshCollisionCookToken()) const;
+
+		/*
+		 * @brief Cook straight from the streams when they can be used as they are, which is when collision streams are set,
+		 * or when a single collision section spans the whole group. See RealtimeMesh.Collision.CookFromStreams
+		 * @return False if the collision has to be generated and cooked through GenerateComplexCollision instead
+		 */
+		bool CookComplexCollisionFromStreams(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshCollisionMesh& OutCollisionMesh) const;
+
+		/*
+		 * @brief Hash of everything the complex collision of this section group is built from, the position/triangle/polygroup
+		 * (and texcoord when UVs are supported for hit results) streams, and the collision sections material and range.
+		 * Only the collision streams are hashed when they're set.
+		 */
+		uint64 GetComplexCollisionHash(const FRealtimeMeshLockContext& LockContext) const;
 		
 		
 	protected:
 
 		virtual void UpdatePolyGroupSections(FRealtimeMeshUpdateContext& UpdateContext, bool bUpdateDepthOnly);
 		virtual FRealtimeMeshSectionConfig DefaultPolyGroupSectionHandler(int32 PolyGroupIndex) const;
+
+		virtual bool ShouldSendStreamToProxy(const FRealtimeMeshStreamKey& StreamKey) const override;
+
+		/*
+		 * @brief Repack the stored vertex streams into the interleaved GPU stream, see FRealtimeMeshSectionGroupConfig::bInterleaveVertexStreams
+		 */
+		virtual void UpdateInterleavedStream(FRealtimeMeshUpdateContext& UpdateContext);
+
+		/*
+		 * @brief Repack and upload only the dirty rows of the interleaved GPU stream, writing them over the existing buffer.
+		 * Falls back to UpdateInterleavedStream when the whole stream is dirty or the packed layout no longer matches the proxy's.
+		 */
+		void UpdateInterleavedStreamRows(FRealtimeMeshUpdateContext& UpdateContext);
+		void MarkInterleavedStreamDirty(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey);
+		void MarkInterleavedRowsDirty(FRealtimeMeshUpdateContext& UpdateContext, const FRealtimeMeshStreamKey& StreamKey, const FInt32Range& Rows);
+		FRealtimeMeshStreamSet GetInterleavedSourceStreams();
 		
 		bool ShouldCreateSingularSection() const;
 	};
@@ -199,8 +306,10 @@ namespace RealtimeMesh
 
 		/*
 		 * @brief Generate the collision mesh data for this LOD, used to setup PhysX/Chaos collision
+		 * @details Section groups that haven't started cooking when the cook token is cancelled are skipped
 		 */
-		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry) const;
+		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry,
+			const FRealtimeMeshCollisionCookToken& CookToken = FRealtimeMeshCollisionCookToken()) const;
 	};
 
 	DECLARE_MULTICAST_DELEGATE(FRealtimeMeshSimpleCollisionDataChangedEvent);
@@ -300,13 +409,7 @@ namespace RealtimeMesh
 		
 		}
 
-		virtual ~FRealtimeMeshSimple() override
-		{
-			if (PendingCollisionPromise)
-			{
-				PendingCollisionPromise->SetValue(ERealtimeMeshCollisionUpdateResult::Ignored);
-			}
-		}
+		virtual ~FRealtimeMeshSimple() override;
 
 		TFuture<ERealtimeMeshProxyUpdateStatus> CreateSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshSectionGroupConfig& InConfig = FRealtimeMeshSectionGroupConfig(), bool bShouldAutoCreateSectionsForPolyGroups = true);
 		TFuture<ERealtimeMeshProxyUpdateStatus> CreateSectionGroup(const FRealtimeMeshSectionGroupKey& SectionGroupKey, FRealtimeMeshStreamSet&& MeshData, const FRealtimeMeshSectionGroupConfig& InConfig = FRealtimeMeshSectionGroupConfig(), bool bShouldAutoCreateSectionsForPolyGroups = true);
@@ -316,6 +419,7 @@ namespace RealtimeMesh
 
 
 		FRealtimeMeshCollisionConfiguration GetCollisionConfig() const;
+		const FRealtimeMeshCollisionConfiguration& GetCollisionConfig(const FRealtimeMeshLockContext& LockContext) const { return CollisionConfig; }
 		TFuture<ERealtimeMeshCollisionUpdateResult> SetCollisionConfig(const FRealtimeMeshCollisionConfiguration& InCollisionConfig);
 		FRealtimeMeshSimpleGeometry GetSimpleGeometry() const;
 		TFuture<ERealtimeMeshCollisionUpdateResult> SetSimpleGeometry(const FRealtimeMeshSimpleGeometry& InSimpleGeometry);
@@ -341,7 +445,8 @@ namespace RealtimeMesh
 		virtual void SetCardRepresentation(FRealtimeMeshUpdateContext& UpdateContext, FRealtimeMeshCardRepresentation&& InCardRepresentation) override;
 		virtual void ClearCardRepresentation(FRealtimeMeshUpdateContext& UpdateContext) override;
 		
-		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry) const;
+		virtual bool GenerateComplexCollision(const FRealtimeMeshLockContext& LockContext, FRealtimeMeshComplexGeometry& ComplexGeometry,
+			const FRealtimeMeshCollisionCookToken& CookToken = FRealtimeMeshCollisionCookToken()) const;
 
 		virtual void InitializeProxy(FRealtimeMeshUpdateContext& UpdateContext) const override;
 		
@@ -355,6 +460,9 @@ namespace RealtimeMesh
 		void MarkCollisionDirtyNoCallback() const;
 		TFuture<ERealtimeMeshCollisionUpdateResult> MarkCollisionDirty() const;
 
+		/* Drops any async collision cook scheduled for this mesh that hasn't been applied yet */
+		void CancelCollisionCooks() const;
+
 		virtual void ProcessEndOfFrameUpdates() override;
 
 		friend class ::URealtimeMeshSimple;
@@ -398,6 +506,12 @@ public:
 	
 	void ProcessMesh(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const TFunctionRef<void(const RealtimeMesh::FRealtimeMeshStreamSet&)>& ProcessFunc) const;
 	TFuture<ERealtimeMeshProxyUpdateStatus> EditMeshInPlace(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const TFunctionRef<TSet<FRealtimeMeshStreamKey>(RealtimeMesh::FRealtimeMeshStreamSet&)>& EditFunc);
+	TFuture<ERealtimeMeshProxyUpdateStatus> EditMeshRangesInPlace(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const TFunctionRef<TSet<FRealtimeMeshStreamKey>(RealtimeMesh::FRealtimeMeshStreamSet&)>& EditFunc);
+	TFuture<ERealtimeMeshProxyUpdateStatus> UpdateSectionGroupStreamRange(const FRealtimeMeshSectionGroupKey& SectionGroupKey, RealtimeMesh::FRealtimeMeshStream&& RangeData, int32 DestinationIndex);
+
+	/* Use a collision only stream set for the complex collision of this section group instead of its render streams */
+	TFuture<ERealtimeMeshProxyUpdateStatus> SetSectionGroupCollisionStreams(const FRealtimeMeshSectionGroupKey& SectionGroupKey, RealtimeMesh::FRealtimeMeshStreamSet&& CollisionStreams);
+	TFuture<ERealtimeMeshProxyUpdateStatus> ClearSectionGroupCollisionStreams(const FRealtimeMeshSectionGroupKey& SectionGroupKey);
 
 
 
@@ -0,0 +1,211 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace RealtimeMesh
+{
+	/* Identifies buffers that can stand in for each other */
+	struct FRealtimeMeshBufferPoolKey
+	{
+		/* EBufferUsageFlags the buffer was created with */
+		uint32 Usage = 0;
+		uint32 Stride = 0;
+		/* Size class the buffer was created at, its full capacity */
+		uint64 Size = 0;
+
+		bool operator==(const FRealtimeMeshBufferPoolKey& Other) const
+		{
+			return Usage == Other.Usage && Stride == Other.Stride && Size == Other.Size;
+		}
+
+		bool operator!=(const FRealtimeMeshBufferPoolKey& Other) const { return !(*this == Other); }
+
+		friend uint32 GetTypeHash(const FRealtimeMeshBufferPoolKey& Key)
+		{
+			return HashCombine(HashCombine(::GetTypeHash(Key.Usage), ::GetTypeHash(Key.Stride)), ::GetTypeHash(Key.Size));
+		}
+	};
+
+	struct FRealtimeMeshBufferPoolStats
+	{
+		uint64 NumHits = 0;
+		uint64 NumMisses = 0;
+		/* Free buffers dropped after sitting in the pool longer than MaxIdleFrames */
+		uint64 NumTrimmed = 0;
+		/* Released buffers waiting to be reused */
+		int32 NumFree = 0;
+		uint64 FreeBytes = 0;
+		/* Capacity of the buffers currently handed out */
+		uint64 InUseBytes = 0;
+		/* Part of InUseBytes that holds data */
+		uint64 InUseDataBytes = 0;
+
+		float GetHitRate() const
+		{
+			const uint64 NumRequests = NumHits + NumMisses;
+			return NumRequests > 0 ? static_cast<float>(NumHits) / NumRequests : 0.0f;
+		}
+
+		/* Memory allocated but not holding data, the slack of live buffers plus everything idle in the pool */
+		uint64 GetWastedBytes() const { return (InUseBytes - InUseDataBytes) + FreeBytes; }
+	};
+
+	struct FRealtimeMeshBufferPoolPolicy
+	{
+		/* Smallest size class, smaller buffers all share it */
+		static constexpr uint64 MinSizeClass = 256;
+
+		/* Extra capacity on top of the requested size so a stream can grow a little without a new buffer, 0.25 is 25% */
+		float Slack = 0.25f;
+		/* Frames a released buffer waits before it's handed out again so the GPU is done reading it */
+		uint32 ReuseDelayFrames = 3;
+		/* Frames a free buffer is kept for before it's dropped */
+		uint32 MaxIdleFrames = 300;
+
+		/* Rounds up to steps of a quarter of the size's power of two, so a class is at most 25% larger than the size */
+		static uint64 GetSizeClass(uint64 Size)
+		{
+			if (Size <= MinSizeClass)
+			{
+				return MinSizeClass;
+			}
+			const uint64 Step = (uint64(1) << FMath::FloorLog2_64(Size)) / 4;
+			return Align(Size, Step);
+		}
+
+		/* Capacity a buffer holding Size bytes is created with */
+		uint64 GetPooledSize(uint64 Size) const
+		{
+			return GetSizeClass(Size + static_cast<uint64>(Size * FMath::Max(Slack, 0.0f)));
+		}
+
+		/* Whether Size bytes may keep using a buffer of the given capacity instead of moving to a new one */
+		bool CanReuseCapacity(uint64 Size, uint64 Capacity) const
+		{
+			// Shrinking far below the capacity moves to a smaller buffer so the memory can go back to the pool
+			return Size > 0 && Size <= Capacity && Capacity <= 2 * GetPooledSize(Size);
+		}
+	};
+
+	/*
+	 * Keeps released GPU buffers grouped by usage, stride and size class so buffers of a similar size can be reused
+	 * instead of created. Only tracks handles, creating, writing and destroying the buffers is up to the caller,
+	 * which keeps the policy usable without a GPU. Not thread safe.
+	 */
+	template<typename HandleType>
+	class TRealtimeMeshBufferPool
+	{
+	private:
+		struct FFreeBuffer
+		{
+			HandleType Handle;
+			uint64 ReleasedFrame;
+		};
+
+		/* Per key, oldest release first */
+		TMap<FRealtimeMeshBufferPoolKey, TArray<FFreeBuffer>> FreeBuffers;
+		FRealtimeMeshBufferPoolPolicy Policy;
+		FRealtimeMeshBufferPoolStats Stats;
+
+	public:
+		explicit TRealtimeMeshBufferPool(const FRealtimeMeshBufferPoolPolicy& InPolicy = FRealtimeMeshBufferPoolPolicy())
+			: Policy(InPolicy)
+		{
+		}
+
+		void SetPolicy(const FRealtimeMeshBufferPoolPolicy& InPolicy) { Policy = InPolicy; }
+		const FRealtimeMeshBufferPoolPolicy& GetPolicy() const { return Policy; }
+		const FRealtimeMeshBufferPoolStats& GetStats() const { return Stats; }
+
+		/*
+		 * Looks for a free buffer that can hold Size bytes and that the GPU is done with.
+		 * OutKey receives the size class to create the buffer at when nothing is reused, and the key to release it under later.
+		 * Returns true and sets OutHandle when a buffer was reused.
+		 */
+		bool Acquire(uint32 Usage, uint32 Stride, uint64 Size, uint64 Frame, FRealtimeMeshBufferPoolKey& OutKey, HandleType& OutHandle)
+		{
+			OutKey.Usage = Usage;
+			OutKey.Stride = Stride;
+			OutKey.Size = Policy.GetPooledSize(Size);
+
+			Stats.InUseBytes += OutKey.Size;
+			Stats.InUseDataBytes += Size;
+
+			if (TArray<FFreeBuffer>* Free = FreeBuffers.Find(OutKey))
+			{
+				if (Free->Num() > 0 && (*Free)[0].ReleasedFrame + Policy.ReuseDelayFrames <= Frame)
+				{
+					OutHandle = MoveTemp((*Free)[0].Handle);
+					Free->RemoveAt(0);
+					Stats.NumFree--;
+					Stats.FreeBytes -= OutKey.Size;
+					Stats.NumHits++;
+					return true;
+				}
+			}
+
+			Stats.NumMisses++;
+			return false;
+		}
+
+		/* Hands back a buffer acquired under Key, DataSize is how much of it held data */
+		void Release(const FRealtimeMeshBufferPoolKey& Key, uint64 DataSize, HandleType&& Handle, uint64 Frame)
+		{
+			check(Stats.InUseBytes >= Key.Size && Stats.InUseDataBytes >= DataSize);
+			Stats.InUseBytes -= Key.Size;
+			Stats.InUseDataBytes -= DataSize;
+
+			FreeBuffers.FindOrAdd(Key).Add({ MoveTemp(Handle), Frame });
+			Stats.NumFree++;
+			Stats.FreeBytes += Key.Size;
+		}
+
+		/* Tracks a buffer in use being rewritten with a different amount of data */
+		void UpdateDataSize(uint64 OldDataSize, uint64 NewDataSize)
+		{
+			check(Stats.InUseDataBytes >= OldDataSize);
+			Stats.InUseDataBytes = Stats.InUseDataBytes - OldDataSize + NewDataSize;
+		}
+
+		/* Drops free buffers idle for longer than MaxIdleFrames, returns how many were dropped */
+		int32 Trim(uint64 Frame)
+		{
+			int32 NumTrimmed = 0;
+			for (auto It = FreeBuffers.CreateIterator(); It; ++It)
+			{
+				TArray<FFreeBuffer>& Free = It.Value();
+				int32 NumExpired = 0;
+				while (NumExpired < Free.Num() && Free[NumExpired].ReleasedFrame + Policy.MaxIdleFrames < Frame)
+				{
+					NumExpired++;
+				}
+
+				if (NumExpired > 0)
+				{
+					Free.RemoveAt(0, NumExpired);
+					Stats.NumFree -= NumExpired;
+					Stats.FreeBytes -= NumExpired * It.Key().Size;
+					NumTrimmed += NumExpired;
+				}
+
+				if (Free.Num() == 0)
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			Stats.NumTrimmed += NumTrimmed;
+			return NumTrimmed;
+		}
+
+		/* Drops every free buffer */
+		void Empty()
+		{
+			FreeBuffers.Empty();
+			Stats.NumFree = 0;
+			Stats.FreeBytes = 0;
+		}
+	};
+}
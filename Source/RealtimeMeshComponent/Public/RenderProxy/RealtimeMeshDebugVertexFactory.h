@@ -115,6 +115,8 @@ namespace RealtimeMesh
 
 		virtual bool GatherVertexBufferResources(struct FRealtimeMeshResourceReferenceList& ActiveResources) const override;
 
+		virtual void SetVertexWindow(FRHICommandListBase& RHICmdList, uint32 InBaseVertexIndex, int32 NumVertices) override;
+
 		// Getters for shader parameter access
 		uint32 GetDebugMode() const { return DebugMode; }
 		float GetLineLength() const { return LineLength; }
@@ -5,6 +5,9 @@
 #include "Core/RealtimeMeshDataTypes.h"
 #include "Containers/ResourceArray.h"
 #include "Core/RealtimeMeshDataStream.h"
+#include "Core/RealtimeMeshInterleavedLayout.h"
+#include "Core/RealtimeMeshSectionGroupConfig.h"
+#include "RealtimeMeshBufferPool.h"
 #include "DataDrivenShaderPlatformInfo.h"
 
 namespace RealtimeMesh
@@ -20,24 +23,65 @@ namespace RealtimeMesh
 		FRealtimeMeshStream Stream;
 		EBufferUsageFlags UsageFlags;
 		FBufferRHIRef Buffer;
+		int32 DestinationIndex;
+		FRealtimeMeshInterleavedLayout InterleavedLayout;
+		/* Set when Buffer came from the buffer pool and has to go back to it */
+		FRealtimeMeshBufferPoolKey PoolKey;
+		bool bIsPooled;
+		/* Held by the render thread while it reads Stream, and by the game thread while it writes rows Stream still shares */
+		FCriticalSection StreamDataLock;
 
 	public:
 		FRealtimeMeshSectionGroupStreamUpdateData(FRealtimeMeshStream&& InStream, EBufferUsageFlags InUsageFlags)
 			: Stream(MoveTemp(InStream))
 			, UsageFlags(InUsageFlags)
+			, DestinationIndex(INDEX_NONE)
+			, bIsPooled(false)
 		{
 		}
 
+		/*
+		 * Creates a sub-range update, the stream contains only the rows to write into the existing
+		 * GPU buffer starting at row InDestinationIndex. No new buffer is created for range updates.
+		 */
+		FRealtimeMeshSectionGroupStreamUpdateData(FRealtimeMeshStream&& InStream, int32 InDestinationIndex)
+			: Stream(MoveTemp(InStream))
+			, UsageFlags(BUF_None)
+			, DestinationIndex(InDestinationIndex)
+			, bIsPooled(false)
+		{
+			check(DestinationIndex >= 0);
+		}
+
 		const FResourceArrayInterface* GetResource() const { return &Stream; }
 		FRealtimeMeshBufferLayout GetBufferLayout() const { return Stream.GetLayout(); }
 		FRealtimeMeshStreamKey GetStreamKey() const { return Stream.GetStreamKey(); }
 		int32 GetNumElements() const { return Stream.Num(); }
 		EBufferUsageFlags GetUsageFlags() const { return UsageFlags; }
 		FBufferRHIRef& GetBuffer() { return Buffer; }
+		const FRealtimeMeshStream& GetStream() const { return Stream; }
+		FCriticalSection& GetStreamDataLock() { return StreamDataLock; }
+
+		bool IsRangeUpdate() const { return DestinationIndex != INDEX_NONE; }
+		int32 GetDestinationIndex() const { return DestinationIndex; }
+
+		/* Set when the stream is a packed FRealtimeMeshStreams::Interleaved stream, describes where each source stream is in a row */
+		void SetInterleavedLayout(const FRealtimeMeshInterleavedLayout& InLayout) { InterleavedLayout = InLayout; }
+		const FRealtimeMeshInterleavedLayout& GetInterleavedLayout() const { return InterleavedLayout; }
+
+		/* Whether the buffer is pooled, its capacity is then larger than the stream, see RealtimeMesh.PoolStreamBuffers */
+		bool IsPooled() const { return bIsPooled; }
+		const FRealtimeMeshBufferPoolKey& GetPoolKey() const { return PoolKey; }
 
 		void CreateBufferAsyncIfPossible(FRealtimeMeshUpdateContext& UpdateContext);
 
 		void FinalizeInitialization(FRHICommandListBase& RHICmdList);
+
+		/* Process wide count of GPU buffers created for stream updates, async or on the render thread. Intended for profiling and tests */
+		static uint64 GetNumBuffersCreated();
+
+	private:
+		void AcquirePooledBuffer(FRHICommandListBase& RHICmdList);
 	};
 
 
@@ -52,6 +96,10 @@ namespace RealtimeMesh
 		FRealtimeMeshBufferMemoryLayout MemoryLayout;
 		uint32 BufferNum;
 		EBufferUsageFlags UsageFlags;
+		/* Bytes of the buffer holding data, less than its size when the buffer is pooled */
+		uint64 DataSize;
+		FRealtimeMeshBufferPoolKey PoolKey;
+		bool bIsPooled;
 
 #if WITH_EDITOR
 		FString BufferName;
@@ -64,6 +112,8 @@ namespace RealtimeMesh
 			, MemoryLayout(FRealtimeMeshBufferLayoutUtilities::GetBufferLayoutMemoryLayout(InBufferLayout))
 			, BufferNum(0)
 			, UsageFlags(BUF_Static | BUF_ShaderResource)
+			, DataSize(0)
+			, bIsPooled(false)
 #if WITH_EDITOR
 			, BufferName(InBufferName)
 #endif
@@ -85,6 +135,39 @@ namespace RealtimeMesh
 		virtual void InitializeResources(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) = 0;
 		virtual void ReleaseUnderlyingResource() = 0;
 		virtual bool IsResourceInitialized() const = 0;
+		virtual FRHIBuffer* GetRHIBuffer() const = 0;
+
+		/* Can this sub-range update be written directly into the existing buffer without recreating it */
+		virtual bool CanApplyRangeUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) const;
+
+		/* Writes the rows of a sub-range update into the existing buffer */
+		void ApplyRangeUpdate(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData);
+
+		/*
+		 * Can this full stream update be written over the existing buffer, it has to match the layout and size exactly.
+		 * Doing so keeps the buffer, its SRV and the vertex factory bindings to it valid.
+		 */
+		virtual bool CanApplyInPlaceUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) const;
+
+		/* Writes a full stream update over the contents of the existing buffer */
+		void ApplyInPlaceUpdate(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData);
+
+		/* Whether matching full stream updates should be written into the existing buffers, see RealtimeMesh.ReuseStreamBuffers */
+		static bool ShouldReuseBuffersInPlace();
+
+		/* Whether the stream is backed by its section group's vertex ring for this draw type, see RealtimeMesh.DynamicRingBuffers */
+		static bool ShouldUseRingBuffer(ERealtimeMeshSectionDrawType DrawType, const FRealtimeMeshStreamKey& StreamKey);
+
+		/* Render frames a region of a vertex ring stays reserved after it was last drawn from, see RealtimeMesh.DynamicRingBuffers.FramesInFlight */
+		static uint32 GetRingFramesInFlight();
+
+		/* Whether new stream buffers come from the buffer pool, see RealtimeMesh.PoolStreamBuffers */
+		static bool ShouldPoolBuffers();
+
+		/* Current state of the render thread's buffer pool */
+		static FRealtimeMeshBufferPoolStats GetBufferPoolStats();
+
+		FORCEINLINE bool IsPooled() const { return bIsPooled; }
 
 		FORCEINLINE const FRealtimeMeshBufferLayout& GetBufferLayout() const { return BufferLayout; }
 		FORCEINLINE EPixelFormat GetElementFormat() const { return ElementDetails.GetPixelFormat(); }
@@ -97,6 +180,13 @@ namespace RealtimeMesh
 
 		static constexpr int32 RHIUpdateBatchSize = 16;
 
+	protected:
+		/* Takes over the pooling state of the update's buffer */
+		void InitializePooling(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData);
+
+		/* Hands a pooled buffer back to the pool, called from ReleaseRHI before the buffer reference is dropped */
+		void ReturnToPool(FBufferRHIRef&& Buffer);
+
 		/*virtual void ApplyBufferUpdate(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData)
 		{
 			check(BufferLayout == UpdateData->GetBufferLayout());
@@ -114,8 +204,16 @@ namespace RealtimeMesh
 
 	class REALTIMEMESHCOMPONENT_API FRealtimeMeshVertexBuffer : public FRealtimeMeshGPUBuffer, public FVertexBufferWithSRV
 	{
+	private:
+		FRealtimeMeshInterleavedLayout InterleavedLayout;
+		/* Copy of the stream's rows, every update of the section group writes it to the group's next region of the ring */
+		TArray<uint8> RingContents;
+		/* Rows the buffer has room for when it's part of a section group's vertex ring, zero otherwise */
+		uint32 RingNumRows;
+
 	public:
 		FRealtimeMeshVertexBuffer(const FRealtimeMeshBufferLayout& InBufferLayout) : FRealtimeMeshGPUBuffer(TEXT("RealtimeMesh-VertexBuffer"), InBufferLayout)
+			, RingNumRows(0)
 		{
 		}
 
@@ -139,8 +237,13 @@ namespace RealtimeMesh
 			check(GetStride() > 0);
 			
 			VertexBufferRHI = UpdateData->GetBuffer();
-			
-			if (VertexBufferRHI && RHISupportsManualVertexFetch(GMaxRHIShaderPlatform))
+			InterleavedLayout = UpdateData->GetInterleavedLayout();
+			RingContents.Empty();
+			RingNumRows = 0;
+			InitializePooling(UpdateData);
+
+			// Interleaved buffers are only read through the vertex declaration, a typed view can't address the rows
+			if (VertexBufferRHI && RHISupportsManualVertexFetch(GMaxRHIShaderPlatform) && !IsInterleaved())
 			{
 				ShaderResourceViewRHI = RHICmdList.CreateShaderResourceView(FShaderResourceViewInitializer(VertexBufferRHI, GetElementFormat()));
 			}
@@ -150,9 +253,52 @@ namespace RealtimeMesh
 
 		virtual bool IsResourceInitialized() const override { return IsInitialized(); }
 
+		virtual FRHIBuffer* GetRHIBuffer() const override { return VertexBufferRHI.GetReference(); }
+
 		/** Gets the format of the vertex */
 		FORCEINLINE EVertexElementType GetVertexType() const { return ElementDetails.GetVertexType(); }
 
+		FORCEINLINE bool IsInterleaved() const { return InterleavedLayout.IsValid(); }
+		FORCEINLINE const FRealtimeMeshInterleavedLayout& GetInterleavedLayout() const { return InterleavedLayout; }
+
+		virtual bool CanApplyInPlaceUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) const override
+		{
+			// A different packing would need a new vertex declaration, ring buffers are only written through their section group's ring
+			return !IsRingBuffer() && FRealtimeMeshGPUBuffer::CanApplyInPlaceUpdate(UpdateData) && InterleavedLayout == UpdateData->GetInterleavedLayout();
+		}
+
+		virtual bool CanApplyRangeUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData) const override
+		{
+			return !IsRingBuffer() && FRealtimeMeshGPUBuffer::CanApplyRangeUpdate(UpdateData);
+		}
+
+		/*
+		 * Creates the buffer as one stream of a section group's vertex ring, with room for RingNumRows rows. The view covers the whole
+		 * ring so it stays valid across updates, the group writes each update to a free region and draws it by base vertex index.
+		 * The update is only staged here, the group uploads it with UploadRingRows.
+		 */
+		void InitializeRingResources(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData, uint32 InRingNumRows);
+
+		/* Replaces the ring with a bigger one once the group's streams outgrow it, the staged rows are kept */
+		void ResizeRing(FRHICommandListBase& RHICmdList, uint32 InRingNumRows);
+
+		/* Stages a full or sub-range update of a ring buffer. Returns false if the layout differs or a range is outside the current rows */
+		bool StageRingUpdate(const FRealtimeMeshSectionGroupStreamUpdateDataRef& UpdateData);
+
+		/* Writes the staged rows to the ring starting at FirstRow, a region no frame in flight reads from */
+		void UploadRingRows(FRHICommandListBase& RHICmdList, uint32 FirstRow);
+
+		/* Moves the staged rows to a buffer of their own, for when the section group stops using its ring */
+		void ReleaseRing(FRHICommandListBase& RHICmdList);
+
+		FORCEINLINE bool IsRingBuffer() const { return RingNumRows > 0; }
+		FORCEINLINE uint32 GetRingNumRows() const { return RingNumRows; }
+
+	private:
+		void CreateRingBuffer(FRHICommandListBase& RHICmdList);
+
+	public:
+
 		virtual void InitRHI(FRHICommandListBase& RHICmdList) override
 		{
 			/*FRHIResourceCreateInfo CreateInfo(TEXT("RealtimeMeshBuffer-Vertex-Init"));
@@ -166,8 +312,15 @@ namespace RealtimeMesh
 
 		virtual void ReleaseRHI() override
 		{
+			if (bIsPooled)
+			{
+				ReturnToPool(MoveTemp(VertexBufferRHI));
+			}
 			FVertexBufferWithSRV::ReleaseRHI();
 			BufferLayout = FRealtimeMeshBufferLayout::Invalid;
+			InterleavedLayout = FRealtimeMeshInterleavedLayout();
+			RingContents.Empty();
+			RingNumRows = 0;
 			BufferNum = 0;
 			UsageFlags = BUF_None;
 		}
@@ -236,12 +389,15 @@ namespace RealtimeMesh
 			// Adjust size by number of elements to handle structs containing 3 indices.
 			BufferNum *= BufferLayout.GetNumElements();
 			IndexBufferRHI = UpdateData->GetBuffer();
+			InitializePooling(UpdateData);
 			//Batcher.QueueUpdateRequest(IndexBufferRHI, UpdateData->GetNumElements() > 0? UpdateData->GetBuffer() : nullptr);
 		}
 
 		virtual void ReleaseUnderlyingResource() override { ReleaseResource(); }
 
 		virtual bool IsResourceInitialized() const override { return IsInitialized(); }
+
+		virtual FRHIBuffer* GetRHIBuffer() const override { return IndexBufferRHI.GetReference(); }
 		
 		virtual void InitRHI(FRHICommandListBase& RHICmdList) override
 		{
@@ -252,6 +408,10 @@ namespace RealtimeMesh
 
 		virtual void ReleaseRHI() override
 		{
+			if (bIsPooled)
+			{
+				ReturnToPool(MoveTemp(IndexBufferRHI));
+			}
 			FIndexBuffer::ReleaseRHI();
 			BufferLayout = FRealtimeMeshBufferLayout::Invalid;
 			BufferNum = 0;
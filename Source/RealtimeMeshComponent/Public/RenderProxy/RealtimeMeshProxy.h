@@ -95,12 +95,36 @@ namespace RealtimeMesh
 
 		struct FCommandBatch
 		{
-			TArray<FRealtimeMeshProxyUpdateBuilder::TaskFunctionType> Tasks;
+			TArray<FRealtimeMeshProxyTask> Tasks;
 			TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture> ThreadState;
+			/* Render frame the batch was taken off the queue */
+			uint64 QueuedFrame = 0;
+			/* The batch changes what the scene proxies draw, so a proxy in use by components only applies it when they're recreated */
+			bool bRequiresProxyRecreate = true;
+
+			uint64 GetUploadBytes() const
+			{
+				uint64 Bytes = 0;
+				for (const FRealtimeMeshProxyTask& Task : Tasks)
+				{
+					Bytes += Task.UploadBytes;
+				}
+				return Bytes;
+			}
 		};
 		TMpscQueue<FCommandBatch> CommandQueue;
 		FCriticalSection CommandQueueLock;
 
+		/* Batches taken off the queue that haven't been applied yet because they didn't fit in the upload budget or wait on a scene proxy recreate, oldest first */
+		TArray<FCommandBatch> PendingBatches;
+		uint64 PendingUploadBytes = 0;
+		int32 NumReportedPendingBatches = 0;
+		/* How many of PendingBatches an earlier upload schedule already paid for, applied the next time commands are processed */
+		int32 NumGrantedBatches = 0;
+		/* Set when batches were left waiting by the ProcessCommands of a scene proxy recreate, so they need another recreate once they get the budget */
+		bool bHasDeferredBatches = false;
+		bool bRecreateRequested = false;
+
 		TSharedRef<uint8> ReferencingHandle;
 
 		/* Tracks whether we have nanite data set/pending, so that the GT side can know what type of render proxy to use. */
@@ -164,13 +188,39 @@ namespace RealtimeMesh
 		virtual void SetCollisionRenderData(const FKAggregateGeom& InAggGeom, ECollisionTraceFlag InCollisionTraceFlag, const FCollisionResponseContainer& InCollisionResponse);
 #endif
 
-		void EnqueueCommandBatch(TArray<FRealtimeMeshProxyUpdateBuilder::TaskFunctionType>&& InTasks, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState);
-		void ProcessCommands(FRHICommandListBase& RHICmdList);
+		void EnqueueCommandBatch(TArray<FRealtimeMeshProxyTask>&& InTasks, const TSharedPtr<FRealtimeMeshCommandBatchIntermediateFuture>& ThreadState, bool bRequiresProxyRecreate = true);
+
+		/*
+		 * Applies the queued command batches. When RealtimeMesh.UploadBudgetPerFrame is set, only the batches that fit in what's left of this
+		 * frame's budget are applied and the rest wait for a later frame. Batches are always applied whole and in order.
+		 * With bStopAtProxyRecreate set, batches are only applied up to the first one that needs the scene proxies recreated, which is how
+		 * proxies in use by components pick up updates that leave their draw commands valid.
+		 */
+		void ProcessCommands(FRHICommandListBase& RHICmdList, bool bStopAtProxyRecreate = false);
+
+		/*
+		 * Splits this frame's upload budget between the proxies, highest upload priority first. Proxies without components are updated right away,
+		 * the others apply the updates that don't need their scene proxy recreated and get the rest when their scene proxy is next created.
+		 * That recreate is requested again once the budget is granted to updates an earlier recreate had to leave waiting.
+		 */
+		static void ProcessCommandsForFrame(FRHICommandListBase& RHICmdList, TConstArrayView<FRealtimeMeshProxyPtr> Proxies);
+
+		/* Command batches waiting on the upload budget and their size. Render thread only */
+		int32 GetNumPendingCommandBatches() const { return PendingBatches.Num(); }
+		uint64 GetPendingUploadBytes() const { return PendingUploadBytes; }
 		
 		virtual void UpdatedCachedState(FRHICommandListBase& RHICmdList);
 		virtual void Reset();
 
 	protected:
+		/* Moves the queued batches to PendingBatches, assumes CommandQueueLock is held */
+		void DrainCommandQueue();
+		/* Applies the first NumBatches pending batches, dropping stream tasks superseded by a later one of them */
+		void ApplyCommandBatches(FRHICommandListBase& RHICmdList, int32 NumBatches);
+		void UpdatePendingUploadStats();
+		/* Number of pending batches that can be applied before the first one that needs the scene proxies recreated */
+		int32 GetNumBatchesBeforeProxyRecreate() const;
+		void RequestProxyRecreate();
 
 		friend class FRealtimeMeshActiveLODIterator;
 	};
@@ -21,12 +21,40 @@ namespace RealtimeMesh
 		void FinalizeGameThread();
 	};
 
+	/* The stream of a section group a proxy task writes to */
+	struct FRealtimeMeshProxyStreamTaskKey
+	{
+		FRealtimeMeshSectionGroupKey SectionGroupKey;
+		FRealtimeMeshStreamKey StreamKey;
+
+		bool operator==(const FRealtimeMeshProxyStreamTaskKey& Other) const
+		{
+			return SectionGroupKey == Other.SectionGroupKey && StreamKey == Other.StreamKey;
+		}
+
+		friend uint32 GetTypeHash(const FRealtimeMeshProxyStreamTaskKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.SectionGroupKey), GetTypeHash(Key.StreamKey));
+		}
+	};
+
+	struct FRealtimeMeshProxyTask
+	{
+		TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)> Function;
+		/* Set when the task only writes to one stream */
+		TOptional<FRealtimeMeshProxyStreamTaskKey> StreamKey;
+		/* The task replaces the whole stream, so earlier queued tasks on the same stream don't need to run */
+		bool bReplacesStream = false;
+		/* Bytes the task writes to the GPU, counted against RealtimeMesh.UploadBudgetPerFrame */
+		uint64 UploadBytes = 0;
+	};
+
 	struct REALTIMEMESHCOMPONENT_API FRealtimeMeshProxyUpdateBuilder
 	{
 	public:
 		using TaskFunctionType = TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshProxy&)>;
 	private:
-		TArray<TaskFunctionType> Tasks;
+		TArray<FRealtimeMeshProxyTask> Tasks;
 		TOptional<bool> bNewHasNaniteData;
 		uint32 bRequiresProxyRecreate : 1;
 		uint32 bIsIgnoringCommands : 1;
@@ -82,6 +110,14 @@ namespace RealtimeMesh
 			}, bInRequiresProxyRecreate);
 		}
 
+		/*
+		 * Adds a section group task that only writes to one stream. When bReplacesStream is set the task rewrites the whole stream, like a full
+		 * upload or a removal, and the tasks on that stream still queued before it are dropped so no GPU work is spent on data that's replaced anyway.
+		 * UploadBytes is how much the task writes to the GPU.
+		 */
+		void AddSectionGroupStreamTask(const FRealtimeMeshSectionGroupKey& SectionGroupKey, const FRealtimeMeshStreamKey& StreamKey, uint64 UploadBytes,
+		                               TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionGroupProxy&)>&& Function, bool bReplacesStream, bool bInRequiresProxyRecreate = true);
+
 		void AddSectionTask(const FRealtimeMeshSectionKey& SectionKey, TUniqueFunction<void(FRHICommandListBase&, FRealtimeMeshSectionProxy&)>&& Function, bool bInRequiresProxyRecreate = true);
 
 		template <typename SectionProxyType>
@@ -92,5 +128,11 @@ namespace RealtimeMesh
 				Func(RHICmdList, static_cast<SectionProxyType&>(Section));
 			}, bInRequiresProxyRecreate);
 		}
+
+		/* Removes the stream tasks writing to any of ReplacedStreams, returns how many were removed */
+		static int32 RemoveSupersededStreamTasks(TArray<FRealtimeMeshProxyTask>& InTasks, const TSet<FRealtimeMeshProxyStreamTaskKey>& ReplacedStreams);
+
+		/* Process wide count of stream tasks dropped because a later upload replaced them. Intended for profiling and tests */
+		static uint64 GetNumSupersededStreamTasks();
 	};
 }
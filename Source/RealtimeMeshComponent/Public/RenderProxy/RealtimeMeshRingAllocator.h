@@ -0,0 +1,61 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace RealtimeMesh
+{
+	/*
+	 * Hands out offsets into a fixed size ring buffer that the GPU reads from while the CPU keeps writing ahead of it.
+	 * Every allocation is tagged with a fence, usually the render thread frame number, and stays reserved until that fence
+	 * has been released. Data the GPU might still be reading is never handed out again, an allocation that doesn't fit
+	 * fails instead so the caller can grow the ring, or wait for the GPU and release the fences it finished.
+	 * Only offsets are tracked, in whatever unit the caller sizes the ring in, the memory itself belongs to the caller. Not thread safe.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshRingAllocator
+	{
+	public:
+		static constexpr uint64 InvalidOffset = TNumericLimits<uint64>::Max();
+
+	private:
+		/* All the allocations made under one fence, they are released together */
+		struct FFenceBlock
+		{
+			uint64 Fence;
+			/* Head position after the last allocation with this fence */
+			uint64 End;
+			/* Bytes reserved by this fence including alignment and wrap padding */
+			uint64 Size;
+		};
+
+		uint64 Capacity;
+		uint64 Head;
+		uint64 Tail;
+		uint64 UsedBytes;
+		TArray<FFenceBlock, TInlineAllocator<4>> PendingFences;
+
+	public:
+		explicit FRealtimeMeshRingAllocator(uint64 InCapacity = 0);
+
+		/* Drops every allocation and resizes the ring */
+		void Reset(uint64 InCapacity);
+
+		/*
+		 * Reserves Size bytes aligned to Alignment, which doesn't need to be a power of two so rows of any stride can be addressed.
+		 * Fences must not decrease between calls. Returns InvalidOffset when there isn't room without overwriting data that's still in flight.
+		 */
+		uint64 Allocate(uint64 Size, uint64 Alignment, uint64 Fence);
+
+		/* Moves the allocations of the newest fence to a later one, for data that's still read after the frame it was written in */
+		void RetainNewest(uint64 Fence);
+
+		/* Frees every allocation made with a fence at or below CompletedFence */
+		void Release(uint64 CompletedFence);
+
+		uint64 GetCapacity() const { return Capacity; }
+		uint64 GetUsedBytes() const { return UsedBytes; }
+		int32 GetNumPendingFences() const { return PendingFences.Num(); }
+		bool IsEmpty() const { return UsedBytes == 0; }
+	};
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "RealtimeMeshGPUBuffer.h"
+#include "RealtimeMeshRingAllocator.h"
 #include "RealtimeMeshProxyShared.h"
 #include "RealtimeMeshVertexFactory.h"
 #include "RealtimeMeshSectionProxy.h"
@@ -75,8 +76,17 @@ namespace RealtimeMesh
 		FRayTracingGeometry RayTracingGeometry;
 #endif
 
+		/*
+		 * Rows of the ring every vertex stream of a dynamic group is suballocated from. Each update of the group writes all of its ring
+		 * streams to the same new rows, so one base vertex index moves the draws there without touching the buffers or the vertex factory.
+		 */
+		FRealtimeMeshRingAllocator VertexRing;
+		uint32 RingBaseVertex;
+		bool bRingDirty;
+
 		FRealtimeMeshDrawMask DrawMask;
 		bool bVertexFactoryDirty;
+		bool bRayTracingDirty;
 
 	public:
 		FRealtimeMeshSectionGroupProxy(const FRealtimeMeshSharedResourcesRef& InSharedResources, const FRealtimeMeshSectionGroupKey& InKey);
@@ -104,7 +114,12 @@ namespace RealtimeMesh
 		virtual void CreateSectionIfNotExists(const FRealtimeMeshSectionKey& SectionKey);
 		virtual void RemoveSection(const FRealtimeMeshSectionKey& SectionKey);
 
+		/*
+		 * Creates or replaces the GPU buffer for the stream. An update with the same layout and size as the existing buffer
+		 * is written over it instead, which leaves the vertex factory alone.
+		 */
 		virtual void CreateOrUpdateStream(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream);
+		virtual void UpdateStreamRange(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream);
 		virtual void RemoveStream(const FRealtimeMeshStreamKey& StreamKey);
 
 		virtual bool InitializeMeshBatch(FMeshBatch& MeshBatch, FRealtimeMeshResourceReferenceList& Resources, bool bIsLocalToWorldDeterminantNegative, bool bWantsDepthOnly) const;
@@ -112,11 +127,32 @@ namespace RealtimeMesh
 		virtual void UpdateCachedState(FRHICommandListBase& RHICmdList);
 		virtual void Reset();
 
+		/* Whether the vertex streams are suballocated from the group's ring, see RealtimeMesh.DynamicRingBuffers */
+		bool HasVertexRing() const { return VertexRing.GetCapacity() > 0; }
+
+		/* Process wide count of vertex factories (re)initialized by UpdateCachedState. Intended for profiling and tests */
+		static uint64 GetNumVertexFactoryRebuilds();
+
+		/* Process wide count of ring updates that found every region in flight and moved the ring to larger buffers. Intended for profiling and tests */
+		static uint64 GetNumRingOverflowGrows();
+
 	protected:
 		virtual bool UpdateRayTracingInfo(FRHICommandListBase& RHICmdList);
 
 		void RebuildSectionMap();
 
+		/* Stages a stream update into the vertex ring, returns false if the stream isn't backed by it */
+		bool UpdateRingStream(FRHICommandListBase& RHICmdList, const FRealtimeMeshSectionGroupStreamUpdateDataRef& InStream);
+		/* Writes the staged ring streams to the next free rows of the ring and moves the draws there */
+		void CommitVertexRing(FRHICommandListBase& RHICmdList);
+		/* Moves the ring streams to buffers of their own */
+		void ReleaseVertexRing(FRHICommandListBase& RHICmdList);
+		void ForEachRingStream(TFunctionRef<void(FRealtimeMeshVertexBuffer&)> Func) const;
+		/* Rows each update of the group takes from the ring, the largest of its ring streams */
+		uint32 GetNumRingRows() const;
+		/* Vertices every ring stream has a row for, what the draws can use */
+		int32 GetNumRingVertices() const;
+
 		friend class FRealtimeMeshActiveSectionIterator;
 	};	
 
@@ -0,0 +1,58 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace RealtimeMesh
+{
+	/*
+	 * Limits how many bytes of GPU uploads are applied per frame. Work is handed out in whole command batches, so a section group is never
+	 * left half updated, and each owner's batches are granted strictly in the order they were queued.
+	 * Owners are served highest priority first, then by how long their oldest batch has waited. A batch that doesn't fit in what's left waits
+	 * for a later frame, except that the first batch of a frame and batches waiting MaxDeferFrames or longer always go through so nothing stalls.
+	 * Only sizes and priorities are tracked, applying the batches is up to the caller. Not thread safe.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshUploadScheduler
+	{
+	public:
+		struct FBatch
+		{
+			uint64 Bytes;
+			uint32 FramesWaited;
+		};
+
+		struct FOwner
+		{
+			float Priority;
+			/* Queued batches, oldest first */
+			TArray<FBatch, TInlineAllocator<4>> Batches;
+		};
+
+	private:
+		/* 0 disables the budget */
+		uint64 BudgetBytes;
+		uint32 MaxDeferFrames;
+		uint64 CurrentFrame;
+		uint64 UsedBytes;
+		int32 NumGranted;
+
+	public:
+		FRealtimeMeshUploadScheduler();
+
+		/* Starts counting against a fresh budget when Frame differs from the current frame, the limits can change at any time */
+		void BeginFrame(uint64 Frame, uint64 InBudgetBytes, uint32 InMaxDeferFrames);
+
+		/* Charges a batch against this frame's budget, returns false when it has to wait for a later frame */
+		bool TryConsume(const FBatch& Batch);
+
+		/* Returns how many leading batches of each owner run this frame, in the order the owners were passed */
+		TArray<int32> Schedule(TConstArrayView<FOwner> Owners);
+
+		bool IsEnabled() const { return BudgetBytes > 0; }
+		uint64 GetBudgetBytes() const { return BudgetBytes; }
+		uint64 GetUsedBytes() const { return UsedBytes; }
+		uint64 GetRemainingBytes() const { return UsedBytes < BudgetBytes ? BudgetBytes - UsedBytes : 0; }
+		uint64 GetCurrentFrame() const { return CurrentFrame; }
+	};
+}
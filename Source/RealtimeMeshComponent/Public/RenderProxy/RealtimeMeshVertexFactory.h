@@ -62,6 +62,7 @@ namespace RealtimeMesh
 	public:
 		FRealtimeMeshVertexFactory(ERHIFeatureLevel::Type InFeatureLevel)
 			: FVertexFactory(InFeatureLevel)
+			, BaseVertexIndex(0)
 		{
 		}
 
@@ -78,8 +79,20 @@ namespace RealtimeMesh
 		virtual FRHIUniformBuffer* GetUniformBuffer() const = 0;
 
 		virtual bool GatherVertexBufferResources(struct FRealtimeMeshResourceReferenceList& ActiveResources) const = 0;
+
+		/*
+		 * Moves the draws to the NumVertices rows starting at InBaseVertexIndex without rebuilding the factory.
+		 * Section groups that suballocate their vertex streams from a ring call this after every update, the bindings cover the whole ring.
+		 */
+		virtual void SetVertexWindow(FRHICommandListBase& RHICmdList, uint32 InBaseVertexIndex, int32 NumVertices) { BaseVertexIndex = InBaseVertexIndex; }
+
+		/* Row the vertex streams are read from, draws pass it as their base vertex index */
+		uint32 GetBaseVertexIndex() const { return BaseVertexIndex; }
 		
 	protected:
+		uint32 BaseVertexIndex;
+
+
 		static TSharedPtr<FRealtimeMeshGPUBuffer> FindBuffer(const FRealtimeMeshStreamProxyMap& Buffers, ERealtimeMeshStreamType StreamType, FName BufferName)
 		{
 			const FRealtimeMeshStreamKey Key(StreamType, BufferName);
@@ -268,6 +281,19 @@ namespace RealtimeMesh
 		
 		static void GetVertexElements(ERHIFeatureLevel::Type FeatureLevel, EVertexInputStreamType InputStreamType, bool bSupportsManualVertexFetch, FDataType& Data, FVertexDeclarationElementList& Elements);
 
+		/**
+		 * Whether the local vertex shader can fetch a stream in this layout as is.
+		 * Quantized positions and octahedral/10:10:10:2 tangents can't be, the engine's local vertex factory shader has no decode for them.
+		 */
+		static bool CanFetchStreamLayout(const FRealtimeMeshStreamKey& StreamKey, const FRealtimeMeshBufferLayout& Layout);
+
+		/**
+		 * Decodes a stream the local vertex shader can't fetch into the closest layout it can.
+		 * Positions become FVector3f and tangents become FPackedNormal pairs, so tangents stay 8 bytes per vertex.
+		 * @return false if the stream was already fetchable or couldn't be decoded.
+		 */
+		static bool DecodeStreamForFetch(FRealtimeMeshStream& Stream, const FRealtimeMeshPositionQuantization& PositionQuantization);
+
 		
 		/**
 		* Copy the data from another vertex factory
@@ -286,6 +312,8 @@ namespace RealtimeMesh
 
 		virtual bool GatherVertexBufferResources(struct FRealtimeMeshResourceReferenceList& ActiveResources) const override;
 
+		virtual void SetVertexWindow(FRHICommandListBase& RHICmdList, uint32 InBaseVertexIndex, int32 NumVertices) override;
+
 		// FRenderResource interface.
 		virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
 		
@@ -370,6 +398,27 @@ namespace RealtimeMesh
 	};
 
 
+	/**
+	 * Local vertex factory variant that binds every vertex attribute from the single strided buffer of an
+	 * interleaved section group (see FRealtimeMeshSectionGroupConfig::bInterleaveVertexStreams).
+	 * Typed buffer views can't address interleaved rows, so this type is compiled without manual vertex fetch.
+	 */
+	class REALTIMEMESHCOMPONENT_API FRealtimeMeshInterleavedVertexFactory : public FRealtimeMeshLocalVertexFactory
+	{
+		DECLARE_VERTEX_FACTORY_TYPE(FRealtimeMeshInterleavedVertexFactory);
+
+	public:
+		FRealtimeMeshInterleavedVertexFactory(ERHIFeatureLevel::Type InFeatureLevel)
+			: FRealtimeMeshLocalVertexFactory(InFeatureLevel)
+		{
+		}
+
+		static void ModifyCompilationEnvironment(const FVertexFactoryShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
+
+		virtual void Initialize(FRHICommandListBase& RHICmdList, const TMap<FRealtimeMeshStreamKey, TSharedPtr<FRealtimeMeshGPUBuffer>>& Buffers) override;
+	};
+
+
 	/** Shader parameter class used by FRealtimeMeshVertexFactory only - no derived classes. */
 	class REALTIMEMESHCOMPONENT_API FRealtimeMeshVertexFactoryShaderParameters : public FVertexFactoryShaderParameters
 	{
@@ -0,0 +1,733 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mesh/RealtimeMeshAlgo.h"
+#include "Core/RealtimeMeshBuilder.h"
+#include "HAL/PlatformTime.h"
+#include "mikktspace.h"
+
+using namespace RealtimeMesh;
+
+namespace RealtimeMeshAlgoTests
+{
+	/*
+	 * The original multimap based tangent generation, kept here as the reference the
+	 * parallel implementation is validated and benchmarked against.
+	 */
+	static void GenerateTangentsReference(TConstArrayView<const uint32> Triangles, TConstArrayView<const FVector3f> Vertices, TConstArrayView<const FVector2f> UVs,
+	                                      TArray<FVector3f>& OutTangentX, TArray<FVector3f>& OutTangentZ, bool bComputeSmoothNormals)
+	{
+		const uint32 NumIndices = Triangles.Num();
+		const uint32 NumVertices = Vertices.Num();
+
+		TMultiMap<uint32, uint32> DuplicateVertexMap;
+
+		if (bComputeSmoothNormals)
+		{
+			using namespace RealtimeMeshAlgo::Private;
+
+			TArray<FRealtimeMeshVertexSortElement> VertexSorter;
+			VertexSorter.Empty(NumVertices);
+			for (uint32 Index = 0; Index < NumVertices; Index++)
+			{
+				new(VertexSorter)FRealtimeMeshVertexSortElement(Index, Vertices[Index]);
+			}
+
+			VertexSorter.Sort(FRuntimeMeshVertexSortingFunction());
+
+			for (uint32 Index = 0; Index < NumVertices; Index++)
+			{
+				const uint32 SrcVertIdx = VertexSorter[Index].Index;
+				const float Value = VertexSorter[Index].Value;
+
+				for (uint32 SubIndex = Index + 1; SubIndex < NumVertices; SubIndex++)
+				{
+					if (FMath::Abs(VertexSorter[SubIndex].Value - Value) > THRESH_POINTS_ARE_SAME * 4.01f)
+					{
+						break;
+					}
+
+					const uint32 OtherVertIdx = VertexSorter[SubIndex].Index;
+					if (Vertices[SrcVertIdx].Equals(Vertices[OtherVertIdx]))
+					{
+						DuplicateVertexMap.AddUnique(SrcVertIdx, OtherVertIdx);
+						DuplicateVertexMap.AddUnique(OtherVertIdx, SrcVertIdx);
+					}
+				}
+			}
+		}
+
+		const uint32 NumTris = NumIndices / 3;
+
+		TMultiMap<uint32, uint32> VertToTriMap;
+		TMultiMap<uint32, uint32> VertToTriSmoothMap;
+
+		TArray<FVector3f> FaceTangentX, FaceTangentY, FaceTangentZ;
+		FaceTangentX.AddUninitialized(NumTris);
+		FaceTangentY.AddUninitialized(NumTris);
+		FaceTangentZ.AddUninitialized(NumTris);
+
+		for (uint32 TriIdx = 0; TriIdx < NumTris; TriIdx++)
+		{
+			uint32 CornerIndex[3];
+			FVector3f P[3];
+
+			for (int32 CornerIdx = 0; CornerIdx < 3; CornerIdx++)
+			{
+				const uint32 VertIndex = FMath::Min(Triangles[(TriIdx * 3) + CornerIdx], NumVertices - 1);
+
+				CornerIndex[CornerIdx] = VertIndex;
+				P[CornerIdx] = Vertices[VertIndex];
+
+				TArray<uint32> VertOverlaps;
+				DuplicateVertexMap.MultiFind(VertIndex, VertOverlaps);
+
+				VertToTriMap.AddUnique(VertIndex, TriIdx);
+				VertToTriSmoothMap.AddUnique(VertIndex, TriIdx);
+
+				for (int32 OverlapIdx = 0; OverlapIdx < VertOverlaps.Num(); OverlapIdx++)
+				{
+					const int32 OverlapVertIdx = VertOverlaps[OverlapIdx];
+					VertToTriSmoothMap.AddUnique(OverlapVertIdx, TriIdx);
+
+					TArray<uint32> OverlapTris;
+					VertToTriMap.MultiFind(OverlapVertIdx, OverlapTris);
+					for (int32 OverlapTriIdx = 0; OverlapTriIdx < OverlapTris.Num(); OverlapTriIdx++)
+					{
+						VertToTriSmoothMap.AddUnique(VertIndex, OverlapTris[OverlapTriIdx]);
+					}
+				}
+			}
+
+			const FVector3f Edge21 = P[1] - P[2];
+			const FVector3f Edge20 = P[0] - P[2];
+			const FVector3f TriNormal = (Edge21 ^ Edge20).GetSafeNormal();
+
+			if (UVs.Num() > 0)
+			{
+				const FVector2f T1 = UVs[CornerIndex[0]];
+				const FVector2f T2 = UVs[CornerIndex[1]];
+				const FVector2f T3 = UVs[CornerIndex[2]];
+
+				FMatrix44f ParameterToLocal(
+					FPlane4f(P[1].X - P[0].X, P[1].Y - P[0].Y, P[1].Z - P[0].Z, 0),
+					FPlane4f(P[2].X - P[0].X, P[2].Y - P[0].Y, P[2].Z - P[0].Z, 0),
+					FPlane4f(P[0].X, P[0].Y, P[0].Z, 0),
+					FPlane4f(0, 0, 0, 1)
+				);
+
+				FMatrix44f ParameterToTexture(
+					FPlane4f(T2.X - T1.X, T2.Y - T1.Y, 0, 0),
+					FPlane4f(T3.X - T1.X, T3.Y - T1.Y, 0, 0),
+					FPlane4f(T1.X, T1.Y, 1, 0),
+					FPlane4f(0, 0, 0, 1)
+				);
+
+				const FMatrix44f TextureToLocal = ParameterToTexture.Inverse() * ParameterToLocal;
+
+				FaceTangentX[TriIdx] = TextureToLocal.TransformVector(FVector3f(1, 0, 0)).GetSafeNormal();
+				FaceTangentY[TriIdx] = TextureToLocal.TransformVector(FVector3f(0, 1, 0)).GetSafeNormal();
+			}
+			else
+			{
+				FaceTangentX[TriIdx] = Edge20.GetSafeNormal();
+				FaceTangentY[TriIdx] = (FaceTangentX[TriIdx] ^ TriNormal).GetSafeNormal();
+			}
+
+			FaceTangentZ[TriIdx] = TriNormal;
+		}
+
+		OutTangentX.SetNumZeroed(NumVertices);
+		OutTangentZ.SetNumZeroed(NumVertices);
+
+		for (uint32 VertxIdx = 0; VertxIdx < NumVertices; VertxIdx++)
+		{
+			TArray<uint32> SmoothTris;
+			VertToTriSmoothMap.MultiFind(VertxIdx, SmoothTris);
+			for (const uint32 TriIdx : SmoothTris)
+			{
+				OutTangentZ[VertxIdx] += FaceTangentZ[TriIdx];
+			}
+
+			TArray<uint32> TangentTris;
+			VertToTriMap.MultiFind(VertxIdx, TangentTris);
+			for (const uint32 TriIdx : TangentTris)
+			{
+				OutTangentX[VertxIdx] += FaceTangentX[TriIdx];
+			}
+
+			FVector3f& TangentX = OutTangentX[VertxIdx];
+			FVector3f& TangentZ = OutTangentZ[VertxIdx];
+
+			TangentX.Normalize();
+			TangentZ.Normalize();
+			TangentX -= TangentZ * (TangentZ | TangentX);
+			TangentX.Normalize();
+		}
+	}
+
+	/*
+	 * Builds a displaced grid split into two halves along X with duplicated seam vertices
+	 * using different UVs, so smoothing across duplicate positions is exercised.
+	 */
+	static void BuildSeamGrid(int32 GridSize, TArray<uint32>& OutIndices, TArray<FVector3f>& OutVertices, TArray<FVector2f>& OutUVs)
+	{
+		const int32 HalfSize = GridSize / 2;
+
+		auto AddHalf = [&](int32 StartX, int32 EndX, float UVOffset)
+		{
+			const int32 BaseVertex = OutVertices.Num();
+			const int32 RowSize = EndX - StartX + 1;
+
+			for (int32 Y = 0; Y <= GridSize; Y++)
+			{
+				for (int32 X = StartX; X <= EndX; X++)
+				{
+					const float Height = FMath::Sin(X * 0.37f) * 40.0f + FMath::Cos(Y * 0.23f) * 25.0f;
+					OutVertices.Add(FVector3f(X * 100.0f, Y * 100.0f, Height));
+					OutUVs.Add(FVector2f(UVOffset + X / float(GridSize), Y / float(GridSize)));
+				}
+			}
+
+			for (int32 Y = 0; Y < GridSize; Y++)
+			{
+				for (int32 X = 0; X < RowSize - 1; X++)
+				{
+					const uint32 V0 = BaseVertex + Y * RowSize + X;
+					const uint32 V1 = V0 + 1;
+					const uint32 V2 = V0 + RowSize;
+					const uint32 V3 = V2 + 1;
+
+					OutIndices.Append({ V0, V2, V1 });
+					OutIndices.Append({ V1, V2, V3 });
+				}
+			}
+		};
+
+		AddHalf(0, HalfSize, 0.0f);
+		AddHalf(HalfSize, GridSize, 0.5f);
+	}
+
+	static void GenerateTangentsParallel(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices, TConstArrayView<const FVector2f> UVs,
+	                                     TArray<FVector3f>& OutTangentX, TArray<FVector3f>& OutTangentZ, bool bComputeSmoothNormals)
+	{
+		OutTangentX.SetNumZeroed(Vertices.Num());
+		OutTangentZ.SetNumZeroed(Vertices.Num());
+
+		const TFunction<FVector2f(int32)> UVGetter = [&UVs](int32 Index) { return UVs[Index]; };
+		RealtimeMeshAlgo::GenerateTangents<uint32>(Indices, Vertices, UVGetter, [&](int32 Index, FVector3f TangentX, FVector3f TangentZ)
+		{
+			OutTangentX[Index] = TangentX;
+			OutTangentZ[Index] = TangentZ;
+		}, bComputeSmoothNormals);
+	}
+
+	static void BuildSeamGridStreamSet(int32 GridSize, FRealtimeMeshStreamSet& OutStreamSet)
+	{
+		TArray<uint32> Indices;
+		TArray<FVector3f> Vertices;
+		TArray<FVector2f> UVs;
+		BuildSeamGrid(GridSize, Indices, Vertices, UVs);
+
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(OutStreamSet);
+		Builder.EnableTexCoords();
+		for (int32 Index = 0; Index < Vertices.Num(); Index++)
+		{
+			Builder.AddVertex(Vertices[Index]).SetTexCoord(UVs[Index]);
+		}
+		for (int32 Index = 0; Index < Indices.Num(); Index += 3)
+		{
+			Builder.AddTriangle(Indices[Index], Indices[Index + 1], Indices[Index + 2]);
+		}
+	}
+
+	/*
+	 * A cylinder with a bulge along its height, so the normals curve in both directions. U wraps around
+	 * the cylinder, the last column duplicates the first at U = 1 to make the UV seam.
+	 */
+	static void BuildSeamCylinder(int32 NumSides, int32 NumRings, TArray<uint32>& OutIndices, TArray<FVector3f>& OutVertices, TArray<FVector2f>& OutUVs)
+	{
+		const int32 RowSize = NumSides + 1;
+		for (int32 Ring = 0; Ring <= NumRings; Ring++)
+		{
+			const float V = Ring / float(NumRings);
+			const float Radius = 100.0f * (1.0f + 0.3f * FMath::Sin(V * UE_PI));
+			for (int32 Side = 0; Side <= NumSides; Side++)
+			{
+				const float U = Side / float(NumSides);
+				const float Angle = (Side % NumSides) * UE_TWO_PI / NumSides;
+				OutVertices.Add(FVector3f(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, V * 300.0f));
+				OutUVs.Add(FVector2f(U, V));
+			}
+		}
+
+		for (int32 Ring = 0; Ring < NumRings; Ring++)
+		{
+			for (int32 Side = 0; Side < NumSides; Side++)
+			{
+				const uint32 V0 = Ring * RowSize + Side;
+				const uint32 V1 = V0 + 1;
+				const uint32 V2 = V0 + RowSize;
+				const uint32 V3 = V2 + 1;
+
+				OutIndices.Append({ V0, V2, V1 });
+				OutIndices.Append({ V1, V2, V3 });
+			}
+		}
+	}
+
+	/*
+	 * Runs the engine's MikkTSpace over the mesh with the given normals, and returns its tangent and
+	 * binormal sign for every triangle corner.
+	 */
+	static void GenerateMikkTSpaceReference(TConstArrayView<const uint32> Indices, TConstArrayView<const FVector3f> Vertices, TConstArrayView<const FVector2f> UVs,
+	                                        TConstArrayView<const FVector3f> Normals, TArray<FVector3f>& OutCornerTangents, TArray<float>& OutCornerSigns)
+	{
+		struct FUserData
+		{
+			TConstArrayView<const uint32> Indices;
+			TConstArrayView<const FVector3f> Vertices;
+			TConstArrayView<const FVector2f> UVs;
+			TConstArrayView<const FVector3f> Normals;
+			TArray<FVector3f>& CornerTangents;
+			TArray<float>& CornerSigns;
+
+			static FUserData& Get(const SMikkTSpaceContext* Context) { return *static_cast<FUserData*>(Context->m_pUserData); }
+			uint32 GetVertex(int32 Face, int32 Corner) const { return Indices[Face * 3 + Corner]; }
+		};
+
+		OutCornerTangents.SetNumZeroed(Indices.Num());
+		OutCornerSigns.SetNumZeroed(Indices.Num());
+		FUserData UserData { Indices, Vertices, UVs, Normals, OutCornerTangents, OutCornerSigns };
+
+		SMikkTSpaceInterface Interface;
+		FMemory::Memzero(Interface);
+		Interface.m_getNumFaces = [](const SMikkTSpaceContext* Context) { return FUserData::Get(Context).Indices.Num() / 3; };
+		Interface.m_getNumVerticesOfFace = [](const SMikkTSpaceContext* Context, const int32 Face) { return 3; };
+		Interface.m_getPosition = [](const SMikkTSpaceContext* Context, float Position[], const int32 Face, const int32 Corner)
+		{
+			const FUserData& Data = FUserData::Get(Context);
+			const FVector3f& Vertex = Data.Vertices[Data.GetVertex(Face, Corner)];
+			Position[0] = Vertex.X;
+			Position[1] = Vertex.Y;
+			Position[2] = Vertex.Z;
+		};
+		Interface.m_getNormal = [](const SMikkTSpaceContext* Context, float Normal[], const int32 Face, const int32 Corner)
+		{
+			const FUserData& Data = FUserData::Get(Context);
+			const FVector3f& VertexNormal = Data.Normals[Data.GetVertex(Face, Corner)];
+			Normal[0] = VertexNormal.X;
+			Normal[1] = VertexNormal.Y;
+			Normal[2] = VertexNormal.Z;
+		};
+		Interface.m_getTexCoord = [](const SMikkTSpaceContext* Context, float TexCoord[], const int32 Face, const int32 Corner)
+		{
+			const FUserData& Data = FUserData::Get(Context);
+			const FVector2f& UV = Data.UVs[Data.GetVertex(Face, Corner)];
+			TexCoord[0] = UV.X;
+			TexCoord[1] = UV.Y;
+		};
+		Interface.m_setTSpaceBasic = [](const SMikkTSpaceContext* Context, const float Tangent[], const float Sign, const int32 Face, const int32 Corner)
+		{
+			FUserData& Data = FUserData::Get(Context);
+			Data.CornerTangents[Face * 3 + Corner] = FVector3f(Tangent[0], Tangent[1], Tangent[2]);
+			Data.CornerSigns[Face * 3 + Corner] = Sign;
+		};
+
+		SMikkTSpaceContext Context;
+		Context.m_pInterface = &Interface;
+		Context.m_pUserData = &UserData;
+		genTangSpaceDefault(&Context);
+	}
+
+	static float GetMaxDeviation(TConstArrayView<const FVector3f> A, TConstArrayView<const FVector3f> B)
+	{
+		float MaxDeviation = 0.0f;
+		for (int32 Index = 0; Index < A.Num(); Index++)
+		{
+			MaxDeviation = FMath::Max(MaxDeviation, (A[Index] - B[Index]).GetAbsMax());
+		}
+		return MaxDeviation;
+	}
+}
+
+// ============================================================================
+// GenerateTangents Tests
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshAlgoGenerateTangentsMatchesReferenceTest,
+	"RealtimeMeshComponent.Algo.GenerateTangents.MatchesReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshAlgoGenerateTangentsMatchesReferenceTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshAlgoTests;
+
+	TArray<uint32> Indices;
+	TArray<FVector3f> Vertices;
+	TArray<FVector2f> UVs;
+	BuildSeamGrid(16, Indices, Vertices, UVs);
+
+	for (const bool bSmooth : { true, false })
+	{
+		TArray<FVector3f> ReferenceX, ReferenceZ;
+		GenerateTangentsReference(Indices, Vertices, UVs, ReferenceX, ReferenceZ, bSmooth);
+
+		TArray<FVector3f> ParallelX, ParallelZ;
+		GenerateTangentsParallel(Indices, Vertices, UVs, ParallelX, ParallelZ, bSmooth);
+
+		const FString Mode = bSmooth ? TEXT("smooth") : TEXT("hard");
+		TestTrue(FString::Printf(TEXT("Normals should match reference (%s)"), *Mode), GetMaxDeviation(ReferenceZ, ParallelZ) < 1.0e-4f);
+		TestTrue(FString::Printf(TEXT("Tangents should match reference (%s)"), *Mode), GetMaxDeviation(ReferenceX, ParallelX) < 1.0e-4f);
+	}
+
+	// Seam vertices should share a normal when smoothing
+	{
+		RealtimeMeshAlgo::FRealtimeMeshVertexAdjacency Adjacency;
+		Adjacency.Build(Indices, Vertices, true);
+
+		int32 NumSeamVertices = 0;
+		for (int32 Index = 0; Index < Vertices.Num(); Index++)
+		{
+			NumSeamVertices += Adjacency.GetDuplicates(Index).Num() > 0 ? 1 : 0;
+		}
+		TestEqual(TEXT("Both sides of the seam should find their duplicate"), NumSeamVertices, 2 * 17);
+	}
+
+	// Stream set version should produce the same normals
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTexCoords();
+		for (int32 Index = 0; Index < Vertices.Num(); Index++)
+		{
+			Builder.AddVertex(Vertices[Index]).SetTexCoord(UVs[Index]);
+		}
+		for (int32 Index = 0; Index < Indices.Num(); Index += 3)
+		{
+			Builder.AddTriangle(Indices[Index], Indices[Index + 1], Indices[Index + 2]);
+		}
+
+		RealtimeMeshAlgo::GenerateTangents(StreamSet, true);
+
+		TArray<FVector3f> ReferenceX, ReferenceZ;
+		TArray<FVector2f> HalfUVs;
+		for (const FVector2f& UV : UVs)
+		{
+			HalfUVs.Add(FVector2f(FVector2DHalf(UV)));
+		}
+		GenerateTangentsReference(Indices, Vertices, HalfUVs, ReferenceX, ReferenceZ, true);
+
+		const FRealtimeMeshStream* Tangents = StreamSet.Find(FRealtimeMeshStreams::Tangents);
+		if (TestNotNull(TEXT("Tangents stream should be created"), Tangents))
+		{
+			TestEqual(TEXT("Tangents stream should cover every vertex"), Tangents->Num(), Vertices.Num());
+
+			float MaxDeviation = 0.0f;
+			for (int32 Index = 0; Index < Vertices.Num(); Index++)
+			{
+				const FRealtimeMeshTangentsNormalPrecision& Tangent = *Tangents->GetDataAtVertex<FRealtimeMeshTangentsNormalPrecision>(Index);
+				MaxDeviation = FMath::Max(MaxDeviation, (Tangent.GetNormal() - ReferenceZ[Index]).GetAbsMax());
+			}
+			// Packed normals only have 8 bits per component
+			TestTrue(TEXT("Packed normals should match reference"), MaxDeviation < 0.02f);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshAlgoGenerateTangentsMikkTSpaceTest,
+	"RealtimeMeshComponent.Algo.GenerateTangents.MikkTSpace",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshAlgoGenerateTangentsMikkTSpaceTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshAlgoTests;
+
+	constexpr int32 GridSize = 16;
+	TArray<uint32> Indices;
+	TArray<FVector3f> Vertices;
+	TArray<FVector2f> UVs;
+	BuildSeamGrid(GridSize, Indices, Vertices, UVs);
+
+	// Frame should be orthonormal around the generated normals on a displaced grid
+	{
+		RealtimeMeshAlgo::FRealtimeMeshVertexAdjacency Adjacency;
+		Adjacency.Build(Indices, Vertices, true);
+
+		TArray<FVector3f> TangentX, TangentY, TangentZ;
+		TangentX.SetNumUninitialized(Vertices.Num());
+		TangentY.SetNumUninitialized(Vertices.Num());
+		TangentZ.SetNumUninitialized(Vertices.Num());
+		RealtimeMeshAlgo::GenerateTangentsFromAdjacency(Indices, Vertices, UVs, Adjacency, TangentX, TangentY, TangentZ);
+		RealtimeMeshAlgo::GenerateMikkTSpaceTangentsFromAdjacency(Indices, Vertices, UVs, TangentZ, Adjacency, TangentX, TangentY);
+
+		float MaxError = 0.0f;
+		for (int32 Index = 0; Index < Vertices.Num(); Index++)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(TangentX[Index].Size() - 1.0f));
+			MaxError = FMath::Max(MaxError, FMath::Abs(TangentX[Index] | TangentZ[Index]));
+			MaxError = FMath::Max(MaxError, FMath::Abs(TangentY[Index] | TangentX[Index]));
+		}
+		TestTrue(TEXT("Tangent frame should be orthonormal"), MaxError < 1.0e-4f);
+	}
+
+	// Should match the engine's MikkTSpace on a curved mesh with a UV seam, given the same normals
+	{
+		TArray<uint32> CylinderIndices;
+		TArray<FVector3f> CylinderVertices;
+		TArray<FVector2f> CylinderUVs;
+		BuildSeamCylinder(24, 12, CylinderIndices, CylinderVertices, CylinderUVs);
+
+		RealtimeMeshAlgo::FRealtimeMeshVertexAdjacency Adjacency;
+		Adjacency.Build(CylinderIndices, CylinderVertices, true);
+
+		TArray<FVector3f> TangentX, TangentY, TangentZ;
+		TangentX.SetNumUninitialized(CylinderVertices.Num());
+		TangentY.SetNumUninitialized(CylinderVertices.Num());
+		TangentZ.SetNumUninitialized(CylinderVertices.Num());
+		RealtimeMeshAlgo::GenerateTangentsFromAdjacency(CylinderIndices, CylinderVertices, CylinderUVs, Adjacency, TangentX, TangentY, TangentZ);
+		RealtimeMeshAlgo::GenerateMikkTSpaceTangentsFromAdjacency(CylinderIndices, CylinderVertices, CylinderUVs, TangentZ, Adjacency, TangentX, TangentY);
+
+		TArray<FVector3f> ReferenceTangents;
+		TArray<float> ReferenceSigns;
+		GenerateMikkTSpaceReference(CylinderIndices, CylinderVertices, CylinderUVs, TangentZ, ReferenceTangents, ReferenceSigns);
+
+		// MikkTSpace assumes the opposite winding, so its sign may be flipped throughout, but never for only some corners
+		float MaxDeviation = 0.0f;
+		int32 NumMatchingHandedness = 0;
+		for (int32 Corner = 0; Corner < CylinderIndices.Num(); Corner++)
+		{
+			const uint32 VertIdx = CylinderIndices[Corner];
+			MaxDeviation = FMath::Max(MaxDeviation, (TangentX[VertIdx] - ReferenceTangents[Corner]).GetAbsMax());
+
+			const FVector3f ReferenceBinormal = (TangentZ[VertIdx] ^ ReferenceTangents[Corner]) * ReferenceSigns[Corner];
+			NumMatchingHandedness += (ReferenceBinormal | TangentY[VertIdx]) > 0.0f ? 1 : 0;
+		}
+		TestTrue(TEXT("Tangents should match MikkTSpace"), MaxDeviation < 1.0e-3f);
+		TestTrue(TEXT("Binormal signs should match MikkTSpace"), NumMatchingHandedness == 0 || NumMatchingHandedness == CylinderIndices.Num());
+	}
+
+	// On a flat grid the tangent should follow +U and the binormal +V, with the second half mirrored in U
+	const int32 NumFirstHalfVertices = (GridSize / 2 + 1) * (GridSize + 1);
+	for (int32 Index = 0; Index < Vertices.Num(); Index++)
+	{
+		Vertices[Index].Z = 0.0f;
+		if (Index >= NumFirstHalfVertices)
+		{
+			UVs[Index].X = 2.0f - UVs[Index].X;
+		}
+	}
+
+	FRealtimeMeshStreamSet StreamSet;
+	TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+	Builder.EnableTexCoords();
+	for (int32 Index = 0; Index < Vertices.Num(); Index++)
+	{
+		Builder.AddVertex(Vertices[Index]).SetTexCoord(UVs[Index]);
+	}
+	for (int32 Index = 0; Index < Indices.Num(); Index += 3)
+	{
+		Builder.AddTriangle(Indices[Index], Indices[Index + 1], Indices[Index + 2]);
+	}
+
+	RealtimeMeshAlgo::GenerateTangents(StreamSet, true, RealtimeMeshAlgo::ETangentGenerationMode::MikkTSpace);
+
+	const FRealtimeMeshStream* Tangents = StreamSet.Find(FRealtimeMeshStreams::Tangents);
+	if (TestNotNull(TEXT("Tangents stream should be created"), Tangents))
+	{
+		float MaxDeviation = 0.0f;
+		int32 NumWrongHandedness = 0;
+		for (int32 Index = 0; Index < Vertices.Num(); Index++)
+		{
+			const bool bMirrored = Index >= NumFirstHalfVertices;
+			const FRealtimeMeshTangentsNormalPrecision& Tangent = *Tangents->GetDataAtVertex<FRealtimeMeshTangentsNormalPrecision>(Index);
+
+			MaxDeviation = FMath::Max(MaxDeviation, (Tangent.GetNormal() - FVector3f::ZAxisVector).GetAbsMax());
+			MaxDeviation = FMath::Max(MaxDeviation, (Tangent.GetTangent() - FVector3f::XAxisVector * (bMirrored ? -1.0f : 1.0f)).GetAbsMax());
+			MaxDeviation = FMath::Max(MaxDeviation, (Tangent.GetBinormal() - FVector3f::YAxisVector).GetAbsMax());
+			NumWrongHandedness += Tangent.IsBinormalFlipped() != bMirrored ? 1 : 0;
+		}
+		// Packed normals only have 8 bits per component
+		TestTrue(TEXT("Flat grid tangents should follow the UVs"), MaxDeviation < 0.02f);
+		TestEqual(TEXT("Only the mirrored half should flip the binormal"), NumWrongHandedness, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshAlgoUpdateTangentsTest,
+	"RealtimeMeshComponent.Algo.UpdateTangents.MatchesFullGeneration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshAlgoUpdateTangentsTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshAlgoTests;
+	using RealtimeMeshAlgo::ETangentGenerationMode;
+
+	constexpr int32 GridSize = 16;
+	constexpr int32 HalfRowSize = GridSize / 2 + 1;
+	const int32 NumFirstHalfVertices = HalfRowSize * (GridSize + 1);
+
+	// One vertex inside the first half, and a seam vertex along with its duplicate on the other half
+	const int32 InteriorVertex = 8 * HalfRowSize + 3;
+	const int32 SeamVertex = 5 * HalfRowSize + GridSize / 2;
+	const int32 SeamDuplicate = NumFirstHalfVertices + 5 * HalfRowSize;
+	const TArray<int32> DirtyVertices = { InteriorVertex, SeamVertex, SeamDuplicate };
+
+	auto Deform = [&](FRealtimeMeshStreamSet& StreamSet)
+	{
+		const TArrayView<FVector3f> Positions = StreamSet.FindChecked(FRealtimeMeshStreams::Position).GetArrayView<FVector3f>();
+		for (const int32 VertIdx : DirtyVertices)
+		{
+			Positions[VertIdx] += FVector3f(10.0f, -20.0f, 60.0f);
+		}
+	};
+
+	for (const ETangentGenerationMode Mode : { ETangentGenerationMode::FaceAveraged, ETangentGenerationMode::MikkTSpace })
+	{
+		const FString ModeName = Mode == ETangentGenerationMode::MikkTSpace ? TEXT("MikkTSpace") : TEXT("FaceAveraged");
+
+		FRealtimeMeshStreamSet StreamSet;
+		BuildSeamGridStreamSet(GridSize, StreamSet);
+		RealtimeMeshAlgo::GenerateTangents(StreamSet, true, Mode);
+
+		RealtimeMeshAlgo::FRealtimeMeshVertexAdjacency Adjacency;
+		TestTrue(TEXT("Adjacency should build from the stream set"), Adjacency.Build(StreamSet, true));
+
+		const FRealtimeMeshStream& TangentsStream = StreamSet.FindChecked(FRealtimeMeshStreams::Tangents);
+		const TArray<FRealtimeMeshTangentsNormalPrecision> OriginalTangents(TangentsStream.GetArrayView<FRealtimeMeshTangentsNormalPrecision>());
+
+		// Expected result is a full regeneration of the deformed mesh
+		FRealtimeMeshStreamSet Expected(StreamSet);
+		Deform(Expected);
+		RealtimeMeshAlgo::GenerateTangents(Expected, true, Mode);
+
+		Deform(StreamSet);
+		StreamSet.FindChecked(FRealtimeMeshStreams::Tangents).ClearDirtyRange();
+		const FInt32Range UpdatedRange = RealtimeMeshAlgo::UpdateTangents(StreamSet, Adjacency, DirtyVertices, Mode);
+
+		TestFalse(FString::Printf(TEXT("Some vertices should be updated (%s)"), *ModeName), UpdatedRange.IsEmpty());
+		TestTrue(FString::Printf(TEXT("Updated range shouldn't cover the whole mesh (%s)"), *ModeName), UpdatedRange.Size<int32>() < TangentsStream.Num());
+		TestTrue(FString::Printf(TEXT("Updated range should be marked dirty (%s)"), *ModeName), TangentsStream.GetDirtyRange() == UpdatedRange);
+
+		const FRealtimeMeshStream& ExpectedTangentsStream = Expected.FindChecked(FRealtimeMeshStreams::Tangents);
+
+		float MaxDeviation = 0.0f;
+		int32 NumChangedOutsideRange = 0;
+		for (int32 Index = 0; Index < TangentsStream.Num(); Index++)
+		{
+			const FRealtimeMeshTangentsNormalPrecision& Tangent = *TangentsStream.GetDataAtVertex<FRealtimeMeshTangentsNormalPrecision>(Index);
+			const FRealtimeMeshTangentsNormalPrecision& ExpectedTangent = *ExpectedTangentsStream.GetDataAtVertex<FRealtimeMeshTangentsNormalPrecision>(Index);
+
+			MaxDeviation = FMath::Max(MaxDeviation, (Tangent.GetNormal() - ExpectedTangent.GetNormal()).GetAbsMax());
+			MaxDeviation = FMath::Max(MaxDeviation, (Tangent.GetTangent() - ExpectedTangent.GetTangent()).GetAbsMax());
+
+			if (!UpdatedRange.Contains(Index) && FMemory::Memcmp(&Tangent, &OriginalTangents[Index], sizeof(Tangent)) != 0)
+			{
+				NumChangedOutsideRange++;
+			}
+		}
+
+		// Summation order differs from the full pass, allow for a step of the 8 bit packing
+		TestTrue(FString::Printf(TEXT("Incremental update should match full generation (%s)"), *ModeName), MaxDeviation < 0.02f);
+		TestEqual(FString::Printf(TEXT("Vertices outside the updated range shouldn't change (%s)"), *ModeName), NumChangedOutsideRange, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshAlgoGenerateTangentsBenchmarkTest,
+	"RealtimeMeshComponent.Algo.GenerateTangents.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshAlgoGenerateTangentsBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshAlgoTests;
+
+	TArray<uint32> Indices;
+	TArray<FVector3f> Vertices;
+	TArray<FVector2f> UVs;
+	BuildSeamGrid(256, Indices, Vertices, UVs);
+
+	TArray<FVector3f> ReferenceX, ReferenceZ;
+	const double ReferenceStart = FPlatformTime::Seconds();
+	GenerateTangentsReference(Indices, Vertices, UVs, ReferenceX, ReferenceZ, true);
+	const double ReferenceTime = FPlatformTime::Seconds() - ReferenceStart;
+
+	TArray<FVector3f> ParallelX, ParallelZ;
+	const double ParallelStart = FPlatformTime::Seconds();
+	GenerateTangentsParallel(Indices, Vertices, UVs, ParallelX, ParallelZ, true);
+	const double ParallelTime = FPlatformTime::Seconds() - ParallelStart;
+
+	AddInfo(FString::Printf(TEXT("GenerateTangents on %d triangles, %d vertices: reference %.2f ms, parallel %.2f ms (%.1fx)"),
+		Indices.Num() / 3, Vertices.Num(), ReferenceTime * 1000.0, ParallelTime * 1000.0, ReferenceTime / FMath::Max(ParallelTime, UE_DOUBLE_SMALL_NUMBER)));
+
+	TestTrue(TEXT("Normals should match reference"), GetMaxDeviation(ReferenceZ, ParallelZ) < 1.0e-4f);
+	TestTrue(TEXT("Tangents should match reference"), GetMaxDeviation(ReferenceX, ParallelX) < 1.0e-4f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshAlgoWeldVerticesTest,
+	"RealtimeMeshComponent.Algo.WeldVertices.MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshAlgoWeldVerticesTest::RunTest(const FString& Parameters)
+{
+	constexpr float Tolerance = 0.5f;
+
+	// Scattered points plus copies jittered within the tolerance, some of them chained off each other
+	FRandomStream Random(1234);
+	TArray<FVector3f> Vertices;
+	for (int32 Index = 0; Index < 2000; Index++)
+	{
+		Vertices.Add(FVector3f(Random.FRandRange(0.0f, 100.0f), Random.FRandRange(0.0f, 100.0f), Random.FRandRange(0.0f, 100.0f)));
+	}
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		const FVector3f Source = Vertices[Random.RandHelper(Vertices.Num())];
+		Vertices.Add(Source + FVector3f(Random.GetUnitVector()) * Random.FRandRange(0.0f, Tolerance * 0.9f));
+	}
+	Vertices.Add(Vertices[0]);
+
+	// Reference: lowest index vertex within the tolerance, resolved in index order
+	auto WeldReference = [&Vertices](float InTolerance, TArray<int32>& OutVertexMap, TArray<int32>& OutWeldedVertices)
+	{
+		OutVertexMap.SetNumUninitialized(Vertices.Num());
+		OutWeldedVertices.Reset();
+		for (int32 VertIdx = 0; VertIdx < Vertices.Num(); VertIdx++)
+		{
+			int32 Target = VertIdx;
+			for (int32 OtherIdx = 0; OtherIdx < VertIdx; OtherIdx++)
+			{
+				if (FVector3f::DistSquared(Vertices[VertIdx], Vertices[OtherIdx]) <= FMath::Square(InTolerance))
+				{
+					Target = OtherIdx;
+					break;
+				}
+			}
+			OutVertexMap[VertIdx] = Target == VertIdx ? OutWeldedVertices.Add(VertIdx) : OutVertexMap[Target];
+		}
+	};
+
+	for (const float TestTolerance : { Tolerance, 0.0f })
+	{
+		TArray<int32> ExpectedMap, ExpectedWelded;
+		WeldReference(TestTolerance, ExpectedMap, ExpectedWelded);
+
+		TArray<int32> VertexMap, WeldedVertices;
+		const int32 NumWelded = RealtimeMeshAlgo::WeldVertices(Vertices, TestTolerance, VertexMap, WeldedVertices);
+
+		TestEqual(FString::Printf(TEXT("Welded vertex count should match brute force (tolerance %.2f)"), TestTolerance), NumWelded, ExpectedWelded.Num());
+		TestEqual(FString::Printf(TEXT("Welded vertices should match brute force (tolerance %.2f)"), TestTolerance), WeldedVertices, ExpectedWelded);
+		TestEqual(FString::Printf(TEXT("Vertex map should match brute force (tolerance %.2f)"), TestTolerance), VertexMap, ExpectedMap);
+	}
+
+	TArray<int32> VertexMap, WeldedVertices;
+	TestEqual(TEXT("Zero tolerance should only weld exact duplicates"), RealtimeMeshAlgo::WeldVertices(Vertices, 0.0f, VertexMap, WeldedVertices), Vertices.Num() - 1);
+	TestEqual(TEXT("Exact duplicate should map to the original"), VertexMap.Last(), VertexMap[0]);
+
+	return true;
+}
@@ -2,6 +2,8 @@
 
 #include "Misc/AutomationTest.h"
 #include "Interface/Core/RealtimeMeshDataConversion.h"
+#include "Interface/Core/RealtimeMeshBuilder.h"
+#include "HAL/PlatformTime.h"
 
 using namespace RealtimeMesh;
 
@@ -251,6 +253,132 @@ bool FRealtimeMeshTypeConversionUtilitiesRegistrationTest::RunTest(const FString
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshTypeConversionUtilitiesRuntimeRegistrationTest,
+	"RealtimeMeshComponent.DataConversion.FRealtimeMeshTypeConversionUtilities.RuntimeRegistration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshTypeConversionUtilitiesRuntimeRegistrationTest::RunTest(const FString& Parameters)
+{
+	// A pair nothing registers by default
+	const FRealtimeMeshElementType FromType(ERealtimeMeshDatumType::UInt8, 3);
+	const FRealtimeMeshElementType ToType(ERealtimeMeshDatumType::Int8, 3);
+
+	TestFalse(TEXT("Pair should not be registered by default"), FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType));
+
+	auto MakeConverters = [](int32 Offset)
+	{
+		return FRealtimeMeshElementConverters(
+			[Offset](const void* Input, void* Output)
+			{
+				for (int32 Index = 0; Index < 3; Index++)
+				{
+					static_cast<int8*>(Output)[Index] = static_cast<int8>(static_cast<const uint8*>(Input)[Index] + Offset);
+				}
+			},
+			[Offset](const void* Input, void* Output, uint32 Count)
+			{
+				for (uint32 Index = 0; Index < Count * 3; Index++)
+				{
+					static_cast<int8*>(Output)[Index] = static_cast<int8>(static_cast<const uint8*>(Input)[Index] + Offset);
+				}
+			});
+	};
+
+	const uint8 Input[3] = { 1, 2, 3 };
+	int8 Output[3] = { 0, 0, 0 };
+
+	FRealtimeMeshTypeConversionUtilities::RegisterTypeConverter(FromType, ToType, MakeConverters(1));
+	TestTrue(TEXT("Pair should be registered"), FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType));
+	TestFalse(TEXT("Reverse pair should not be registered"), FRealtimeMeshTypeConversionUtilities::CanConvert(ToType, FromType));
+
+	FRealtimeMeshTypeConversionUtilities::GetTypeConverter(FromType, ToType).ConvertSingleElement(Input, Output);
+	TestEqual(TEXT("Registered converter should be used"), Output[2], int8(4));
+
+	// Registering again replaces the converter
+	FRealtimeMeshTypeConversionUtilities::RegisterTypeConverter(FromType, ToType, MakeConverters(10));
+	FRealtimeMeshTypeConversionUtilities::GetTypeConverter(FromType, ToType).ConvertContiguousArray(Input, Output, 1);
+	TestEqual(TEXT("Replacement converter should be used"), Output[2], int8(13));
+
+	FRealtimeMeshTypeConversionUtilities::UnregisterTypeConverter(FromType, ToType);
+	TestFalse(TEXT("Pair should be unregistered"), FRealtimeMeshTypeConversionUtilities::CanConvert(FromType, ToType));
+
+	// Invalid element types are never convertible
+	TestFalse(TEXT("Invalid types should not be convertible"),
+		FRealtimeMeshTypeConversionUtilities::CanConvert(FRealtimeMeshElementType::Invalid, GetRealtimeMeshDataElementType<float>()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshTypeConversionUtilitiesLookupBenchmarkTest,
+	"RealtimeMeshComponent.DataConversion.FRealtimeMeshTypeConversionUtilities.LookupBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshTypeConversionUtilitiesLookupBenchmarkTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumIterations = 1000000;
+
+	const FRealtimeMeshElementType Pairs[][2] =
+	{
+		{ GetRealtimeMeshDataElementType<FVector2f>(), GetRealtimeMeshDataElementType<FVector2DHalf>() },
+		{ GetRealtimeMeshDataElementType<FVector4f>(), GetRealtimeMeshDataElementType<FPackedNormal>() },
+		{ GetRealtimeMeshDataElementType<uint32>(), GetRealtimeMeshDataElementType<uint16>() },
+		{ GetRealtimeMeshDataElementType<FVector3f>(), GetRealtimeMeshDataElementType<FVector3f>() },
+	};
+
+	// Hashed lookup the registry used before, as the baseline
+	TMap<FRealtimeMeshElementConversionKey, const FRealtimeMeshElementConverters*> HashedLookup;
+	for (const auto& Pair : Pairs)
+	{
+		HashedLookup.Add(FRealtimeMeshElementConversionKey(Pair[0], Pair[1]), &FRealtimeMeshTypeConversionUtilities::GetTypeConverter(Pair[0], Pair[1]));
+	}
+
+	const FRealtimeMeshElementConverters* Sink = nullptr;
+
+	const double HashedStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		const auto& Pair = Pairs[Iteration & 3];
+		Sink = HashedLookup.FindChecked(FRealtimeMeshElementConversionKey(Pair[0], Pair[1]));
+	}
+	const double HashedTime = FPlatformTime::Seconds() - HashedStart;
+
+	int32 NumMismatches = 0;
+	const double TableStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		const auto& Pair = Pairs[Iteration & 3];
+		Sink = &FRealtimeMeshTypeConversionUtilities::GetTypeConverter(Pair[0], Pair[1]);
+	}
+	const double TableTime = FPlatformTime::Seconds() - TableStart;
+
+	for (const auto& Pair : Pairs)
+	{
+		NumMismatches += HashedLookup.FindChecked(FRealtimeMeshElementConversionKey(Pair[0], Pair[1])) != &FRealtimeMeshTypeConversionUtilities::GetTypeConverter(Pair[0], Pair[1]) ? 1 : 0;
+	}
+	TestEqual(TEXT("Table should return the registered converters"), NumMismatches, 0);
+	TestNotNull(TEXT("Lookups should have run"), Sink);
+
+	// Builder construction is two lookups (plus two more in checked builds)
+	FRealtimeMeshStream Stream = FRealtimeMeshStream::Create<FVector2DHalf>(FRealtimeMeshStreams::TexCoords);
+	Stream.SetNumZeroed(1);
+
+	int32 NumBuilt = 0;
+	const double BuilderStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		TRealtimeMeshStreamBuilder<FVector2f, void> Builder(Stream);
+		NumBuilt += Builder.Num();
+	}
+	const double BuilderTime = FPlatformTime::Seconds() - BuilderStart;
+	TestEqual(TEXT("Every builder should see the stream"), NumBuilt, NumIterations);
+
+	AddInfo(FString::Printf(TEXT("%d converter lookups: hashed %.2f ms, table %.2f ms (%.1fx)"), NumIterations,
+		HashedTime * 1000.0, TableTime * 1000.0, HashedTime / FMath::Max(TableTime, UE_DOUBLE_SMALL_NUMBER)));
+	AddInfo(FString::Printf(TEXT("%d converting stream builders constructed in %.2f ms"), NumIterations, BuilderTime * 1000.0));
+
+	return true;
+}
+
 // ============================================================================
 // Integer Conversion Tests
 // ============================================================================
@@ -894,3 +1022,147 @@ bool FRealtimeMeshArrayConversionTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ============================================================================
+// Conversion Kernel Tests
+// ============================================================================
+
+namespace RealtimeMeshDataConversionTests
+{
+	// Not a multiple of any kernel batch size so the scalar tails are covered too
+	static constexpr uint32 KernelTestCount = 1027;
+	static constexpr uint32 KernelBenchmarkCount = 1 << 20;
+
+	static FVector4f MakeNormalLikeValue(uint32 Index)
+	{
+		return FVector4f(FMath::Sin(Index * 0.1f), FMath::Cos(Index * 0.3f), FMath::Sin(Index * 0.7f) * 1.01f, (Index & 1) ? 1.0f : -1.0f);
+	}
+
+	static void MakeSourceValue(uint32 Index, float& Out) { Out = FMath::Sin(Index * 0.37f) * 100.0f; }
+	static void MakeSourceValue(uint32 Index, FVector2f& Out) { Out = FVector2f(FMath::Sin(Index * 0.37f), FMath::Cos(Index * 0.11f)) * 4.0f; }
+	static void MakeSourceValue(uint32 Index, FVector4f& Out) { Out = MakeNormalLikeValue(Index); }
+	static void MakeSourceValue(uint32 Index, FFloat16& Out) { Out = FFloat16(FMath::Sin(Index * 0.37f) * 100.0f); }
+	static void MakeSourceValue(uint32 Index, FVector2DHalf& Out) { Out = FVector2DHalf(FVector2f(FMath::Sin(Index * 0.37f), FMath::Cos(Index * 0.11f)) * 4.0f); }
+	static void MakeSourceValue(uint32 Index, FPackedNormal& Out) { Out = FPackedNormal(MakeNormalLikeValue(Index)); }
+	static void MakeSourceValue(uint32 Index, FPackedRGBA16N& Out) { Out = FPackedRGBA16N(MakeNormalLikeValue(Index)); }
+	static void MakeSourceValue(uint32 Index, int32& Out) { Out = static_cast<int32>((Index * 7) % 70000); }
+	static void MakeSourceValue(uint32 Index, uint32& Out) { Out = (Index * 7) % 70000; }
+	static void MakeSourceValue(uint32 Index, uint16& Out) { Out = static_cast<uint16>((Index * 7) % 65536); }
+
+	// Components compared between the scalar and kernel output, packed types are compared by their encoded values
+	static FVector4d GetComponents(float Value) { return FVector4d(Value, 0, 0, 0); }
+	static FVector4d GetComponents(const FVector2f& Value) { return FVector4d(Value.X, Value.Y, 0, 0); }
+	static FVector4d GetComponents(const FVector4f& Value) { return FVector4d(Value.X, Value.Y, Value.Z, Value.W); }
+	static FVector4d GetComponents(const FFloat16& Value) { return FVector4d(Value.Encoded, 0, 0, 0); }
+	static FVector4d GetComponents(const FVector2DHalf& Value) { return FVector4d(Value.X.Encoded, Value.Y.Encoded, 0, 0); }
+	static FVector4d GetComponents(const FPackedNormal& Value) { return FVector4d(Value.Vector.X, Value.Vector.Y, Value.Vector.Z, Value.Vector.W); }
+	static FVector4d GetComponents(const FPackedRGBA16N& Value) { return FVector4d(Value.X, Value.Y, Value.Z, Value.W); }
+	static FVector4d GetComponents(int32 Value) { return FVector4d(Value, 0, 0, 0); }
+	static FVector4d GetComponents(uint32 Value) { return FVector4d(Value, 0, 0, 0); }
+	static FVector4d GetComponents(uint16 Value) { return FVector4d(Value, 0, 0, 0); }
+
+	/*
+	 * Converts the same data through the original per element scalar conversion and the registered
+	 * contiguous converter, returning the largest component difference between the two.
+	 */
+	template <typename FromType, typename ToType>
+	static double CompareKernelToScalar(uint32 Count, double& OutScalarSeconds, double& OutKernelSeconds)
+	{
+		TArray<FromType> Source;
+		Source.SetNumUninitialized(Count);
+		for (uint32 Index = 0; Index < Count; Index++)
+		{
+			MakeSourceValue(Index, Source[Index]);
+		}
+
+		TArray<ToType> ScalarOutput;
+		ScalarOutput.SetNumUninitialized(Count);
+		const double ScalarStart = FPlatformTime::Seconds();
+		for (uint32 Index = 0; Index < Count; Index++)
+		{
+			ScalarOutput[Index] = ConvertRealtimeMeshType<FromType, ToType>(Source[Index]);
+		}
+		OutScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+		const FRealtimeMeshElementConverters& Converter = FRealtimeMeshTypeConversionUtilities::GetTypeConverter(
+			GetRealtimeMeshDataElementType<FromType>(), GetRealtimeMeshDataElementType<ToType>());
+
+		TArray<ToType> KernelOutput;
+		KernelOutput.SetNumUninitialized(Count);
+		const double KernelStart = FPlatformTime::Seconds();
+		Converter.ConvertContiguousArray(Source.GetData(), KernelOutput.GetData(), Count);
+		OutKernelSeconds = FPlatformTime::Seconds() - KernelStart;
+
+		double MaxDifference = 0.0;
+		for (uint32 Index = 0; Index < Count; Index++)
+		{
+			const FVector4d Difference = GetComponents(ScalarOutput[Index]) - GetComponents(KernelOutput[Index]);
+			MaxDifference = FMath::Max(MaxDifference, FMath::Max(FMath::Max(FMath::Abs(Difference.X), FMath::Abs(Difference.Y)), FMath::Max(FMath::Abs(Difference.Z), FMath::Abs(Difference.W))));
+		}
+		return MaxDifference;
+	}
+
+	template <typename FromType, typename ToType>
+	static void CheckKernel(FAutomationTestBase& Test, const TCHAR* Name, double Tolerance, uint32 Count, bool bReportTiming)
+	{
+		double ScalarSeconds, KernelSeconds;
+		const double MaxDifference = CompareKernelToScalar<FromType, ToType>(Count, ScalarSeconds, KernelSeconds);
+
+		Test.TestTrue(FString::Printf(TEXT("%s kernel should match scalar conversion (max difference %f)"), Name, MaxDifference), MaxDifference <= Tolerance);
+
+		if (bReportTiming)
+		{
+			Test.AddInfo(FString::Printf(TEXT("%s x%u: scalar %.3f ms, kernel %.3f ms (%.1fx)"), Name, Count,
+				ScalarSeconds * 1000.0, KernelSeconds * 1000.0, ScalarSeconds / FMath::Max(KernelSeconds, UE_DOUBLE_SMALL_NUMBER)));
+		}
+	}
+
+	static void CheckAllKernels(FAutomationTestBase& Test, uint32 Count, bool bReportTiming)
+	{
+		// Halves are compared by encoding, rounding may differ by one step between the scalar and vector instructions on some platforms
+		CheckKernel<float, FFloat16>(Test, TEXT("float -> FFloat16"), 1.0, Count, bReportTiming);
+		CheckKernel<FFloat16, float>(Test, TEXT("FFloat16 -> float"), 0.0, Count, bReportTiming);
+		CheckKernel<FVector2f, FVector2DHalf>(Test, TEXT("FVector2f -> FVector2DHalf"), 1.0, Count, bReportTiming);
+		CheckKernel<FVector2DHalf, FVector2f>(Test, TEXT("FVector2DHalf -> FVector2f"), 0.0, Count, bReportTiming);
+
+		// Packed values are compared by encoding, allowing a step for values landing exactly on a rounding boundary
+		CheckKernel<FVector4f, FPackedNormal>(Test, TEXT("FVector4f -> FPackedNormal"), 1.0, Count, bReportTiming);
+		CheckKernel<FPackedNormal, FVector4f>(Test, TEXT("FPackedNormal -> FVector4f"), 1.0e-6, Count, bReportTiming);
+		CheckKernel<FVector4f, FPackedRGBA16N>(Test, TEXT("FVector4f -> FPackedRGBA16N"), 1.0, Count, bReportTiming);
+		CheckKernel<FPackedRGBA16N, FVector4f>(Test, TEXT("FPackedRGBA16N -> FVector4f"), 1.0e-6, Count, bReportTiming);
+
+		CheckKernel<int32, uint16>(Test, TEXT("int32 -> uint16"), 0.0, Count, bReportTiming);
+		CheckKernel<uint32, uint16>(Test, TEXT("uint32 -> uint16"), 0.0, Count, bReportTiming);
+		CheckKernel<uint16, int32>(Test, TEXT("uint16 -> int32"), 0.0, Count, bReportTiming);
+		CheckKernel<uint16, uint32>(Test, TEXT("uint16 -> uint32"), 0.0, Count, bReportTiming);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConversionKernelsMatchScalarTest,
+	"RealtimeMeshComponent.DataConversion.Kernels.MatchScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConversionKernelsMatchScalarTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshDataConversionTests;
+
+	CheckAllKernels(*this, KernelTestCount, false);
+
+	// Small counts only go through the scalar tail
+	CheckAllKernels(*this, 3, false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConversionKernelsBenchmarkTest,
+	"RealtimeMeshComponent.DataConversion.Kernels.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConversionKernelsBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshDataConversionTests;
+
+	CheckAllKernels(*this, KernelBenchmarkCount, true);
+
+	return true;
+}
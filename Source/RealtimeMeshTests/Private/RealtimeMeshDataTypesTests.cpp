@@ -3,6 +3,8 @@
 #include "Misc/AutomationTest.h"
 #include "RealtimeMeshCore.h"
 #include "Interface/Core/RealtimeMeshDataTypes.h"
+#include "Core/RealtimeMeshDataStream.h"
+#include "RenderProxy/RealtimeMeshVertexFactory.h"
 
 using namespace RealtimeMesh;
 
@@ -806,4 +808,191 @@ bool FRealtimeMeshBufferLayoutTraitsTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+//==============================================================================
+// Compressed Vertex Format Tests
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshOctahedralNormalRoundTripTest,
+	"RealtimeMeshComponent.DataTypes.CompressedFormats.OctahedralNormalRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshOctahedralNormalRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FVector3f Directions[] =
+	{
+		FVector3f(0.0f, 0.0f, 1.0f),
+		FVector3f(0.0f, 0.0f, -1.0f),
+		FVector3f(1.0f, 0.0f, 0.0f),
+		FVector3f(0.0f, -1.0f, 0.0f),
+		FVector3f(0.3f, -0.7f, 0.2f).GetSafeNormal(),
+		FVector3f(-0.5f, 0.5f, -0.7f).GetSafeNormal(),
+	};
+
+	for (const FVector3f& Direction : Directions)
+	{
+		for (const float W : { 1.0f, -1.0f })
+		{
+			FRealtimeMeshOctahedralNormal Encoded;
+			Encoded.Set(Direction, W);
+
+			const FVector3f Decoded = Encoded.ToFVector3f();
+			TestTrue(*FString::Printf(TEXT("Octahedral direction %s preserved"), *Direction.ToString()), 1.0f - FVector3f::DotProduct(Direction, Decoded) < 1e-6f);
+			TestEqual(*FString::Printf(TEXT("Octahedral W %f preserved"), W), Encoded.GetW(), W);
+		}
+	}
+
+	// Tangents stored in octahedral form keep the binormal sign
+	{
+		const TRealtimeMeshTangents<FVector4f> Source(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f), true);
+		const FRealtimeMeshTangentsOctahedral Compressed(Source.GetNormal(), Source.GetTangent(), true);
+		TestTrue(TEXT("Octahedral tangents binormal flipped"), Compressed.IsBinormalFlipped());
+		TestTrue(TEXT("Octahedral tangents normal preserved"), Compressed.GetNormal().Equals(Source.GetNormal(), 0.001f));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshPackedRGB10A2NRoundTripTest,
+	"RealtimeMeshComponent.DataTypes.CompressedFormats.PackedRGB10A2NRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshPackedRGB10A2NRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FVector3f Directions[] =
+	{
+		FVector3f(0.0f, 0.0f, 1.0f),
+		FVector3f(-1.0f, 0.0f, 0.0f),
+		FVector3f(0.3f, -0.7f, 0.2f).GetSafeNormal(),
+		FVector3f(-0.5f, 0.5f, -0.7f).GetSafeNormal(),
+	};
+
+	for (const FVector3f& Direction : Directions)
+	{
+		for (const float W : { 1.0f, -1.0f })
+		{
+			const FRealtimeMeshPackedRGB10A2N Encoded(FVector4f(Direction, W));
+
+			const FVector3f Decoded = Encoded.ToFVector3f().GetSafeNormal();
+			const float AngleDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector3f::DotProduct(Direction, Decoded), -1.0f, 1.0f)));
+			TestTrue(*FString::Printf(TEXT("RGB10A2 direction %s within 0.2 degrees (was %f)"), *Direction.ToString(), AngleDegrees), AngleDegrees < 0.2f);
+			TestEqual(*FString::Printf(TEXT("RGB10A2 W %f preserved"), W), Encoded.GetW(), W);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshPositionQuantizationTest,
+	"RealtimeMeshComponent.DataTypes.CompressedFormats.PositionQuantization",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshPositionQuantizationTest::RunTest(const FString& Parameters)
+{
+	const FBox3f Bounds(FVector3f(-250.0f, 10.0f, -3.0f), FVector3f(750.0f, 20.0f, 5000.0f));
+	const FRealtimeMeshPositionQuantization Quantization = FRealtimeMeshPositionQuantization::FromBounds(Bounds);
+	const FVector3f MaxError = Quantization.GetMaxError();
+
+	FRandomStream Random(1234);
+	for (int32 Index = 0; Index < 256; Index++)
+	{
+		const FVector3f Position(
+			Random.FRandRange(Bounds.Min.X, Bounds.Max.X),
+			Random.FRandRange(Bounds.Min.Y, Bounds.Max.Y),
+			Random.FRandRange(Bounds.Min.Z, Bounds.Max.Z));
+		const FVector3f Error = (Quantization.Dequantize(Quantization.Quantize(Position)) - Position).GetAbs();
+
+		// Allow for float rounding on top of the half step quantization error
+		if (!TestTrue(TEXT("Quantization error within bound"), Error.X <= MaxError.X * 1.01f && Error.Y <= MaxError.Y * 1.01f && Error.Z <= MaxError.Z * 1.01f))
+		{
+			break;
+		}
+	}
+
+	// Corners map to the ends of the range
+	TestTrue(TEXT("Min quantizes to 0"), Quantization.Quantize(Bounds.Min) == FRealtimeMeshQuantizedPosition{ 0, 0, 0, 0 });
+	TestEqual(TEXT("Max quantizes to 65535"), Quantization.Quantize(Bounds.Max).X, static_cast<uint16>(MAX_uint16));
+
+	// A flat axis doesn't divide by zero
+	const FRealtimeMeshPositionQuantization Flat = FRealtimeMeshPositionQuantization::FromBounds(FBox3f(FVector3f(0.0f, 5.0f, 0.0f), FVector3f(1.0f, 5.0f, 1.0f)));
+	TestEqual(TEXT("Flat axis dequantizes to bias"), Flat.Dequantize(Flat.Quantize(FVector3f(0.5f, 5.0f, 0.5f))).Y, 5.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCompressedStreamDecodeTest,
+	"RealtimeMeshComponent.DataTypes.CompressedFormats.DecodeForFetch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCompressedStreamDecodeTest::RunTest(const FString& Parameters)
+{
+	const FRealtimeMeshPositionQuantization Quantization = FRealtimeMeshPositionQuantization::FromBounds(FBox3f(FVector3f(-100.0f, 0.0f, 50.0f), FVector3f(100.0f, 400.0f, 60.0f)));
+	const FVector3f Position(25.0f, 300.0f, 55.0f);
+
+	// Converting gives the position on the quantization grid, the section group's quantization isn't known there
+	{
+		FRealtimeMeshStream Stream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FRealtimeMeshQuantizedPosition>());
+		const FRealtimeMeshQuantizedPosition Quantized = Quantization.Quantize(Position);
+		Stream.Add(Quantized);
+
+		TestTrue(TEXT("Quantized positions should convert to FVector3f"), Stream.ConvertTo<FVector3f>());
+		TestEqual(TEXT("Converted position is on the quantization grid"), *Stream.GetDataAtVertex<FVector3f>(0), FVector3f(Quantized.X, Quantized.Y, Quantized.Z));
+	}
+
+	// Decoding for the GPU applies the quantization
+	{
+		FRealtimeMeshStream Stream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FRealtimeMeshQuantizedPosition>());
+		Stream.Add(Quantization.Quantize(Position));
+
+		TestFalse(TEXT("Quantized positions aren't fetchable"), FRealtimeMeshLocalVertexFactory::CanFetchStreamLayout(Stream.GetStreamKey(), Stream.GetLayout()));
+		TestTrue(TEXT("Quantized positions should decode"), FRealtimeMeshLocalVertexFactory::DecodeStreamForFetch(Stream, Quantization));
+		TestTrue(TEXT("Decoded positions are FVector3f"), Stream.GetLayout() == GetRealtimeMeshBufferLayout<FVector3f>());
+
+		const FVector3f Error = (*Stream.GetDataAtVertex<FVector3f>(0) - Position).GetAbs();
+		const FVector3f MaxError = Quantization.GetMaxError() * 1.01f;
+		TestTrue(TEXT("Decoded position within the quantization error"), Error.X <= MaxError.X && Error.Y <= MaxError.Y && Error.Z <= MaxError.Z);
+	}
+
+	// Compressed tangents decode to the same 8 bytes per vertex
+	{
+		FRealtimeMeshStream Stream(FRealtimeMeshStreams::Tangents, GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsOctahedral>());
+		Stream.Add(FRealtimeMeshTangentsOctahedral(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f)));
+
+		TestTrue(TEXT("Octahedral tangents should decode"), FRealtimeMeshLocalVertexFactory::DecodeStreamForFetch(Stream, Quantization));
+		TestTrue(TEXT("Decoded tangents are packed normals"), Stream.GetLayout() == GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsNormalPrecision>());
+		TestEqual(TEXT("Decoded tangents keep their size"), Stream.GetStride(), static_cast<int32>(sizeof(FRealtimeMeshTangentsOctahedral)));
+
+		const FRealtimeMeshTangentsNormalPrecision& Tangents = *Stream.GetDataAtVertex<FRealtimeMeshTangentsNormalPrecision>(0);
+		TestTrue(TEXT("Decoded normal"), Tangents.GetNormal().Equals(FVector3f(0.0f, 0.0f, 1.0f), 0.02f));
+		TestTrue(TEXT("Decoded tangent"), Tangents.GetTangent().Equals(FVector3f(1.0f, 0.0f, 0.0f), 0.02f));
+	}
+
+	// Fetchable streams are left alone
+	{
+		FRealtimeMeshStream Stream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>());
+		Stream.Add(Position);
+		TestFalse(TEXT("Fetchable stream isn't decoded"), FRealtimeMeshLocalVertexFactory::DecodeStreamForFetch(Stream, Quantization));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCompressedLayoutSizeTest,
+	"RealtimeMeshComponent.DataTypes.CompressedFormats.LayoutSize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCompressedLayoutSizeTest::RunTest(const FString& Parameters)
+{
+	const int32 CompressedBytesPerVertex = sizeof(FRealtimeMeshQuantizedPosition) + sizeof(FRealtimeMeshTangentsOctahedral) + sizeof(FVector2DHalf);
+	const int32 FullBytesPerVertex = sizeof(FVector3f) + sizeof(FRealtimeMeshTangentsHighPrecision) + sizeof(FVector2f);
+
+	TestEqual(TEXT("Compressed layout is 20 bytes per vertex"), CompressedBytesPerVertex, 20);
+	TestTrue(TEXT("Compressed layout is smaller than full precision"), CompressedBytesPerVertex < FullBytesPerVertex);
+
+	TestTrue(TEXT("Quantized position layout is valid"), GetRealtimeMeshBufferLayout<FRealtimeMeshQuantizedPosition>().IsValid());
+	TestTrue(TEXT("Octahedral tangents layout is valid"), GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsOctahedral>().IsValid());
+	TestTrue(TEXT("RGB10A2 tangents layout is valid"), GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsPackedRGB10A2N>().IsValid());
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -7,8 +7,24 @@
 #include "Mesh/RealtimeMeshBasicShapeTools.h"
 #include "Core/RealtimeMeshBuilder.h"
 #include "Data/RealtimeMeshData.h"
+#include "Data/RealtimeMeshCollisionCookScheduler.h"
+#include "Data/RealtimeMeshCollisionDiskCache.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "HAL/PlatformProcess.h"
 #include "Async/Async.h"
+#include "Algo/AllOf.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Components/BoxComponent.h"
+#include "RenderingThread.h"
+#include "RenderProxy/RealtimeMeshProxy.h"
+#include "RenderProxy/RealtimeMeshLODProxy.h"
+#include "RenderProxy/RealtimeMeshSectionGroupProxy.h"
 
 using namespace RealtimeMesh;
 
@@ -797,4 +813,2192 @@ bool FRealtimeMeshStressTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+//==============================================================================
+// Test 9: Stream Copy Benchmark
+// Measures the bytes copied between streams per UpdateSectionGroup with
+// shared (copy on write) stream storage enabled and disabled, and per
+// range edit made while the previous full upload is still pending
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStreamCopyBenchmarkTest,
+	"RealtimeMeshComponent.Functional.StreamCopyBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStreamCopyBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int32 GridSize = 256;
+	const int32 NumUpdates = 8;
+
+	IConsoleVariable* ShareStorageCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.Simple.ShareStreamStorage"));
+	if (!TestNotNull(TEXT("Share stream storage cvar should exist"), ShareStorageCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = ShareStorageCVar->GetInt();
+
+	// Build the source mesh data once
+	FRealtimeMeshStreamSet SourceStreams;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(SourceStreams);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, 0.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + (GridSize + 1);
+				const int32 V3 = V2 + 1;
+
+				Builder.AddTriangle(V0, V2, V1);
+				Builder.AddTriangle(V1, V2, V3);
+			}
+		}
+	}
+
+	uint64 PayloadBytes = 0;
+	SourceStreams.ForEach([&](const FRealtimeMeshStream& Stream)
+	{
+		PayloadBytes += Stream.GetResourceDataSize();
+	});
+
+	auto MeasureBytesCopiedPerUpdate = [&](bool bShareStorage) -> uint64
+	{
+		ShareStorageCVar->Set(bShareStorage ? 1 : 0, ECVF_SetByCode);
+
+		URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+		// Make sure we have a render proxy so the GPU upload path is included
+		Mesh->GetMesh()->GetRenderProxy(true);
+
+		const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+		Mesh->CreateSectionGroup(GroupKey, FRealtimeMeshStreamSet(SourceStreams));
+
+		uint64 TotalBytesCopied = 0;
+		for (int32 Index = 0; Index < NumUpdates; Index++)
+		{
+			// Copy the payload outside the measured section, as a caller building new data would
+			FRealtimeMeshStreamSet Payload(SourceStreams);
+
+			const uint64 BytesCopiedBefore = FRealtimeMeshStream::GetTotalBytesCopied();
+			Mesh->UpdateSectionGroup(GroupKey, MoveTemp(Payload));
+			TotalBytesCopied += FRealtimeMeshStream::GetTotalBytesCopied() - BytesCopiedBefore;
+		}
+
+		Mesh->Reset();
+		return TotalBytesCopied / NumUpdates;
+	};
+
+	// Edits a few rows right after each full update, while the stored streams still share their storage with the pending upload
+	const int32 NumEditedRows = 16;
+	auto MeasureBytesCopiedPerRangeEdit = [&]() -> uint64
+	{
+		ShareStorageCVar->Set(1, ECVF_SetByCode);
+
+		URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+		Mesh->GetMesh()->GetRenderProxy(true);
+
+		const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+		Mesh->CreateSectionGroup(GroupKey, FRealtimeMeshStreamSet(SourceStreams));
+
+		uint64 TotalBytesCopied = 0;
+		for (int32 Index = 0; Index < NumUpdates; Index++)
+		{
+			Mesh->UpdateSectionGroup(GroupKey, FRealtimeMeshStreamSet(SourceStreams));
+
+			const uint64 BytesCopiedBefore = FRealtimeMeshStream::GetTotalBytesCopied();
+			Mesh->EditMeshRangesInPlace(GroupKey, [&](FRealtimeMeshStreamSet& Streams)
+			{
+				FRealtimeMeshStream& Positions = *Streams.Find(FRealtimeMeshStreams::Position);
+				Positions.SetGenerated<FVector3f>(Index * NumEditedRows, NumEditedRows, [Index](int32 Row) { return FVector3f(Row * 100.0f, Index * 100.0f, 10.0f); });
+				return TSet<FRealtimeMeshStreamKey> { FRealtimeMeshStreams::Position };
+			});
+			TotalBytesCopied += FRealtimeMeshStream::GetTotalBytesCopied() - BytesCopiedBefore;
+		}
+
+		Mesh->Reset();
+		return TotalBytesCopied / NumUpdates;
+	};
+
+	const uint64 CopiedBytesLegacy = MeasureBytesCopiedPerUpdate(false);
+	const uint64 CopiedBytesShared = MeasureBytesCopiedPerUpdate(true);
+	const uint64 CopiedBytesRangeEdit = MeasureBytesCopiedPerRangeEdit();
+	const uint64 PositionBytes = SourceStreams.Find(FRealtimeMeshStreams::Position)->GetResourceDataSize();
+
+	ShareStorageCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+
+	AddInfo(FString::Printf(TEXT("Payload: %.2f MB per update (%d vertices)"), PayloadBytes / (1024.0 * 1024.0), (GridSize + 1) * (GridSize + 1)));
+	AddInfo(FString::Printf(TEXT("Bytes copied per UpdateSectionGroup: %.2f MB copying, %.2f MB shared"),
+		CopiedBytesLegacy / (1024.0 * 1024.0), CopiedBytesShared / (1024.0 * 1024.0)));
+	AddInfo(FString::Printf(TEXT("Bytes copied per %d row range edit after an update: %.2f KB (position stream %.2f KB)"),
+		NumEditedRows, CopiedBytesRangeEdit / 1024.0, PositionBytes / 1024.0));
+
+	TestTrue(TEXT("Copying storage should copy the payload at least once"), CopiedBytesLegacy >= PayloadBytes);
+	TestTrue(TEXT("Shared storage should copy less than a single payload"), CopiedBytesShared < PayloadBytes);
+	TestTrue(TEXT("Range edits should not copy the whole edited stream"), CopiedBytesRangeEdit < PositionBytes);
+
+	return true;
+}
+
+//==============================================================================
+// Test 10: Partial Stream Updates
+// Tests writing sub-ranges of existing streams without replacing them
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshPartialStreamUpdateTest,
+	"RealtimeMeshComponent.Functional.PartialStreamUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshPartialStreamUpdateTest::RunTest(const FString& Parameters)
+{
+	const int32 GridSize = 4;
+	const int32 NumVertices = (GridSize + 1) * (GridSize + 1);
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	// Make sure we have a render proxy so the range upload path is included
+	Mesh->GetMesh()->GetRenderProxy(true);
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, 0.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + (GridSize + 1);
+				const int32 V3 = V2 + 1;
+
+				Builder.AddTriangle(V0, V2, V1);
+				Builder.AddTriangle(V1, V2, V3);
+			}
+		}
+	}
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+	Mesh->CreateSectionGroup(GroupKey, MoveTemp(StreamSet));
+
+	auto GetPosition = [&](int32 Index)
+	{
+		FVector3f Result;
+		Mesh->ProcessMesh(GroupKey, [&](const FRealtimeMeshStreamSet& Streams)
+		{
+			Result = *Streams.Find(FRealtimeMeshStreams::Position)->GetDataAtVertex<FVector3f>(Index);
+		});
+		return Result;
+	};
+
+	auto GetNumPositions = [&]()
+	{
+		int32 Result = 0;
+		Mesh->ProcessMesh(GroupKey, [&](const FRealtimeMeshStreamSet& Streams)
+		{
+			Result = Streams.Find(FRealtimeMeshStreams::Position)->Num();
+		});
+		return Result;
+	};
+
+	// Update a sub-range directly, in a different layout than the stored stream
+	{
+		FRealtimeMeshStream RangeData(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3d>());
+		RangeData.Add(FVector3d(100.0, 0.0, 50.0));
+		RangeData.Add(FVector3d(200.0, 0.0, 50.0));
+
+		Mesh->UpdateSectionGroupStreamRange(GroupKey, MoveTemp(RangeData), 1);
+
+		TestEqual(TEXT("Range update should not change the stream size"), GetNumPositions(), NumVertices);
+		TestEqual(TEXT("Row before range should be untouched"), GetPosition(0), FVector3f(0.0f, 0.0f, 0.0f));
+		TestEqual(TEXT("First updated row"), GetPosition(1), FVector3f(100.0f, 0.0f, 50.0f));
+		TestEqual(TEXT("Second updated row"), GetPosition(2), FVector3f(200.0f, 0.0f, 50.0f));
+		TestEqual(TEXT("Row after range should be untouched"), GetPosition(3), FVector3f(300.0f, 0.0f, 0.0f));
+	}
+
+	// Edit in place, only the dirty range is sent
+	{
+		Mesh->EditMeshRangesInPlace(GroupKey, [&](FRealtimeMeshStreamSet& Streams)
+		{
+			FRealtimeMeshStream& Positions = *Streams.Find(FRealtimeMeshStreams::Position);
+			Positions.SetGenerated<FVector3f>(NumVertices - 2, 2, [](int32 Index) { return FVector3f(0.0f, 0.0f, 25.0f); });
+			return TSet<FRealtimeMeshStreamKey> { FRealtimeMeshStreams::Position };
+		});
+
+		TestEqual(TEXT("Edited range should keep the stream size"), GetNumPositions(), NumVertices);
+		TestEqual(TEXT("Edited row"), GetPosition(NumVertices - 1), FVector3f(0.0f, 0.0f, 25.0f));
+		TestEqual(TEXT("Earlier range update should persist"), GetPosition(1), FVector3f(100.0f, 0.0f, 50.0f));
+	}
+
+	// Ranges outside the existing stream are rejected
+	{
+		AddExpectedError(TEXT("Unable to update range"), EAutomationExpectedErrorFlags::Contains, 0);
+
+		FRealtimeMeshStream RangeData(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>());
+		RangeData.Add(FVector3f(1.0f, 1.0f, 1.0f));
+		RangeData.Add(FVector3f(1.0f, 1.0f, 1.0f));
+
+		Mesh->UpdateSectionGroupStreamRange(GroupKey, MoveTemp(RangeData), NumVertices - 1);
+
+		TestEqual(TEXT("Rejected range should not change the stream size"), GetNumPositions(), NumVertices);
+		TestEqual(TEXT("Rejected range should not write any rows"), GetPosition(NumVertices - 1), FVector3f(0.0f, 0.0f, 25.0f));
+	}
+
+	// Editing polygroups in place moves the polygroup sections with them
+	{
+		FRealtimeMeshStreamSet BoxStreams;
+		{
+			TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(BoxStreams);
+			Builder.EnablePolyGroups();
+		}
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(BoxStreams, FVector3f(50.0f, 50.0f, 50.0f), FTransform3f::Identity, 0);
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(BoxStreams, FVector3f(50.0f, 50.0f, 50.0f), FTransform3f(FVector3f(300.0f, 0.0f, 0.0f)), 1);
+		const int32 NumTriangles = BoxStreams.Find(FRealtimeMeshStreams::Triangles)->Num();
+
+		const FRealtimeMeshSectionGroupKey BoxGroupKey = FRealtimeMeshSectionGroupKey::Create(0, FName("Boxes"));
+		Mesh->CreateSectionGroup(BoxGroupKey, MoveTemp(BoxStreams));
+
+		const FRealtimeMeshSectionKey FirstBoxSection = FRealtimeMeshSectionKey::CreateForPolyGroup(BoxGroupKey, 0);
+		const FRealtimeMeshSectionKey SecondBoxSection = FRealtimeMeshSectionKey::CreateForPolyGroup(BoxGroupKey, 1);
+		const FRealtimeMeshSectionKey MovedBoxSection = FRealtimeMeshSectionKey::CreateForPolyGroup(BoxGroupKey, 2);
+		TestTrue(TEXT("Each polygroup should start with its own section"),
+			Mesh->GetSectionsInGroup(BoxGroupKey).Contains(FirstBoxSection) && Mesh->GetSectionsInGroup(BoxGroupKey).Contains(SecondBoxSection));
+
+		// Same size and layout, so this goes through the range path
+		Mesh->EditMeshRangesInPlace(BoxGroupKey, [&](FRealtimeMeshStreamSet& Streams)
+		{
+			FRealtimeMeshStream& PolyGroups = *Streams.Find(FRealtimeMeshStreams::PolyGroups);
+			PolyGroups.SetGenerated<uint16>(NumTriangles / 2, NumTriangles / 2, [](int32 Index) { return uint16(2); });
+			return TSet<FRealtimeMeshStreamKey> { FRealtimeMeshStreams::PolyGroups };
+		});
+
+		const TArray<FRealtimeMeshSectionKey> Sections = Mesh->GetSectionsInGroup(BoxGroupKey);
+		TestTrue(TEXT("Untouched polygroup should keep its section"), Sections.Contains(FirstBoxSection));
+		TestFalse(TEXT("Emptied polygroup should lose its section"), Sections.Contains(SecondBoxSection));
+		TestTrue(TEXT("New polygroup should get a section"), Sections.Contains(MovedBoxSection));
+	}
+
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 11: Collision Cook Cache
+// Counts complex collision cooks per edit, only changed section groups
+// should be cooked again
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionCookCacheTest,
+	"RealtimeMeshComponent.Functional.CollisionCookCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionCookCacheTest::RunTest(const FString& Parameters)
+{
+	const int32 NumGroups = 8;
+
+	IConsoleVariable* CacheCooksCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.Collision.CacheSectionGroupCooks"));
+	if (!TestNotNull(TEXT("Cache section group cooks cvar should exist"), CacheCooksCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = CacheCooksCVar->GetInt();
+	CacheCooksCVar->Set(1, ECVF_SetByCode);
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	auto MakeBox = [](int32 Index, float ZOffset)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(50.0f, 50.0f, 50.0f),
+			FTransform3f(FVector3f(Index * 200.0f, 0.0f, ZOffset)));
+		return StreamSet;
+	};
+
+	for (int32 Index = 0; Index < NumGroups; Index++)
+	{
+		const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, Index);
+		Mesh->CreateSectionGroup(GroupKey, MakeBox(Index, 0.0f));
+		Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0), FRealtimeMeshSectionConfig(0), true);
+	}
+
+	// Generates the complex collision like an end of frame collision update, returning the number of cooks it took
+	int32 NumMeshes = 0;
+	int32 NumMeshesWithGeometry = 0;
+	auto GenerateAndCountCooks = [&]() -> int32
+	{
+		const uint64 CooksBefore = URealtimeMeshCollisionTools::GetNumComplexMeshCooks();
+
+		FRealtimeMeshComplexGeometry ComplexGeometry;
+		FRealtimeMeshAccessContext AccessContext(Mesh->GetMeshData());
+		Mesh->GetMeshData()->GenerateComplexCollision(AccessContext, ComplexGeometry);
+
+		NumMeshes = ComplexGeometry.NumMeshes();
+		NumMeshesWithGeometry = 0;
+		for (int32 Index = 0; Index < NumMeshes; Index++)
+		{
+			NumMeshesWithGeometry += ComplexGeometry.GetByIndex(Index).GetVertices().Num() > 0 ? 1 : 0;
+		}
+		TestTrue(TEXT("Every generated mesh should be cooked"), ComplexGeometry.GetMeshIDsNeedingCook().IsEmpty());
+		
+		return static_cast<int32>(URealtimeMeshCollisionTools::GetNumComplexMeshCooks() - CooksBefore);
+	};
+
+	TestEqual(TEXT("Initial update should cook every group"), GenerateAndCountCooks(), NumGroups);
+	TestEqual(TEXT("Initial update should produce a mesh per group"), NumMeshes, NumGroups);
+
+	TestEqual(TEXT("Unchanged mesh should not cook"), GenerateAndCountCooks(), 0);
+	TestEqual(TEXT("Unchanged mesh should still produce a mesh per group"), NumMeshes, NumGroups);
+	TestEqual(TEXT("Cached groups should only hand back their cook, not a copy of their geometry"), NumMeshesWithGeometry, 0);
+
+	// Move a single group
+	Mesh->UpdateSectionGroup(FRealtimeMeshSectionGroupKey::Create(0, 3), MakeBox(3, 100.0f));
+	TestEqual(TEXT("Editing one group should cook only that group"), GenerateAndCountCooks(), 1);
+	TestEqual(TEXT("Edited mesh should still produce a mesh per group"), NumMeshes, NumGroups);
+	TestTrue(TEXT("Only the edited group should carry geometry"), NumMeshesWithGeometry <= 1);
+
+	// Turn off collision for a single group
+	Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(FRealtimeMeshSectionGroupKey::Create(0, 5), 0), FRealtimeMeshSectionConfig(0), false);
+	TestEqual(TEXT("Removing collision from a group should not cook"), GenerateAndCountCooks(), 0);
+	TestEqual(TEXT("Group without collision should not produce a mesh"), NumMeshes, NumGroups - 1);
+
+	// Without the cache every group is cooked every time
+	CacheCooksCVar->Set(0, ECVF_SetByCode);
+	TestEqual(TEXT("Uncached update should cook every group with collision"), GenerateAndCountCooks(), NumGroups - 1);
+	
+	CacheCooksCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 12: Collision Source Selection
+// Complex collision should come from the configured LOD, or from the
+// collision only streams of a section group when they are set
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionSourceSelectionTest,
+	"RealtimeMeshComponent.Functional.CollisionSourceSelection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionSourceSelectionTest::RunTest(const FString& Parameters)
+{
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	auto MakeBoxes = [](int32 NumBoxes)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		for (int32 Index = 0; Index < NumBoxes; Index++)
+		{
+			URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(50.0f, 50.0f, 50.0f),
+				FTransform3f(FVector3f(Index * 200.0f, 0.0f, 0.0f)));
+		}
+		return StreamSet;
+	};
+
+	// LOD0 has 4 boxes, LOD1 has 1
+	const FRealtimeMeshLODKey LOD1Key = Mesh->AddLOD(FRealtimeMeshLODConfig());
+	const FRealtimeMeshSectionGroupKey LOD0GroupKey = FRealtimeMeshSectionGroupKey::Create(0, FName("Group"));
+	const FRealtimeMeshSectionGroupKey LOD1GroupKey = FRealtimeMeshSectionGroupKey::Create(LOD1Key, FName("Group"));
+	Mesh->CreateSectionGroup(LOD0GroupKey, MakeBoxes(4));
+	Mesh->CreateSectionGroup(LOD1GroupKey, MakeBoxes(1));
+	Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(LOD0GroupKey, 0), FRealtimeMeshSectionConfig(0), true);
+	Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(LOD1GroupKey, 0), FRealtimeMeshSectionConfig(0), true);
+
+	auto CountCollisionTriangles = [&]() -> int32
+	{
+		FRealtimeMeshComplexGeometry ComplexGeometry;
+		FRealtimeMeshAccessContext AccessContext(Mesh->GetMeshData());
+		Mesh->GetMeshData()->GenerateComplexCollision(AccessContext, ComplexGeometry);
+
+		int32 NumTriangles = 0;
+		for (int32 Index = 0; Index < ComplexGeometry.NumMeshes(); Index++)
+		{
+			NumTriangles += ComplexGeometry.GetByIndex(Index).GetTriangles().Num();
+		}
+		return NumTriangles;
+	};
+
+	TestEqual(TEXT("Collision should default to LOD0"), CountCollisionTriangles(), 4 * 12);
+
+	FRealtimeMeshCollisionConfiguration CollisionConfig = Mesh->GetCollisionConfig();
+	CollisionConfig.ComplexCollisionLOD = 1;
+	Mesh->SetCollisionConfig(CollisionConfig);
+	TestEqual(TEXT("Collision should come from the selected LOD"), CountCollisionTriangles(), 12);
+
+	CollisionConfig.ComplexCollisionLOD = 5;
+	Mesh->SetCollisionConfig(CollisionConfig);
+	TestEqual(TEXT("Out of range collision LOD should clamp to the last LOD"), CountCollisionTriangles(), 12);
+
+	// Collision only streams override the render streams of that group
+	CollisionConfig.ComplexCollisionLOD = 0;
+	Mesh->SetCollisionConfig(CollisionConfig);
+	Mesh->SetSectionGroupCollisionStreams(LOD0GroupKey, MakeBoxes(2));
+	TestEqual(TEXT("Collision streams should replace the render streams"), CountCollisionTriangles(), 2 * 12);
+
+	Mesh->ClearSectionGroupCollisionStreams(LOD0GroupKey);
+	TestEqual(TEXT("Clearing collision streams should restore the render streams"), CountCollisionTriangles(), 4 * 12);
+
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 13: Collision Cook Scheduler
+// Edits a mesh with async collision in a loop, every cook but the one for the
+// last edit should be coalesced or abandoned before its collision is applied
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionCookSchedulerTest,
+	"RealtimeMeshComponent.Functional.CollisionCookScheduler",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionCookSchedulerTest::RunTest(const FString& Parameters)
+{
+	const int32 NumGroups = 4;
+	const int32 GridSize = 32;
+	const int32 NumEdits = 20;
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	FRealtimeMeshCollisionConfiguration CollisionConfig;
+	CollisionConfig.bUseAsyncCook = true;
+	Mesh->SetCollisionConfig(CollisionConfig);
+
+	auto MakeGrid = [GridSize](int32 GroupIndex, float Height)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(GroupIndex * GridSize * 100.0f + X * 100.0f, Y * 100.0f, Height + FMath::Sin(X * 0.5f) * 20.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				Builder.AddTriangle(V0, V0 + (GridSize + 1), V0 + 1);
+				Builder.AddTriangle(V0 + 1, V0 + (GridSize + 1), V0 + GridSize + 2);
+			}
+		}
+		return StreamSet;
+	};
+
+	for (int32 Index = 0; Index < NumGroups; Index++)
+	{
+		const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, Index);
+		Mesh->CreateSectionGroup(GroupKey, MakeGrid(Index, 0.0f));
+		Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0), FRealtimeMeshSectionConfig(0), true);
+	}
+
+	int32 NumBodyUpdates = 0;
+	const FDelegateHandle BodyUpdatedHandle = Mesh->OnCollisionBodyUpdated().AddLambda([&NumBodyUpdates](URealtimeMesh*, UBodySetup*)
+	{
+		NumBodyUpdates++;
+	});
+
+	// Cooks finish on the cook workers, their collision is only applied once the game thread gets to it
+	auto PumpGameThreadUntil = [](TFunctionRef<bool()> Condition)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		while (!Condition() && (FPlatformTime::Seconds() - StartTime) < 10.0)
+		{
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return Condition();
+	};
+
+	auto IsSchedulerIdle = []()
+	{
+		const FRealtimeMeshCollisionCookStats Stats = FRealtimeMeshCollisionCookScheduler::Get().GetStats();
+		return Stats.NumInFlight == 0 && Stats.QueueDepth == 0;
+	};
+
+	Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+	TestTrue(TEXT("Initial collision should be applied"), PumpGameThreadUntil([&]() { return NumBodyUpdates == 1 && IsSchedulerIdle(); }));
+
+	const FRealtimeMeshCollisionCookStats StatsBefore = FRealtimeMeshCollisionCookScheduler::Get().GetStats();
+	const int32 BodyUpdatesBefore = NumBodyUpdates;
+
+	// The game thread isn't pumped while editing, so every cook that finishes is left waiting to be applied when the next edit supersedes it
+	for (int32 Edit = 1; Edit <= NumEdits; Edit++)
+	{
+		for (int32 Index = 0; Index < NumGroups; Index++)
+		{
+			Mesh->UpdateSectionGroup(FRealtimeMeshSectionGroupKey::Create(0, Index), MakeGrid(Index, Edit * 10.0f));
+		}
+		Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+		FPlatformProcess::Sleep(0.002f);
+	}
+
+	TestTrue(TEXT("Every cook should finish"), PumpGameThreadUntil(IsSchedulerIdle));
+
+	const FRealtimeMeshCollisionCookStats StatsAfter = FRealtimeMeshCollisionCookScheduler::Get().GetStats();
+	TestEqual(TEXT("Every edit should schedule a cook"), StatsAfter.NumScheduled - StatsBefore.NumScheduled, static_cast<uint64>(NumEdits));
+	TestTrue(TEXT("The cook that was running when the next edit came in should be cancelled"), StatsAfter.NumCancelled > StatsBefore.NumCancelled);
+	TestEqual(TEXT("Every edit but the last should be coalesced or abandoned"),
+		(StatsAfter.NumCoalesced - StatsBefore.NumCoalesced) + (StatsAfter.NumCancelled - StatsBefore.NumCancelled), static_cast<uint64>(NumEdits - 1));
+	TestEqual(TEXT("Only the cook of the last edit should complete"), StatsAfter.NumCompleted - StatsBefore.NumCompleted, static_cast<uint64>(1));
+	TestEqual(TEXT("Only the collision of the last edit should be applied"), NumBodyUpdates - BodyUpdatesBefore, 1);
+
+	// Resetting the mesh drops the cook of its old geometry before it gets applied
+	{
+		const FRealtimeMeshCollisionCookStats StatsBeforeReset = FRealtimeMeshCollisionCookScheduler::Get().GetStats();
+
+		Mesh->UpdateSectionGroup(FRealtimeMeshSectionGroupKey::Create(0, 0), MakeGrid(0, -50.0f));
+		Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+		Mesh->OnCollisionBodyUpdated().Remove(BodyUpdatedHandle);
+		Mesh->Reset();
+
+		TestTrue(TEXT("Scheduler should be idle after the reset"), PumpGameThreadUntil(IsSchedulerIdle));
+
+		const FRealtimeMeshCollisionCookStats StatsAfterReset = FRealtimeMeshCollisionCookScheduler::Get().GetStats();
+		TestEqual(TEXT("The cook of the reset mesh should not complete"), StatsAfterReset.NumCompleted, StatsBeforeReset.NumCompleted);
+	}
+
+	return true;
+}
+
+//==============================================================================
+// Test 14: Collision Disk Cache
+// Cooked collision should round trip through the disk cache, corrupt entries
+// should be rejected and the cache should stay within its size limit
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionDiskCacheTest,
+	"RealtimeMeshComponent.Functional.CollisionDiskCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionDiskCacheTest::RunTest(const FString& Parameters)
+{
+	const FString CacheDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RealtimeMeshCollisionDiskCache"));
+	IFileManager::Get().DeleteDirectory(*CacheDirectory, false, true);
+
+	auto MakeCookedBox = [](float Size)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(Size, Size, Size));
+
+		FRealtimeMeshCollisionMesh CollisionMesh;
+		URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(CollisionMesh, StreamSet, 0);
+		URealtimeMeshCollisionTools::CookComplexMesh(CollisionMesh);
+		return CollisionMesh;
+	};
+
+	const FRealtimeMeshCollisionMesh BoxMesh = MakeCookedBox(50.0f);
+	const uint64 BoxKey = URealtimeMeshCollisionTools::GetComplexMeshCookHash(BoxMesh);
+	TestNotEqual(TEXT("Different geometry should hash differently"), BoxKey, URealtimeMeshCollisionTools::GetComplexMeshCookHash(MakeCookedBox(60.0f)));
+	if (!TestTrue(TEXT("Box should cook"), BoxMesh.HasCookedMesh()))
+	{
+		return false;
+	}
+
+	{
+		FRealtimeMeshCollisionDiskCache Cache(CacheDirectory, 1024 * 1024);
+
+		// Miss
+		TSharedPtr<FRealtimeMeshCookedTriMeshData> Loaded;
+		TestFalse(TEXT("Empty cache should miss"), Cache.TryLoad(BoxKey, Loaded));
+
+		// Hit
+		Cache.Store(BoxKey, *BoxMesh.GetCooked());
+		TestTrue(TEXT("Stored entry should exist on disk"), IFileManager::Get().FileExists(*Cache.GetEntryPath(BoxKey)));
+		if (TestTrue(TEXT("Stored entry should hit"), Cache.TryLoad(BoxKey, Loaded)) && TestTrue(TEXT("Hit should return data"), Loaded.IsValid()))
+		{
+			TestTrue(TEXT("Loaded entry should have a trimesh"), Loaded->HasMesh());
+			TestEqual(TEXT("Loaded face remap should match the cook"), Loaded->GetFaceRemap(), BoxMesh.GetCooked()->GetFaceRemap());
+			TestEqual(TEXT("Loaded trimesh should have the cooked triangle count"),
+				Loaded->GetMesh()->Elements().GetNumTriangles(), BoxMesh.GetCooked()->GetMesh()->Elements().GetNumTriangles());
+		}
+		TestFalse(TEXT("Other keys should miss"), Cache.TryLoad(BoxKey + 1, Loaded));
+
+		// Corruption
+		TArray<uint8> FileData;
+		FFileHelper::LoadFileToArray(FileData, *Cache.GetEntryPath(BoxKey));
+		FileData.Last() ^= 0xFF;
+		FFileHelper::SaveArrayToFile(FileData, *Cache.GetEntryPath(BoxKey));
+		TestFalse(TEXT("Corrupt entry should miss"), Cache.TryLoad(BoxKey, Loaded));
+		TestFalse(TEXT("Corrupt entry should be deleted"), IFileManager::Get().FileExists(*Cache.GetEntryPath(BoxKey)));
+
+		// Truncation
+		Cache.Store(BoxKey, *BoxMesh.GetCooked());
+		FFileHelper::LoadFileToArray(FileData, *Cache.GetEntryPath(BoxKey));
+		FileData.SetNum(FileData.Num() / 2);
+		FFileHelper::SaveArrayToFile(FileData, *Cache.GetEntryPath(BoxKey));
+		TestFalse(TEXT("Truncated entry should miss"), Cache.TryLoad(BoxKey, Loaded));
+
+		const FRealtimeMeshCollisionDiskCacheStats Stats = Cache.GetStats();
+		TestEqual(TEXT("Hits should be counted"), Stats.Hits, 1ull);
+		TestEqual(TEXT("Misses should be counted"), Stats.Misses, 4ull);
+		TestEqual(TEXT("Corrupt entries should be counted"), Stats.Corrupt, 2ull);
+	}
+
+	// Eviction
+	{
+		FRealtimeMeshCollisionDiskCache Cache(CacheDirectory, 0);
+		FRealtimeMeshCollisionMesh OtherMesh = MakeCookedBox(70.0f);
+		const uint64 OtherKey = URealtimeMeshCollisionTools::GetComplexMeshCookHash(OtherMesh);
+		Cache.Store(OtherKey, *OtherMesh.GetCooked());
+		TestFalse(TEXT("Entries past the size limit should be evicted"), IFileManager::Get().FileExists(*Cache.GetEntryPath(OtherKey)));
+		TestTrue(TEXT("Evictions should be counted"), Cache.GetStats().Evictions > 0);
+	}
+
+	IFileManager::Get().DeleteDirectory(*CacheDirectory, false, true);
+	return true;
+}
+
+//==============================================================================
+// Test 15: Cook Complex Collision From Streams
+// Cooking straight from the streams should produce the same trimesh as going
+// through an intermediate collision mesh, without keeping a copy of the geometry
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionCookFromStreamsTest,
+	"RealtimeMeshComponent.Functional.CollisionCookFromStreams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionCookFromStreamsTest::RunTest(const FString& Parameters)
+{
+	const int32 GridSize = 256;
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, FMath::Sin(X * 0.1f) * 50.0f));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + (GridSize + 1);
+				const int32 V3 = V2 + 1;
+
+				Builder.AddTriangle(V0, V2, V1);
+				Builder.AddTriangle(V1, V2, V3);
+			}
+		}
+	}
+
+	// Through the intermediate collision mesh
+	double StartTime = FPlatformTime::Seconds();
+	FRealtimeMeshCollisionMesh IntermediateMesh;
+	URealtimeMeshCollisionTools::AppendStreamsToCollisionMesh(IntermediateMesh, StreamSet, 0);
+	const SIZE_T IntermediateBytes = IntermediateMesh.GetVertices().GetAllocatedSize() + IntermediateMesh.GetTriangles().GetAllocatedSize() +
+		IntermediateMesh.GetMaterials().GetAllocatedSize();
+	URealtimeMeshCollisionTools::CookComplexMesh(IntermediateMesh);
+	const double IntermediateSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Straight from the streams
+	StartTime = FPlatformTime::Seconds();
+	FRealtimeMeshCollisionMesh StreamMesh;
+	const bool bCookedFromStreams = URealtimeMeshCollisionTools::CookComplexMeshFromStreams(StreamMesh, StreamSet, 0);
+	const double StreamSeconds = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue(TEXT("Intermediate mesh should cook"), IntermediateMesh.HasCookedMesh()) ||
+		!TestTrue(TEXT("Streams should cook"), bCookedFromStreams && StreamMesh.HasCookedMesh()))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Both paths should cook the same number of triangles"),
+		StreamMesh.GetCooked()->GetMesh()->Elements().GetNumTriangles(), IntermediateMesh.GetCooked()->GetMesh()->Elements().GetNumTriangles());
+	TestEqual(TEXT("Both paths should produce the same face remap"), StreamMesh.GetCooked()->GetFaceRemap(), IntermediateMesh.GetCooked()->GetFaceRemap());
+	TestEqual(TEXT("Cooking from streams shouldn't keep vertices"), StreamMesh.GetVertices().Num(), 0);
+	TestEqual(TEXT("Cooking from streams shouldn't keep triangles"), StreamMesh.GetTriangles().Num(), 0);
+
+	// Incomplete streams should be rejected without producing anything
+	FRealtimeMeshStreamSet PositionsOnly;
+	PositionsOnly.AddStream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>());
+	FRealtimeMeshCollisionMesh EmptyMesh;
+	TestFalse(TEXT("Streams without triangles shouldn't cook"), URealtimeMeshCollisionTools::CookComplexMeshFromStreams(EmptyMesh, PositionsOnly, 0));
+	TestFalse(TEXT("Rejected streams shouldn't leave a cooked mesh"), EmptyMesh.HasCookedMesh());
+
+	AddInfo(FString::Printf(TEXT("%d triangles: %.2f ms through the collision mesh (%.2f MB intermediate), %.2f ms from streams"),
+		GridSize * GridSize * 2, IntermediateSeconds * 1000.0, IntermediateBytes / (1024.0 * 1024.0), StreamSeconds * 1000.0));
+
+	return true;
+}
+
+//==============================================================================
+// Test 16: Complex Collision Cleaning
+// Cleaning should weld split vertices, drop the triangles that collapse, and
+// keep face indices pointing at the source triangles
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionCleanTest,
+	"RealtimeMeshComponent.Functional.CollisionClean",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionCleanTest::RunTest(const FString& Parameters)
+{
+	const int32 GridSize = 32;
+	const float WeldTolerance = 0.01f;
+
+	// Every quad has its own vertices, like a mesh with hard edges or per face UVs
+	TArray<FVector3f> Vertices;
+	TArray<RealtimeMesh::TIndex3<int32>> Triangles;
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			const int32 V0 = Vertices.Add(FVector3f(X * 100.0f, Y * 100.0f, 0.0f));
+			const int32 V1 = Vertices.Add(FVector3f((X + 1) * 100.0f, Y * 100.0f, 0.0f));
+			const int32 V2 = Vertices.Add(FVector3f(X * 100.0f, (Y + 1) * 100.0f, 0.0f));
+			const int32 V3 = Vertices.Add(FVector3f((X + 1) * 100.0f, (Y + 1) * 100.0f, 0.0f));
+			Triangles.Add(RealtimeMesh::TIndex3<int32>(V0, V2, V1));
+			Triangles.Add(RealtimeMesh::TIndex3<int32>(V1, V2, V3));
+		}
+	}
+
+	// A sliver whose short edge is within the weld tolerance
+	const int32 SliverTriangle = Triangles.Num();
+	const int32 SliverA = Vertices.Add(FVector3f(0.0f, 0.0f, 50.0f));
+	const int32 SliverB = Vertices.Add(FVector3f(WeldTolerance * 0.5f, 0.0f, 50.0f));
+	const int32 SliverC = Vertices.Add(FVector3f(0.0f, 100.0f, 50.0f));
+	Triangles.Add(RealtimeMesh::TIndex3<int32>(SliverA, SliverC, SliverB));
+
+	FRealtimeMeshCollisionMesh RawMesh;
+	RawMesh.SetVertices(Vertices);
+	RawMesh.SetTriangles(Triangles);
+
+	FRealtimeMeshCollisionMesh CleanMesh = RawMesh;
+	CleanMesh.SetCleanSettings(true, WeldTolerance);
+	TestNotEqual(TEXT("Clean settings should change the cook hash"),
+		URealtimeMeshCollisionTools::GetComplexMeshCookHash(CleanMesh), URealtimeMeshCollisionTools::GetComplexMeshCookHash(RawMesh));
+
+	URealtimeMeshCollisionTools::CookComplexMesh(RawMesh);
+	URealtimeMeshCollisionTools::CookComplexMesh(CleanMesh);
+	if (!TestTrue(TEXT("Both meshes should cook"), RawMesh.HasCookedMesh() && CleanMesh.HasCookedMesh()))
+	{
+		return false;
+	}
+
+	const auto& RawTriMesh = RawMesh.GetCooked()->GetMesh();
+	const auto& CleanTriMesh = CleanMesh.GetCooked()->GetMesh();
+	TestEqual(TEXT("Raw cook should keep every vertex"), static_cast<int32>(RawTriMesh->Particles().Size()), Vertices.Num());
+	TestEqual(TEXT("Clean cook should weld the split vertices"), static_cast<int32>(CleanTriMesh->Particles().Size()), (GridSize + 1) * (GridSize + 1) + 2);
+	TestEqual(TEXT("Clean cook should drop the collapsed sliver"), CleanTriMesh->Elements().GetNumTriangles(), GridSize * GridSize * 2);
+	TestTrue(TEXT("Raw cook should keep the sliver"), RawTriMesh->Elements().GetNumTriangles() > CleanTriMesh->Elements().GetNumTriangles());
+
+	// Face indices must keep resolving to the source triangles so UV lookups from hit results still work
+	const TArray<int32>& FaceRemap = CleanMesh.GetCooked()->GetFaceRemap();
+	TestEqual(TEXT("Face remap should cover every cooked triangle"), FaceRemap.Num(), CleanTriMesh->Elements().GetNumTriangles());
+	TestFalse(TEXT("Face remap shouldn't reference the dropped sliver"), FaceRemap.Contains(SliverTriangle));
+	TestTrue(TEXT("Face remap should only reference source triangles"), Algo::AllOf(FaceRemap, [&](int32 Face) { return Triangles.IsValidIndex(Face); }));
+
+	return true;
+}
+
+//==============================================================================
+// Test 17: Convex Decomposition
+// Two separate boxes should decompose into one hull each within the vertex
+// budget, and a polygroup should decompose on its own
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshConvexDecompositionTest,
+	"RealtimeMeshComponent.Functional.ConvexDecomposition",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshConvexDecompositionTest::RunTest(const FString& Parameters)
+{
+	const FVector3f BoxRadius(50.0f, 50.0f, 50.0f);
+
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnablePolyGroups();
+	}
+	URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, BoxRadius, FTransform3f::Identity, 0);
+	URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, BoxRadius, FTransform3f(FVector3f(300.0f, 0.0f, 0.0f)), 1);
+
+	FRealtimeMeshConvexDecompositionSettings Settings;
+	Settings.MaxHulls = 4;
+	Settings.MaxVerticesPerHull = 8;
+
+	FRealtimeMeshSimpleGeometry Decomposition = URealtimeMeshCollisionTools::ComputeConvexDecomposition(StreamSet, Settings).Get();
+	if (!TestEqual(TEXT("Two separate boxes should produce two hulls"), Decomposition.ConvexHulls.Num(), 2))
+	{
+		return false;
+	}
+
+	bool bFoundFirstBox = false;
+	bool bFoundSecondBox = false;
+	for (const FRealtimeMeshCollisionConvex& Hull : Decomposition.ConvexHulls)
+	{
+		TestTrue(TEXT("Hull should respect the vertex budget"), Hull.GetVertices().Num() <= Settings.MaxVerticesPerHull);
+		TestTrue(TEXT("Hull should be cooked"), Hull.HasCookedMesh());
+
+		const FBox HullBounds(Hull.GetVertices());
+		bFoundFirstBox |= HullBounds.Equals(FBox(FVector(-50.0), FVector(50.0)), 0.01);
+		bFoundSecondBox |= HullBounds.Equals(FBox(FVector(250.0, -50.0, -50.0), FVector(350.0, 50.0, 50.0)), 0.01);
+	}
+	TestTrue(TEXT("One hull should enclose exactly the first box"), bFoundFirstBox);
+	TestTrue(TEXT("One hull should enclose exactly the second box"), bFoundSecondBox);
+
+	// A tighter budget still has to keep the corners that define the box
+	Settings.MaxVerticesPerHull = 4;
+	Settings.PolyGroup = 1;
+	Settings.bCookHulls = false;
+	FRealtimeMeshSimpleGeometry PolyGroupDecomposition = URealtimeMeshCollisionTools::ComputeConvexDecomposition(StreamSet, Settings).Get();
+	if (TestEqual(TEXT("Polygroup should produce a single hull"), PolyGroupDecomposition.ConvexHulls.Num(), 1))
+	{
+		for (const FRealtimeMeshCollisionConvex& Hull : PolyGroupDecomposition.ConvexHulls)
+		{
+			TestEqual(TEXT("Hull should be reduced to the vertex budget"), Hull.GetVertices().Num(), 4);
+			TestTrue(TEXT("Hull should only cover the polygroup"), Algo::AllOf(Hull.GetVertices(), [](const FVector& Vertex) { return Vertex.X >= 250.0 - 0.01; }));
+			TestFalse(TEXT("Hull shouldn't be cooked when cooking is disabled"), Hull.HasCookedMesh());
+		}
+	}
+
+	// Incomplete streams should resolve right away with nothing
+	FRealtimeMeshStreamSet PositionsOnly;
+	PositionsOnly.AddStream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>());
+	TestEqual(TEXT("Streams without triangles shouldn't produce hulls"),
+		URealtimeMeshCollisionTools::ComputeConvexDecomposition(PositionsOnly, Settings).Get().ConvexHulls.Num(), 0);
+
+	return true;
+}
+
+//==============================================================================
+// Test 18: Fit Simple Collision
+// Boxes, spheres and capsules should be recovered from their own surfaces with
+// a near perfect fit quality, and flat pieces should be left to complex collision
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshFitSimpleCollisionTest,
+	"RealtimeMeshComponent.Functional.FitSimpleCollision",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshFitSimpleCollisionTest::RunTest(const FString& Parameters)
+{
+	const FQuat4f ShapeRotation(FRotator3f(20.0f, 35.0f, 10.0f));
+	const FVector3f ShapeOffset(10.0f, 20.0f, 30.0f);
+
+	// Rotated box in polygroup 1, next to an unrelated box in polygroup 0
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnablePolyGroups();
+	}
+	URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(25.0f), FTransform3f(FVector3f(-500.0f, 0.0f, 0.0f)), 0);
+	URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(100.0f, 40.0f, 20.0f), FTransform3f(ShapeRotation, ShapeOffset), 1);
+
+	TArray<FVector3f> BoxPoints;
+	TestTrue(TEXT("Polygroup points should be gathered"), URealtimeMeshCollisionTools::GatherCollisionFitPoints(StreamSet, 1, BoxPoints));
+	TestEqual(TEXT("Only the polygroup's vertices should be gathered"), BoxPoints.Num(), 24);
+
+	FRealtimeMeshCollisionBox Box;
+	const float BoxQuality = URealtimeMeshCollisionTools::FitBox(BoxPoints, Box);
+	TestTrue(TEXT("Box should fit a box almost perfectly"), BoxQuality > 0.99f);
+	TestTrue(TEXT("Box should be centered on the source box"), Box.Center.Equals(FVector(ShapeOffset), 0.1));
+	TArray<double> Extents = { Box.Extents.X, Box.Extents.Y, Box.Extents.Z };
+	Extents.Sort();
+	TestTrue(TEXT("Box should match the source extents"),
+		FMath::IsNearlyEqual(Extents[0], 40.0, 0.1) && FMath::IsNearlyEqual(Extents[1], 80.0, 0.1) && FMath::IsNearlyEqual(Extents[2], 200.0, 0.1));
+
+	FRealtimeMeshSimpleGeometry SimpleGeometry;
+	const FRealtimeMeshCollisionFitResult BoxResult = URealtimeMeshCollisionTools::FitSimpleCollision(StreamSet, SimpleGeometry, 1);
+	TestTrue(TEXT("Box mesh should pick a box"), BoxResult.Shape == ERealtimeMeshCollisionFitShape::Box);
+	TestEqual(TEXT("Box should be added to the simple geometry"), SimpleGeometry.Boxes.Num(), 1);
+	TestEqual(TEXT("Result should point at the added box"), BoxResult.Index, 0);
+
+	// Sphere and capsule surfaces, sampled on rings so the hull is a close match of the shape
+	const FTransform3f ShapeTransform(ShapeRotation, ShapeOffset);
+	const float Radius = 30.0f;
+	const float Length = 200.0f;
+	TArray<FVector3f> SpherePoints;
+	TArray<FVector3f> CapsulePoints;
+	for (int32 Ring = 0; Ring <= 32; Ring++)
+	{
+		const float Theta = static_cast<float>(Ring) / 32 * PI;
+		for (int32 Segment = 0; Segment < 64; Segment++)
+		{
+			const float Phi = static_cast<float>(Segment) / 64 * 2.0f * PI;
+			const FVector3f Direction(FMath::Sin(Theta) * FMath::Cos(Phi), FMath::Sin(Theta) * FMath::Sin(Phi), FMath::Cos(Theta));
+			SpherePoints.Add(ShapeTransform.TransformPosition(Direction * Radius));
+			CapsulePoints.Add(ShapeTransform.TransformPosition(Direction * Radius + FVector3f(0.0f, 0.0f, Direction.Z >= 0.0f? Length * 0.5f : -Length * 0.5f)));
+		}
+	}
+
+	FRealtimeMeshCollisionSphere Sphere;
+	TestTrue(TEXT("Sphere should fit a sphere closely"), URealtimeMeshCollisionTools::FitSphere(SpherePoints, Sphere) > 0.95f);
+	TestTrue(TEXT("Sphere radius should match"), FMath::IsNearlyEqual(Sphere.Radius, Radius, Radius * 0.01f));
+	TestTrue(TEXT("Sphere should be centered on the source"), Sphere.Center.Equals(FVector(ShapeOffset), 0.3));
+
+	FRealtimeMeshCollisionCapsule Capsule;
+	TestTrue(TEXT("Capsule should fit a capsule closely"), URealtimeMeshCollisionTools::FitCapsule(CapsulePoints, Capsule) > 0.95f);
+	TestTrue(TEXT("Capsule radius should match"), FMath::IsNearlyEqual(Capsule.Radius, Radius, Radius * 0.01f));
+	TestTrue(TEXT("Capsule length should match"), FMath::IsNearlyEqual(Capsule.Length, Length, Length * 0.01f));
+	TestTrue(TEXT("Capsule should be centered on the source"), Capsule.Center.Equals(FVector(ShapeOffset), 0.3));
+	const FVector CapsuleAxis = Capsule.Rotation.Quaternion().GetAxisZ();
+	TestTrue(TEXT("Capsule should follow the source axis"), FMath::Abs(FVector::DotProduct(CapsuleAxis, FVector(ShapeRotation.GetAxisZ()))) > 0.999);
+
+	// A flat grid has no volume, nothing is a good stand in for it
+	FRealtimeMeshStreamSet FlatStreamSet;
+	const int32 GridSize = 256;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(FlatStreamSet);
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 10.0f, Y * 10.0f, 0.0f));
+			}
+		}
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				Builder.AddTriangle(V0, V0 + GridSize + 1, V0 + 1);
+				Builder.AddTriangle(V0 + 1, V0 + GridSize + 1, V0 + GridSize + 2);
+			}
+		}
+	}
+
+	FRealtimeMeshSimpleGeometry FlatGeometry;
+	const FRealtimeMeshCollisionFitResult FlatResult = URealtimeMeshCollisionTools::FitSimpleCollision(FlatStreamSet, FlatGeometry);
+	TestTrue(TEXT("Flat mesh should fall back to complex collision"), FlatResult.Shape == ERealtimeMeshCollisionFitShape::None);
+	TestEqual(TEXT("Flat mesh shouldn't add any shape"), FlatGeometry.Boxes.Num() + FlatGeometry.Spheres.Num() + FlatGeometry.Capsules.Num(), 0);
+
+	// Timing on a dense surface, the hull keeps the fits themselves cheap
+	TArray<FVector3f> DensePoints;
+	for (int32 Index = 0; Index < 100000; Index++)
+	{
+		const FVector3f Direction = FVector3f(FMath::FRandRange(-1.0f, 1.0f), FMath::FRandRange(-1.0f, 1.0f), FMath::FRandRange(-1.0f, 1.0f)).GetSafeNormal();
+		DensePoints.Add(ShapeTransform.TransformPosition(Direction * Radius + FVector3f(0.0f, 0.0f, Direction.Z >= 0.0f? Length * 0.5f : -Length * 0.5f)));
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FRealtimeMeshCollisionCapsule DenseCapsule;
+	const float DenseQuality = URealtimeMeshCollisionTools::FitCapsule(DensePoints, DenseCapsule);
+	const double FitSeconds = FPlatformTime::Seconds() - StartTime;
+	TestTrue(TEXT("Dense capsule should still fit closely"), DenseQuality > 0.95f);
+	TestTrue(TEXT("Fitting 100k points should stay interactive"), FitSeconds < 1.0);
+
+	AddInfo(FString::Printf(TEXT("Box quality %.4f, capsule fit of %d points took %.2f ms with quality %.4f"),
+		BoxQuality, DensePoints.Num(), FitSeconds * 1000.0, DenseQuality));
+
+	return true;
+}
+
+//==============================================================================
+// Test 19: Chunked Complex Collision
+// Splits a large terrain section group into grid cells, localized edits
+// should only cook the cells they touch
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshChunkedCollisionTest,
+	"RealtimeMeshComponent.Functional.ChunkedCollision",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshChunkedCollisionTest::RunTest(const FString& Parameters)
+{
+	const int32 GridSize = 64;
+	const float QuadSize = 100.0f;
+	const int32 QuadsPerChunk = 16;
+	const int32 NumChunks = FMath::Square(GridSize / QuadsPerChunk);
+
+	IConsoleVariable* CacheCooksCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.Collision.CacheSectionGroupCooks"));
+	if (!TestNotNull(TEXT("Cache section group cooks cvar should exist"), CacheCooksCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = CacheCooksCVar->GetInt();
+	CacheCooksCVar->Set(1, ECVF_SetByCode);
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	TArray<float> Heights;
+	Heights.SetNumZeroed(FMath::Square(GridSize + 1));
+	auto MakeTerrain = [&]()
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * QuadSize, Y * QuadSize, Heights[Y * (GridSize + 1) + X]))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y) / GridSize);
+			}
+		}
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + GridSize + 1;
+				const int32 V3 = V2 + 1;
+				Builder.AddTriangle(V0, V2, V1);
+				Builder.AddTriangle(V1, V2, V3);
+			}
+		}
+		return StreamSet;
+	};
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, FName("Terrain"));
+	Mesh->CreateSectionGroup(GroupKey, MakeTerrain());
+	Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0), FRealtimeMeshSectionConfig(0), true);
+
+	FRealtimeMeshCollisionConfiguration CollisionConfig = Mesh->GetCollisionConfig();
+	CollisionConfig.ComplexCollisionChunkSize = QuadsPerChunk * QuadSize;
+	Mesh->SetCollisionConfig(CollisionConfig);
+
+	// Generates the complex collision like an end of frame collision update, returning the number of cooks it took
+	int32 NumMeshes = 0;
+	int32 NumTriangles = 0;
+	auto GenerateAndCountCooks = [&]() -> int32
+	{
+		const uint64 CooksBefore = URealtimeMeshCollisionTools::GetNumComplexMeshCooks();
+
+		FRealtimeMeshComplexGeometry ComplexGeometry;
+		FRealtimeMeshAccessContext AccessContext(Mesh->GetMeshData());
+		Mesh->GetMeshData()->GenerateComplexCollision(AccessContext, ComplexGeometry);
+
+		NumMeshes = ComplexGeometry.NumMeshes();
+		NumTriangles = 0;
+		for (int32 Index = 0; Index < NumMeshes; Index++)
+		{
+			NumTriangles += ComplexGeometry.GetByIndex(Index).GetTriangles().Num();
+		}
+		TestTrue(TEXT("Every generated mesh should be cooked"), ComplexGeometry.GetMeshIDsNeedingCook().IsEmpty());
+		
+		return static_cast<int32>(URealtimeMeshCollisionTools::GetNumComplexMeshCooks() - CooksBefore);
+	};
+
+	auto EditHeight = [&](int32 X, int32 Y, float Height)
+	{
+		Heights[Y * (GridSize + 1) + X] = Height;
+		Mesh->UpdateSectionGroup(GroupKey, MakeTerrain());
+	};
+
+	TestEqual(TEXT("Initial update should cook every chunk"), GenerateAndCountCooks(), NumChunks);
+	TestEqual(TEXT("Initial update should produce a mesh per chunk"), NumMeshes, NumChunks);
+	TestEqual(TEXT("Chunks should contain every triangle"), NumTriangles, GridSize * GridSize * 2);
+
+	TestEqual(TEXT("Unchanged mesh should not cook"), GenerateAndCountCooks(), 0);
+	TestEqual(TEXT("Unchanged mesh should still produce a mesh per chunk"), NumMeshes, NumChunks);
+	TestEqual(TEXT("Cached chunks should only hand back their cook, not a copy of their triangles"), NumTriangles, 0);
+
+	// A vertex inside a chunk only touches that chunk's triangles
+	EditHeight(QuadsPerChunk + 5, QuadsPerChunk + 7, 50.0f);
+	TestEqual(TEXT("Editing inside a chunk should cook only that chunk"), GenerateAndCountCooks(), 1);
+	TestEqual(TEXT("Edited mesh should still produce a mesh per chunk"), NumMeshes, NumChunks);
+
+	// A vertex on a chunk corner is shared by the four chunks around it
+	EditHeight(QuadsPerChunk * 2, QuadsPerChunk * 2, -50.0f);
+	TestEqual(TEXT("Editing a chunk corner should cook the four chunks around it"), GenerateAndCountCooks(), 4);
+
+	// Without chunking the whole group is a single mesh, cooked again on any edit
+	CollisionConfig.ComplexCollisionChunkSize = 0.0f;
+	Mesh->SetCollisionConfig(CollisionConfig);
+	TestEqual(TEXT("Unchunked update should cook the group once"), GenerateAndCountCooks(), 1);
+	TestEqual(TEXT("Unchunked update should produce a single mesh"), NumMeshes, 1);
+
+	EditHeight(5, 5, 25.0f);
+	TestEqual(TEXT("Unchunked edit should cook the whole group"), GenerateAndCountCooks(), 1);
+	TestEqual(TEXT("Unchunked mesh should contain every triangle"), NumTriangles, GridSize * GridSize * 2);
+
+	CacheCooksCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 20: Collision Update In Place
+// Updates the collision of registered components sharing a mesh in a headless
+// world, shape only changes should keep their bodies and swap the geometry while
+// welded bodies recreate. Measures the game thread cost against recreating the
+// physics state
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCollisionUpdateInPlaceTest,
+	"RealtimeMeshComponent.Functional.CollisionUpdateInPlace",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCollisionUpdateInPlaceTest::RunTest(const FString& Parameters)
+{
+	const int32 NumUpdates = 20;
+	const float MoveDistance = 1000.0f;
+
+	IConsoleVariable* InPlaceCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.Collision.UpdateInPlace"));
+	if (!TestNotNull(TEXT("Update in place cvar should exist"), InPlaceCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = InPlaceCVar->GetInt();
+	InPlaceCVar->Set(1, ECVF_SetByCode);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	// Sync cooks are generated, cooked and applied inline by the end of frame update
+	FRealtimeMeshCollisionConfiguration CollisionConfig;
+	CollisionConfig.bUseAsyncCook = false;
+	Mesh->SetCollisionConfig(CollisionConfig);
+
+	auto MakeBox = [](float X)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(100.0f, 100.0f, 100.0f), FTransform3f(FVector3f(X, 0.0f, 0.0f)));
+		return StreamSet;
+	};
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, FName("Box"));
+	Mesh->CreateSectionGroup(GroupKey, MakeBox(0.0f));
+	Mesh->UpdateSectionConfig(FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0), FRealtimeMeshSectionConfig(0), true);
+	Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	URealtimeMeshComponent* Component = NewObject<URealtimeMeshComponent>(Actor);
+	Actor->SetRootComponent(Component);
+	Component->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	Component->SetCollisionResponseToAllChannels(ECR_Block);
+	Component->SetRealtimeMesh(Mesh);
+	Component->RegisterComponent();
+
+	// Second component on the same mesh, offset so traces can tell the two apart
+	const float SharedOffset = 1000.0f;
+	AActor* SharedActor = World->SpawnActor<AActor>(FVector(0.0f, SharedOffset, 0.0f), FRotator::ZeroRotator);
+	URealtimeMeshComponent* SharedComponent = NewObject<URealtimeMeshComponent>(SharedActor);
+	SharedActor->SetRootComponent(SharedComponent);
+	SharedComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	SharedComponent->SetCollisionResponseToAllChannels(ECR_Block);
+	SharedComponent->SetRealtimeMesh(Mesh);
+	SharedComponent->RegisterComponent();
+
+	// Moves the box and runs the collision update, returning its game thread time
+	auto MoveBoxAndUpdateCollision = [&](float X) -> double
+	{
+		Mesh->UpdateSectionGroup(GroupKey, MakeBox(X));
+		const double StartTime = FPlatformTime::Seconds();
+		Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	auto TraceHitsAt = [&](const UPrimitiveComponent* Expected, float X, float Y)
+	{
+		FHitResult Hit;
+		return World->LineTraceSingleByChannel(Hit, FVector(X, Y, 1000.0f), FVector(X, Y, -1000.0f), ECC_Visibility) && Hit.GetComponent() == Expected;
+	};
+	auto TraceHitsComponentAt = [&](float X)
+	{
+		return TraceHitsAt(Component, X, 0.0f);
+	};
+
+	TestTrue(TEXT("Component should have a physics body"), Component->BodyInstance.IsValidBodyInstance());
+	TestTrue(TEXT("Shared component should have a physics body"), SharedComponent->BodyInstance.IsValidBodyInstance());
+	TestTrue(TEXT("Initial collision should be hit"), TraceHitsComponentAt(0.0f));
+	TestTrue(TEXT("Initial collision of the shared component should be hit"), TraceHitsAt(SharedComponent, 0.0f, SharedOffset));
+
+	const UBodySetup* InitialBodySetup = Mesh->GetBodySetup();
+	const FPhysicsActorHandle InitialActorHandle = Component->BodyInstance.ActorHandle;
+	const FPhysicsActorHandle InitialSharedActorHandle = SharedComponent->BodyInstance.ActorHandle;
+	const uint64 InPlaceUpdatesBefore = URealtimeMeshComponent::GetNumCollisionUpdatesInPlace();
+
+	double InPlaceTime = 0.0;
+	bool bKeptBody = true;
+	bool bChangedGuid = true;
+	for (int32 Update = 0; Update < NumUpdates; Update++)
+	{
+		const FGuid PreviousGuid = Mesh->GetBodySetup()->BodySetupGuid;
+		InPlaceTime += MoveBoxAndUpdateCollision(Update % 2 == 0 ? MoveDistance : 0.0f);
+		bKeptBody &= Mesh->GetBodySetup() == InitialBodySetup && Component->BodyInstance.ActorHandle == InitialActorHandle
+			&& SharedComponent->BodyInstance.ActorHandle == InitialSharedActorHandle;
+		bChangedGuid &= Mesh->GetBodySetup()->BodySetupGuid != PreviousGuid;
+	}
+	TestTrue(TEXT("Shape only updates should keep the body setup and physics bodies"), bKeptBody);
+	TestTrue(TEXT("Swapping the geometry should give the body setup a new guid"), bChangedGuid);
+	TestEqual(TEXT("Every component sharing the mesh should swap its shapes in place"),
+		URealtimeMeshComponent::GetNumCollisionUpdatesInPlace() - InPlaceUpdatesBefore, static_cast<uint64>(NumUpdates * 2));
+
+	MoveBoxAndUpdateCollision(MoveDistance);
+	TestTrue(TEXT("Swapped geometry should be hit at its new location"), TraceHitsComponentAt(MoveDistance));
+	TestFalse(TEXT("Swapped geometry should not be hit at its old location"), TraceHitsComponentAt(0.0f));
+	TestTrue(TEXT("Shared component should be hit at its new location"), TraceHitsAt(SharedComponent, MoveDistance, SharedOffset));
+	TestFalse(TEXT("Shared component should not be hit at its old location"), TraceHitsAt(SharedComponent, 0.0f, SharedOffset));
+	SharedActor->Destroy();
+
+	// A body with welded children shares its actor with them, so it has to recreate instead of swapping shapes
+	UBoxComponent* WeldedBox = NewObject<UBoxComponent>(Actor);
+	WeldedBox->SetBoxExtent(FVector(50.0f));
+	WeldedBox->SetRelativeLocation(FVector(0.0f, -SharedOffset, 0.0f));
+	WeldedBox->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	WeldedBox->SetupAttachment(Component);
+	WeldedBox->RegisterComponent();
+	WeldedBox->WeldTo(Component);
+	if (TestTrue(TEXT("Box should be welded to the component"), WeldedBox->BodyInstance.WeldParent == &Component->BodyInstance))
+	{
+		const uint64 InPlaceUpdatesBeforeWeld = URealtimeMeshComponent::GetNumCollisionUpdatesInPlace();
+		MoveBoxAndUpdateCollision(0.0f);
+		TestEqual(TEXT("Welded body should not swap its shapes in place"), URealtimeMeshComponent::GetNumCollisionUpdatesInPlace(), InPlaceUpdatesBeforeWeld);
+		TestTrue(TEXT("Welded body should be recreated from the current body setup"), Component->BodyInstance.GetBodySetup() == Mesh->GetBodySetup());
+		TestTrue(TEXT("Recreated welded body should be hit at the new location"), TraceHitsComponentAt(0.0f));
+		TestFalse(TEXT("Recreated welded body should not be hit at its old location"), TraceHitsComponentAt(MoveDistance));
+	}
+	WeldedBox->DestroyComponent();
+
+	// Changing the body configuration needs a new body setup and body
+	CollisionConfig.bUseComplexAsSimpleCollision = false;
+	Mesh->SetCollisionConfig(CollisionConfig);
+	Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+	TestTrue(TEXT("Body configuration change should create a new body setup"), Mesh->GetBodySetup() != InitialBodySetup);
+	TestTrue(TEXT("Body should be recreated from the new body setup"), Component->BodyInstance.GetBodySetup() == Mesh->GetBodySetup());
+
+	CollisionConfig.bUseComplexAsSimpleCollision = true;
+	Mesh->SetCollisionConfig(CollisionConfig);
+	Mesh->GetMeshData()->ProcessEndOfFrameUpdates();
+
+	// Same updates recreating the physics state every time
+	InPlaceCVar->Set(0, ECVF_SetByCode);
+	double RecreateTime = 0.0;
+	bool bRecreatedBody = true;
+	for (int32 Update = 0; Update < NumUpdates; Update++)
+	{
+		const UBodySetup* PreviousBodySetup = Mesh->GetBodySetup();
+		RecreateTime += MoveBoxAndUpdateCollision(Update % 2 == 0 ? MoveDistance : 0.0f);
+		bRecreatedBody &= Mesh->GetBodySetup() != PreviousBodySetup && Component->BodyInstance.GetBodySetup() == Mesh->GetBodySetup();
+	}
+	TestTrue(TEXT("Disabling in place updates should recreate the body"), bRecreatedBody);
+
+	AddInfo(FString::Printf(TEXT("Collision update game thread time, in place: %.3f ms, recreate: %.3f ms"),
+		InPlaceTime * 1000.0 / NumUpdates, RecreateTime * 1000.0 / NumUpdates));
+
+	InPlaceCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+
+	Actor->Destroy();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 21: Vertex Factory Reuse
+// Tests that stream updates with an unchanged layout and size keep the vertex factory
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshVertexFactoryReuseTest,
+	"RealtimeMeshComponent.Functional.VertexFactoryReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshVertexFactoryReuseTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* ReuseCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.ReuseStreamBuffers"));
+	if (!TestNotNull(TEXT("Buffer reuse cvar should exist"), ReuseCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = ReuseCVar->GetInt();
+	ReuseCVar->Set(1, ECVF_SetByCode);
+
+	auto BuildGrid = [](int32 GridSize, float Height)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, Height))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				const int32 V1 = V0 + 1;
+				const int32 V2 = V0 + (GridSize + 1);
+				const int32 V3 = V2 + 1;
+
+				Builder.AddTriangle(V0, V2, V1);
+				Builder.AddTriangle(V1, V2, V3);
+			}
+		}
+		return StreamSet;
+	};
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(true);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()))
+	{
+		ReuseCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+		return false;
+	}
+
+	// Nothing is rendering in the test, so process the proxy's queued commands ourselves
+	auto ProcessProxyCommands = [Proxy]()
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshVertexFactoryReuseTest)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	};
+
+	int32 NumProxyRecreateRequests = 0;
+	const FDelegateHandle RecreateHandle = Mesh->GetMesh()->GetSharedResources()->OnRenderProxyRequiresUpdate().AddLambda([&NumProxyRecreateRequests]()
+	{
+		NumProxyRecreateRequests++;
+	});
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+	Mesh->CreateSectionGroup(GroupKey, BuildGrid(8, 0.0f), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static));
+	ProcessProxyCommands();
+
+	// Same layout and size every time, the buffers are written in place
+	{
+		const int32 NumUpdates = 20;
+		NumProxyRecreateRequests = 0;
+		const uint64 RebuildsBefore = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds();
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (int32 Index = 0; Index < NumUpdates; Index++)
+		{
+			Mesh->UpdateSectionGroup(GroupKey, BuildGrid(8, 10.0f * (Index + 1)));
+			ProcessProxyCommands();
+		}
+
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		const uint64 Rebuilds = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds() - RebuildsBefore;
+		AddInfo(FString::Printf(TEXT("%d same layout updates: %llu vertex factory rebuilds, %.2f ms per update"), NumUpdates, Rebuilds, ElapsedMs / NumUpdates));
+
+		TestEqual(TEXT("Same layout updates should not rebuild the vertex factory"), Rebuilds, static_cast<uint64>(0));
+		TestEqual(TEXT("Same layout updates should not recreate the scene proxy"), NumProxyRecreateRequests, 0);
+	}
+
+	// A different vertex count needs new buffers and bindings
+	{
+		NumProxyRecreateRequests = 0;
+		const uint64 RebuildsBefore = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds();
+
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(9, 0.0f));
+		ProcessProxyCommands();
+
+		TestTrue(TEXT("Resizing the streams should rebuild the vertex factory"), FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds() > RebuildsBefore);
+		TestTrue(TEXT("Resizing the streams of a static group should recreate the scene proxy"), NumProxyRecreateRequests > 0);
+	}
+
+	// Back to in place updates at the new size
+	{
+		const uint64 RebuildsBefore = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds();
+
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(9, 50.0f));
+		ProcessProxyCommands();
+
+		TestEqual(TEXT("Updates at the new size should reuse the new buffers"), FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds(), RebuildsBefore);
+	}
+
+	// With reuse disabled every update replaces the buffers
+	{
+		ReuseCVar->Set(0, ECVF_SetByCode);
+		NumProxyRecreateRequests = 0;
+		const uint64 RebuildsBefore = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds();
+
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(9, 60.0f));
+		ProcessProxyCommands();
+
+		TestTrue(TEXT("Disabling reuse should rebuild the vertex factory"), FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds() > RebuildsBefore);
+		TestTrue(TEXT("Disabling reuse should recreate the scene proxy"), NumProxyRecreateRequests > 0);
+	}
+
+	ReuseCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+	Mesh->GetMesh()->GetSharedResources()->OnRenderProxyRequiresUpdate().Remove(RecreateHandle);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 22: Dynamic Ring Buffers
+// Tests that dynamic section groups suballocate every update from one ring, keeping their buffers, views and vertex factory
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshDynamicRingBufferTest,
+	"RealtimeMeshComponent.Functional.DynamicRingBuffers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshDynamicRingBufferTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* RingCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.DynamicRingBuffers"));
+	if (!TestNotNull(TEXT("Ring buffer cvar should exist"), RingCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = RingCVar->GetInt();
+	RingCVar->Set(1, ECVF_SetByCode);
+
+	auto BuildGrid = [](int32 GridSize)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, 0.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				Builder.AddTriangle(V0, V0 + (GridSize + 1), V0 + 1);
+				Builder.AddTriangle(V0 + 1, V0 + (GridSize + 1), V0 + GridSize + 2);
+			}
+		}
+		return StreamSet;
+	};
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(true);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()))
+	{
+		RingCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+		return false;
+	}
+
+	// Nothing is rendering in the test, so process the proxy's queued commands ourselves
+	auto ProcessProxyCommands = [Proxy]()
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshDynamicRingBufferTest)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	};
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+	auto GetSectionGroup = [Proxy, GroupKey]() -> FRealtimeMeshSectionGroupProxyPtr
+	{
+		const FRealtimeMeshLODProxyPtr LOD = Proxy->GetLOD(FRealtimeMeshLODKey(0));
+		return LOD ? LOD->GetSectionGroup(GroupKey) : nullptr;
+	};
+	auto GetVertexBuffer = [GetSectionGroup](const FRealtimeMeshStreamKey& StreamKey) -> TSharedPtr<FRealtimeMeshVertexBuffer>
+	{
+		const FRealtimeMeshSectionGroupProxyPtr SectionGroup = GetSectionGroup();
+		const TSharedPtr<FRealtimeMeshGPUBuffer> Buffer = SectionGroup ? SectionGroup->GetStream(StreamKey) : nullptr;
+		return Buffer ? StaticCastSharedPtr<FRealtimeMeshVertexBuffer>(Buffer) : nullptr;
+	};
+
+	// The ring streams of the group and the RHI resources they were bound with
+	struct FBoundStream
+	{
+		FRealtimeMeshStreamKey StreamKey;
+		const FRHIBuffer* Buffer;
+		const FRHIShaderResourceView* View;
+	};
+	auto GetBoundStreams = [GetVertexBuffer]()
+	{
+		TArray<FBoundStream> BoundStreams;
+		for (const FRealtimeMeshStreamKey& StreamKey : { FRealtimeMeshStreams::Position, FRealtimeMeshStreams::Tangents, FRealtimeMeshStreams::TexCoords })
+		{
+			const TSharedPtr<FRealtimeMeshVertexBuffer> Buffer = GetVertexBuffer(StreamKey);
+			BoundStreams.Add({ StreamKey, Buffer ? Buffer->GetRHIBuffer() : nullptr, Buffer ? Buffer->ShaderResourceViewRHI.GetReference() : nullptr });
+		}
+		return BoundStreams;
+	};
+	auto TestStreamsUnchanged = [this, GetBoundStreams](const TCHAR* What, const TArray<FBoundStream>& Expected)
+	{
+		const TArray<FBoundStream> Current = GetBoundStreams();
+		for (int32 Index = 0; Index < Expected.Num(); Index++)
+		{
+			const FString StreamName = Expected[Index].StreamKey.ToString();
+			TestTrue(FString::Printf(TEXT("%s should keep the RHI buffer of %s"), What, *StreamName), Current[Index].Buffer == Expected[Index].Buffer);
+			TestTrue(FString::Printf(TEXT("%s should keep the view of %s"), What, *StreamName), Current[Index].View == Expected[Index].View);
+		}
+	};
+
+	Mesh->CreateSectionGroup(GroupKey, BuildGrid(8), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Dynamic));
+	ProcessProxyCommands();
+
+	const TSharedPtr<FRealtimeMeshVertexBuffer> PositionBuffer = GetVertexBuffer(FRealtimeMeshStreams::Position);
+	if (!TestTrue(TEXT("Position stream should be on the GPU"), PositionBuffer.IsValid()))
+	{
+		RingCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+		Mesh->Reset();
+		return false;
+	}
+	TestTrue(TEXT("Dynamic position stream should be ring backed"), PositionBuffer->IsRingBuffer());
+	TestTrue(TEXT("Section group should have a vertex ring"), GetSectionGroup().IsValid() && GetSectionGroup()->HasVertexRing());
+	const TArray<FBoundStream> RingStreams = GetBoundStreams();
+	for (const FBoundStream& RingStream : RingStreams)
+	{
+		const TSharedPtr<FRealtimeMeshVertexBuffer> Buffer = GetVertexBuffer(RingStream.StreamKey);
+		TestTrue(FString::Printf(TEXT("%s should be in the group's ring"), *RingStream.StreamKey.ToString()), Buffer.IsValid() && Buffer->IsRingBuffer());
+	}
+
+	// Shrinking vertex counts are written to free rows of the same ring, only the base vertex moves
+	for (int32 GridSize = 7; GridSize >= 5; GridSize--)
+	{
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(GridSize));
+		ProcessProxyCommands();
+
+		const TSharedPtr<FRealtimeMeshVertexBuffer> Current = GetVertexBuffer(FRealtimeMeshStreams::Position);
+		TestTrue(TEXT("Resized update should keep the same buffer object"), Current == PositionBuffer);
+		TestStreamsUnchanged(TEXT("Resized update"), RingStreams);
+		TestEqual(TEXT("Bound vertex count should follow the update"), Current.IsValid() ? Current->Num() : 0, (GridSize + 1) * (GridSize + 1));
+	}
+
+	// Nothing renders in between, so the regions all stay in flight until the ring runs out and grows instead of waiting for the GPU
+	TArray<FBoundStream> OverflowStreams;
+	{
+		const uint64 RebuildsBefore = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds();
+		const uint64 OverflowGrowsBefore = FRealtimeMeshSectionGroupProxy::GetNumRingOverflowGrows();
+		for (int32 Index = 0; Index < 16; Index++)
+		{
+			Mesh->UpdateSectionGroup(GroupKey, BuildGrid(5));
+			ProcessProxyCommands();
+		}
+
+		const uint64 OverflowGrows = FRealtimeMeshSectionGroupProxy::GetNumRingOverflowGrows() - OverflowGrowsBefore;
+		TestTrue(TEXT("A full ring should grow"), OverflowGrows > 0);
+		TestEqual(TEXT("Each overflow should rebuild the vertex factory once"), FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds() - RebuildsBefore, OverflowGrows);
+
+		const TSharedPtr<FRealtimeMeshVertexBuffer> Current = GetVertexBuffer(FRealtimeMeshStreams::Position);
+		TestTrue(TEXT("Overflowed stream should still be ring backed"), Current.IsValid() && Current->IsRingBuffer());
+		TestTrue(TEXT("Growing on overflow should move to a new RHI buffer"), Current.IsValid() && Current->GetRHIBuffer() != RingStreams[0].Buffer);
+		TestEqual(TEXT("Overflowed update should bind every vertex"), Current.IsValid() ? Current->Num() : 0, 6 * 6);
+
+		OverflowStreams = GetBoundStreams();
+	}
+
+	// Larger than a region of the ring, the ring is resized once and later updates of that size stay in it
+	{
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(24));
+		ProcessProxyCommands();
+
+		const TSharedPtr<FRealtimeMeshVertexBuffer> Current = GetVertexBuffer(FRealtimeMeshStreams::Position);
+		TestTrue(TEXT("Grown stream should still be ring backed"), Current.IsValid() && Current->IsRingBuffer());
+		TestTrue(TEXT("Growing the ring should move to a new RHI buffer"), Current.IsValid() && Current->GetRHIBuffer() != OverflowStreams[0].Buffer);
+		TestEqual(TEXT("Grown update should bind every vertex"), Current.IsValid() ? Current->Num() : 0, 25 * 25);
+
+		const TArray<FBoundStream> GrownStreams = GetBoundStreams();
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(24));
+		ProcessProxyCommands();
+		TestStreamsUnchanged(TEXT("Update after the ring grew"), GrownStreams);
+	}
+
+	// Disabled, the group's streams move to ordinary buffers again
+	{
+		RingCVar->Set(0, ECVF_SetByCode);
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(4));
+		ProcessProxyCommands();
+
+		const TSharedPtr<FRealtimeMeshVertexBuffer> Current = GetVertexBuffer(FRealtimeMeshStreams::Position);
+		TestTrue(TEXT("Disabling ring buffers should use a plain buffer"), Current.IsValid() && !Current->IsRingBuffer());
+		TestTrue(TEXT("Disabling ring buffers should release the group's ring"), GetSectionGroup().IsValid() && !GetSectionGroup()->HasVertexRing());
+	}
+
+	RingCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 23: Coalesced Stream Uploads
+// Tests that rapid updates queued before the render thread runs only create the last upload's buffers
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCoalescedStreamUploadTest,
+	"RealtimeMeshComponent.Functional.CoalescedStreamUploads",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCoalescedStreamUploadTest::RunTest(const FString& Parameters)
+{
+	// Create every buffer on the render thread so the count doesn't depend on the RHI supporting async creation
+	IConsoleVariable* CreationModeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.BufferCreationMode"));
+	if (!TestNotNull(TEXT("Buffer creation mode cvar should exist"), CreationModeCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = CreationModeCVar->GetInt();
+	CreationModeCVar->Set(0, ECVF_SetByCode);
+
+	auto BuildGrid = [](int32 GridSize)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, 0.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				Builder.AddTriangle(V0, V0 + (GridSize + 1), V0 + 1);
+				Builder.AddTriangle(V0 + 1, V0 + (GridSize + 1), V0 + GridSize + 2);
+			}
+		}
+		return StreamSet;
+	};
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(true);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()))
+	{
+		CreationModeCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+		return false;
+	}
+
+	// Nothing is rendering in the test, so process the proxy's queued commands ourselves
+	auto ProcessProxyCommands = [Proxy]()
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshCoalescedStreamUploadTest)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	};
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+	auto GetPositionBuffer = [Proxy, GroupKey]() -> TSharedPtr<FRealtimeMeshGPUBuffer>
+	{
+		const FRealtimeMeshLODProxyPtr LOD = Proxy->GetLOD(FRealtimeMeshLODKey(0));
+		const FRealtimeMeshSectionGroupProxyPtr SectionGroup = LOD ? LOD->GetSectionGroup(GroupKey) : nullptr;
+		return SectionGroup ? SectionGroup->GetStream(FRealtimeMeshStreams::Position) : nullptr;
+	};
+
+	Mesh->CreateSectionGroup(GroupKey, BuildGrid(4), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static));
+	ProcessProxyCommands();
+
+	// Every update changes the vertex count, so none of them can be written over the existing buffers
+	uint64 BuffersPerUpdate = 0;
+	{
+		const uint64 BuffersBefore = FRealtimeMeshSectionGroupStreamUpdateData::GetNumBuffersCreated();
+		Mesh->UpdateSectionGroup(GroupKey, BuildGrid(5));
+		ProcessProxyCommands();
+		BuffersPerUpdate = FRealtimeMeshSectionGroupStreamUpdateData::GetNumBuffersCreated() - BuffersBefore;
+		TestTrue(TEXT("A resizing update should create buffers"), BuffersPerUpdate > 0);
+	}
+
+	// Several updates before the render thread gets to them
+	{
+		const int32 NumUpdates = 8;
+		const uint64 BuffersBefore = FRealtimeMeshSectionGroupStreamUpdateData::GetNumBuffersCreated();
+		const uint64 SupersededBefore = FRealtimeMeshProxyUpdateBuilder::GetNumSupersededStreamTasks();
+
+		for (int32 Index = 0; Index < NumUpdates; Index++)
+		{
+			Mesh->UpdateSectionGroup(GroupKey, BuildGrid(6 + Index));
+		}
+		ProcessProxyCommands();
+
+		const uint64 Buffers = FRealtimeMeshSectionGroupStreamUpdateData::GetNumBuffersCreated() - BuffersBefore;
+		const uint64 Superseded = FRealtimeMeshProxyUpdateBuilder::GetNumSupersededStreamTasks() - SupersededBefore;
+		AddInfo(FString::Printf(TEXT("%d queued updates: %llu buffers created, %llu stream tasks superseded"), NumUpdates, Buffers, Superseded));
+
+		TestEqual(TEXT("Queued updates should only create the last update's buffers"), Buffers, BuffersPerUpdate);
+		TestTrue(TEXT("Every update but the last should be superseded"), Superseded >= static_cast<uint64>(NumUpdates - 1));
+
+		const int32 LastGridSize = 6 + NumUpdates - 1;
+		const TSharedPtr<FRealtimeMeshGPUBuffer> PositionBuffer = GetPositionBuffer();
+		TestEqual(TEXT("The GPU should hold the last update"), PositionBuffer.IsValid() ? PositionBuffer->Num() : 0, (LastGridSize + 1) * (LastGridSize + 1));
+	}
+
+	CreationModeCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 24: Upload Budget
+// Tests that updates over the per frame upload budget wait for a later frame and are applied whole
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadBudgetTest,
+	"RealtimeMeshComponent.Functional.UploadBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadBudgetTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BudgetCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.UploadBudgetPerFrame"));
+	IConsoleVariable* MaxDeferCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.UploadBudgetPerFrame.MaxDeferFrames"));
+	if (!TestNotNull(TEXT("Upload budget cvar should exist"), BudgetCVar) || !TestNotNull(TEXT("Max defer frames cvar should exist"), MaxDeferCVar))
+	{
+		return false;
+	}
+	const int32 OriginalBudget = BudgetCVar->GetInt();
+	const int32 OriginalMaxDefer = MaxDeferCVar->GetInt();
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(true);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()))
+	{
+		return false;
+	}
+
+	auto ProcessProxyCommands = [Proxy]()
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshUploadBudgetTest)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	};
+
+	auto GetPositionBuffer = [Proxy](const FRealtimeMeshSectionGroupKey& GroupKey) -> TSharedPtr<FRealtimeMeshGPUBuffer>
+	{
+		const FRealtimeMeshLODProxyPtr LOD = Proxy->GetLOD(FRealtimeMeshLODKey(0));
+		const FRealtimeMeshSectionGroupProxyPtr SectionGroup = LOD ? LOD->GetSectionGroup(GroupKey) : nullptr;
+		return SectionGroup ? SectionGroup->GetStream(FRealtimeMeshStreams::Position) : nullptr;
+	};
+
+	// Every update is bigger than a 1 byte budget, so only the first of the frame can go through and nothing is forced
+	BudgetCVar->Set(1, ECVF_SetByCode);
+	MaxDeferCVar->Set(0, ECVF_SetByCode);
+	Mesh->SetUploadPriority(10.0f);
+
+	const FRealtimeMeshSectionGroupKey GroupKeyA = FRealtimeMeshSectionGroupKey::Create(0, FName("GroupA"));
+	const FRealtimeMeshSectionGroupKey GroupKeyB = FRealtimeMeshSectionGroupKey::Create(0, FName("GroupB"));
+	auto MakeBox = []()
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(100.0f, 100.0f, 100.0f));
+		return StreamSet;
+	};
+
+	Mesh->CreateSectionGroup(GroupKeyA, MakeBox());
+	Mesh->CreateSectionGroup(GroupKeyB, MakeBox());
+	ProcessProxyCommands();
+
+	TestTrue(TEXT("Updates over the budget should wait"), Proxy->GetNumPendingCommandBatches() >= 1);
+	TestTrue(TEXT("Waiting updates should be counted in bytes"), Proxy->GetPendingUploadBytes() > 0);
+	TestFalse(TEXT("The last update should not have reached the GPU yet"), GetPositionBuffer(GroupKeyB).IsValid());
+
+	// Lifting the budget applies everything that was waiting
+	BudgetCVar->Set(0, ECVF_SetByCode);
+	ProcessProxyCommands();
+
+	TestEqual(TEXT("Nothing should be left waiting"), Proxy->GetNumPendingCommandBatches(), 0);
+	TestEqual(TEXT("No bytes should be left waiting"), Proxy->GetPendingUploadBytes(), static_cast<uint64>(0));
+	TestTrue(TEXT("The first section group should be on the GPU"), GetPositionBuffer(GroupKeyA).IsValid());
+	TestTrue(TEXT("The second section group should be on the GPU"), GetPositionBuffer(GroupKeyB).IsValid());
+
+	BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+	MaxDeferCVar->Set(OriginalMaxDefer, ECVF_SetByCode);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 25: In Place Updates With Components
+// Tests that updates which don't recreate the scene proxy still reach a render
+// proxy that a registered component is using
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInPlaceUpdateWithComponentTest,
+	"RealtimeMeshComponent.Functional.InPlaceUpdateWithComponent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInPlaceUpdateWithComponentTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* ReuseCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.ReuseStreamBuffers"));
+	if (!TestNotNull(TEXT("Buffer reuse cvar should exist"), ReuseCVar))
+	{
+		return false;
+	}
+	const int32 OriginalCVarValue = ReuseCVar->GetInt();
+	ReuseCVar->Set(1, ECVF_SetByCode);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	auto MakeBox = [](float Z)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		URealtimeMeshBasicShapeTools::AppendBoxMesh(StreamSet, FVector3f(100.0f, 100.0f, 100.0f), FTransform3f(FVector3f(0.0f, 0.0f, Z)));
+		return StreamSet;
+	};
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, FName("Box"));
+	Mesh->CreateSectionGroup(GroupKey, MakeBox(0.0f), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static));
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	URealtimeMeshComponent* Component = NewObject<URealtimeMeshComponent>(Actor);
+	Actor->SetRootComponent(Component);
+	Component->SetRealtimeMesh(Mesh);
+	Component->RegisterComponent();
+	FlushRenderingCommands();
+
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(false);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()) ||
+		!TestTrue(TEXT("The component's scene proxy should reference the render proxy"), Proxy->HasAnyReferencingComponents()))
+	{
+		ReuseCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+		Actor->Destroy();
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	int32 NumProxyRecreateRequests = 0;
+	const FDelegateHandle RecreateHandle = Mesh->GetMesh()->GetSharedResources()->OnRenderProxyRequiresUpdate().AddLambda([&NumProxyRecreateRequests]()
+	{
+		NumProxyRecreateRequests++;
+	});
+
+	// Nothing renders in the test, so neither the view extension nor a scene proxy recreate will apply the updates
+	auto WaitForUpdate = [](TFuture<ERealtimeMeshProxyUpdateStatus>& Future)
+	{
+		FlushRenderingCommands();
+		const double StartTime = FPlatformTime::Seconds();
+		while (!Future.IsReady() && (FPlatformTime::Seconds() - StartTime) < 5.0)
+		{
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			FPlatformProcess::Sleep(0.01f);
+		}
+		return Future.IsReady() ? Future.Get() : ERealtimeMeshProxyUpdateStatus::NoUpdate;
+	};
+
+	// Same layout and size, the buffers are written in place without recreating the scene proxy
+	{
+		const uint64 RebuildsBefore = FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds();
+
+		TFuture<ERealtimeMeshProxyUpdateStatus> Future = Mesh->UpdateSectionGroup(GroupKey, MakeBox(50.0f));
+		TestTrue(TEXT("In place update should be applied while the component is using the proxy"), WaitForUpdate(Future) == ERealtimeMeshProxyUpdateStatus::Updated);
+		TestEqual(TEXT("In place update should not recreate the scene proxy"), NumProxyRecreateRequests, 0);
+		TestEqual(TEXT("In place update should not rebuild the vertex factory"), FRealtimeMeshSectionGroupProxy::GetNumVertexFactoryRebuilds(), RebuildsBefore);
+		TestEqual(TEXT("Nothing should be left waiting"), Proxy->GetNumPendingCommandBatches(), 0);
+	}
+
+	// Range edits take the same path
+	{
+		TFuture<ERealtimeMeshProxyUpdateStatus> Future = Mesh->EditMeshRangesInPlace(GroupKey, [](FRealtimeMeshStreamSet& Streams)
+		{
+			FRealtimeMeshStream& Positions = *Streams.Find(FRealtimeMeshStreams::Position);
+			Positions.SetGenerated<FVector3f>(0, 2, [](int32 Index) { return FVector3f(0.0f, 0.0f, 200.0f); });
+			return TSet<FRealtimeMeshStreamKey> { FRealtimeMeshStreams::Position };
+		});
+		TestTrue(TEXT("Range edit should be applied while the component is using the proxy"), WaitForUpdate(Future) == ERealtimeMeshProxyUpdateStatus::Updated);
+		TestEqual(TEXT("Range edit should not recreate the scene proxy"), NumProxyRecreateRequests, 0);
+	}
+
+	Mesh->GetMesh()->GetSharedResources()->OnRenderProxyRequiresUpdate().Remove(RecreateHandle);
+	ReuseCVar->Set(OriginalCVarValue, ECVF_SetByCode);
+
+	Actor->Destroy();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 26: Coalescing With Upload Budget
+// Tests that an update left waiting on the upload budget doesn't take the
+// stream uploads of an earlier update that is applied
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshCoalescedUploadBudgetTest,
+	"RealtimeMeshComponent.Functional.CoalescedUploadBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshCoalescedUploadBudgetTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BudgetCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.UploadBudgetPerFrame"));
+	IConsoleVariable* MaxDeferCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.UploadBudgetPerFrame.MaxDeferFrames"));
+	if (!TestNotNull(TEXT("Upload budget cvar should exist"), BudgetCVar) || !TestNotNull(TEXT("Max defer frames cvar should exist"), MaxDeferCVar))
+	{
+		return false;
+	}
+	const int32 OriginalBudget = BudgetCVar->GetInt();
+	const int32 OriginalMaxDefer = MaxDeferCVar->GetInt();
+
+	auto BuildGrid = [](int32 GridSize)
+	{
+		FRealtimeMeshStreamSet StreamSet;
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, 0.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				Builder.AddTriangle(V0, V0 + (GridSize + 1), V0 + 1);
+				Builder.AddTriangle(V0 + 1, V0 + (GridSize + 1), V0 + GridSize + 2);
+			}
+		}
+		return StreamSet;
+	};
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(true);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()))
+	{
+		return false;
+	}
+
+	auto ProcessProxyCommands = [Proxy]()
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshCoalescedUploadBudgetTest)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	};
+
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+	const FRealtimeMeshSectionKey SectionKey = FRealtimeMeshSectionKey::CreateForPolyGroup(GroupKey, 0);
+
+	// The section's range has to stay inside the buffers the proxy holds, whatever was applied
+	auto TestProxyMatchesGrid = [&](const TCHAR* What, int32 GridSize)
+	{
+		const FRealtimeMeshLODProxyPtr LOD = Proxy->GetLOD(FRealtimeMeshLODKey(0));
+		const FRealtimeMeshSectionGroupProxyPtr SectionGroup = LOD ? LOD->GetSectionGroup(GroupKey) : nullptr;
+		const TSharedPtr<FRealtimeMeshGPUBuffer> Positions = SectionGroup ? SectionGroup->GetStream(FRealtimeMeshStreams::Position) : nullptr;
+		const TSharedPtr<FRealtimeMeshGPUBuffer> Triangles = SectionGroup ? SectionGroup->GetStream(FRealtimeMeshStreams::Triangles) : nullptr;
+		const FRealtimeMeshSectionProxyPtr Section = SectionGroup ? SectionGroup->GetSection(SectionKey) : nullptr;
+		if (!TestTrue(FString::Printf(TEXT("%s: streams and section should be on the proxy"), What), Positions.IsValid() && Triangles.IsValid() && Section.IsValid()))
+		{
+			return;
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: positions should match the grid"), What), Positions->Num(), (GridSize + 1) * (GridSize + 1));
+		TestEqual(FString::Printf(TEXT("%s: section should draw the whole grid"), What), Section->GetStreamRange().NumVertices(), (GridSize + 1) * (GridSize + 1));
+		TestTrue(FString::Printf(TEXT("%s: section vertices should be inside the position buffer"), What), Section->GetStreamRange().GetMaxVertex() < Positions->Num());
+		TestTrue(FString::Printf(TEXT("%s: section indices should be inside the index buffer"), What), Section->GetStreamRange().GetMaxIndex() < Triangles->Num());
+	};
+
+	BudgetCVar->Set(0, ECVF_SetByCode);
+	Mesh->CreateSectionGroup(GroupKey, BuildGrid(4), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static));
+	ProcessProxyCommands();
+	TestProxyMatchesGrid(TEXT("Initial grid"), 4);
+
+	// Two resizing updates to the same streams, a 1 byte budget only lets the first of the frame through
+	BudgetCVar->Set(1, ECVF_SetByCode);
+	MaxDeferCVar->Set(0, ECVF_SetByCode);
+	Mesh->UpdateSectionGroup(GroupKey, BuildGrid(5));
+	Mesh->UpdateSectionGroup(GroupKey, BuildGrid(6));
+
+	const uint64 SupersededBefore = FRealtimeMeshProxyUpdateBuilder::GetNumSupersededStreamTasks();
+	ProcessProxyCommands();
+
+	TestEqual(TEXT("The second update should wait on the budget"), Proxy->GetNumPendingCommandBatches(), 1);
+	TestEqual(TEXT("A waiting update should not supersede the applied one"), FRealtimeMeshProxyUpdateBuilder::GetNumSupersededStreamTasks(), SupersededBefore);
+	TestProxyMatchesGrid(TEXT("First update"), 5);
+
+	// Lifting the budget applies the waiting update
+	BudgetCVar->Set(0, ECVF_SetByCode);
+	ProcessProxyCommands();
+
+	TestEqual(TEXT("Nothing should be left waiting"), Proxy->GetNumPendingCommandBatches(), 0);
+	TestProxyMatchesGrid(TEXT("Second update"), 6);
+
+	BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+	MaxDeferCVar->Set(OriginalMaxDefer, ECVF_SetByCode);
+	Mesh->Reset();
+	return true;
+}
+
+//==============================================================================
+// Test 27: Interleaved Range Upload
+// Tests that a range edit of an interleaved section group only repacks and
+// uploads the rows it changed
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInterleavedRangeUploadTest,
+	"RealtimeMeshComponent.Functional.InterleavedRangeUpload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInterleavedRangeUploadTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BudgetCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.UploadBudgetPerFrame"));
+	IConsoleVariable* MaxDeferCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("RealtimeMesh.UploadBudgetPerFrame.MaxDeferFrames"));
+	if (!TestNotNull(TEXT("Upload budget cvar should exist"), BudgetCVar) || !TestNotNull(TEXT("Max defer frames cvar should exist"), MaxDeferCVar))
+	{
+		return false;
+	}
+	const int32 OriginalBudget = BudgetCVar->GetInt();
+	const int32 OriginalMaxDefer = MaxDeferCVar->GetInt();
+
+	constexpr int32 GridSize = 8;
+	FRealtimeMeshStreamSet StreamSet;
+	{
+		TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(StreamSet);
+		Builder.EnableTangents();
+		Builder.EnableTexCoords();
+
+		for (int32 Y = 0; Y <= GridSize; Y++)
+		{
+			for (int32 X = 0; X <= GridSize; X++)
+			{
+				Builder.AddVertex(FVector3f(X * 100.0f, Y * 100.0f, 0.0f))
+					.SetNormalAndTangent(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f))
+					.SetTexCoord(FVector2f(X, Y));
+			}
+		}
+
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 V0 = Y * (GridSize + 1) + X;
+				Builder.AddTriangle(V0, V0 + (GridSize + 1), V0 + 1);
+				Builder.AddTriangle(V0 + 1, V0 + (GridSize + 1), V0 + GridSize + 2);
+			}
+		}
+	}
+
+	URealtimeMeshSimple* Mesh = NewObject<URealtimeMeshSimple>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FRealtimeMeshProxyPtr Proxy = Mesh->GetMesh()->GetRenderProxy(true);
+	if (!TestTrue(TEXT("Render proxy should be created"), Proxy.IsValid()))
+	{
+		return false;
+	}
+
+	auto ProcessProxyCommands = [Proxy]()
+	{
+		ENQUEUE_RENDER_COMMAND(RealtimeMeshInterleavedRangeUploadTest)([Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->ProcessCommands(RHICmdList);
+		});
+		FlushRenderingCommands();
+	};
+
+	BudgetCVar->Set(0, ECVF_SetByCode);
+	const FRealtimeMeshSectionGroupKey GroupKey = FRealtimeMeshSectionGroupKey::Create(0, 0);
+	Mesh->CreateSectionGroup(GroupKey, MoveTemp(StreamSet), FRealtimeMeshSectionGroupConfig(ERealtimeMeshSectionDrawType::Static, true));
+	ProcessProxyCommands();
+
+	const FRealtimeMeshLODProxyPtr LOD = Proxy->GetLOD(FRealtimeMeshLODKey(0));
+	const FRealtimeMeshSectionGroupProxyPtr SectionGroup = LOD ? LOD->GetSectionGroup(GroupKey) : nullptr;
+	const TSharedPtr<FRealtimeMeshGPUBuffer> Interleaved = SectionGroup ? SectionGroup->GetStream(FRealtimeMeshStreams::Interleaved) : nullptr;
+	if (!TestTrue(TEXT("Interleaved stream should be on the proxy"), Interleaved.IsValid()))
+	{
+		BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+		Mesh->Reset();
+		return false;
+	}
+	const int32 NumRows = Interleaved->Num();
+	TestEqual(TEXT("Interleaved stream should hold every vertex"), NumRows, (GridSize + 1) * (GridSize + 1));
+
+	auto EditPositions = [&](int32 StartIndex, int32 Count)
+	{
+		Mesh->EditMeshRangesInPlace(GroupKey, [StartIndex, Count](FRealtimeMeshStreamSet& Streams)
+		{
+			FRealtimeMeshStream& Positions = *Streams.Find(FRealtimeMeshStreams::Position);
+			Positions.SetGenerated<FVector3f>(StartIndex, Count, [](int32 Index) { return FVector3f(0.0f, 0.0f, 50.0f); });
+			return TSet<FRealtimeMeshStreamKey> { FRealtimeMeshStreams::Position };
+		});
+	};
+
+	// A 1 byte budget only lets the first edit of the frame through, which leaves the second one's size to look at
+	BudgetCVar->Set(1, ECVF_SetByCode);
+	MaxDeferCVar->Set(0, ECVF_SetByCode);
+	const uint64 BuffersBefore = FRealtimeMeshGPUBuffer::GetNumBuffersCreated();
+	EditPositions(0, 3);
+	EditPositions(10, 4);
+	ProcessProxyCommands();
+
+	TestEqual(TEXT("The second edit should wait on the budget"), Proxy->GetNumPendingCommandBatches(), 1);
+	TestEqual(TEXT("The second edit should only upload the rows it changed"), Proxy->GetPendingUploadBytes(), static_cast<uint64>(4 * Interleaved->GetStride()));
+
+	BudgetCVar->Set(0, ECVF_SetByCode);
+	ProcessProxyCommands();
+
+	TestEqual(TEXT("Nothing should be left waiting"), Proxy->GetNumPendingCommandBatches(), 0);
+	TestTrue(TEXT("Range edits should write into the existing interleaved buffer"), SectionGroup->GetStream(FRealtimeMeshStreams::Interleaved) == Interleaved);
+	TestEqual(TEXT("Range edits should not resize the interleaved buffer"), Interleaved->Num(), NumRows);
+	TestEqual(TEXT("Range edits should not create buffers"), FRealtimeMeshGPUBuffer::GetNumBuffersCreated(), BuffersBefore);
+
+	BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+	MaxDeferCVar->Set(OriginalMaxDefer, ECVF_SetByCode);
+	Mesh->Reset();
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,306 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RenderProxy/RealtimeMeshRingAllocator.h"
+#include "RenderProxy/RealtimeMeshBufferPool.h"
+
+using namespace RealtimeMesh;
+
+// Test flags for editor-only tests
+#if WITH_DEV_AUTOMATION_TESTS
+
+//==============================================================================
+// Ring Allocator Tests
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRingAllocatorBasicTest,
+	"RealtimeMeshComponent.GPUAllocator.Ring.Basic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRingAllocatorBasicTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshRingAllocator Ring(1024);
+
+	TestTrue(TEXT("New ring should be empty"), Ring.IsEmpty());
+	TestEqual(TEXT("First allocation should start at 0"), Ring.Allocate(256, 16, 1), static_cast<uint64>(0));
+	TestEqual(TEXT("Second allocation should follow the first"), Ring.Allocate(256, 16, 1), static_cast<uint64>(256));
+	TestEqual(TEXT("Used bytes should cover both allocations"), Ring.GetUsedBytes(), static_cast<uint64>(512));
+	TestEqual(TEXT("Allocations with the same fence should share a block"), Ring.GetNumPendingFences(), 1);
+
+	Ring.Release(0);
+	TestEqual(TEXT("Releasing an earlier fence should free nothing"), Ring.GetUsedBytes(), static_cast<uint64>(512));
+
+	Ring.Release(1);
+	TestTrue(TEXT("Releasing the fence should free everything"), Ring.IsEmpty());
+	TestEqual(TEXT("An empty ring should allocate from the start again"), Ring.Allocate(128, 16, 2), static_cast<uint64>(0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRingAllocatorAlignmentTest,
+	"RealtimeMeshComponent.GPUAllocator.Ring.Alignment",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRingAllocatorAlignmentTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshRingAllocator Ring(1024);
+
+	TestEqual(TEXT("Unaligned allocation"), Ring.Allocate(10, 1, 1), static_cast<uint64>(0));
+
+	// Strides like 12 bytes for a float3 position aren't powers of two
+	TestEqual(TEXT("Allocation should be aligned to a 12 byte stride"), Ring.Allocate(24, 12, 1), static_cast<uint64>(12));
+	TestEqual(TEXT("Padding should count as used"), Ring.GetUsedBytes(), static_cast<uint64>(36));
+
+	TestEqual(TEXT("Allocation should be aligned to a 20 byte stride"), Ring.Allocate(20, 20, 2), static_cast<uint64>(40));
+	TestEqual(TEXT("Used bytes after the second fence"), Ring.GetUsedBytes(), static_cast<uint64>(60));
+
+	Ring.Release(1);
+	TestEqual(TEXT("Releasing the first fence should free its padding too"), Ring.GetUsedBytes(), static_cast<uint64>(24));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRingAllocatorWrapAroundTest,
+	"RealtimeMeshComponent.GPUAllocator.Ring.WrapAround",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRingAllocatorWrapAroundTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshRingAllocator Ring(1000);
+
+	TestEqual(TEXT("Frame 1 allocation"), Ring.Allocate(400, 1, 1), static_cast<uint64>(0));
+	TestEqual(TEXT("Frame 2 allocation"), Ring.Allocate(400, 1, 2), static_cast<uint64>(400));
+
+	Ring.Release(1);
+
+	// Only 200 bytes remain at the end, so the allocation wraps into the space frame 1 freed
+	TestEqual(TEXT("Allocation should wrap to the start"), Ring.Allocate(400, 1, 3), static_cast<uint64>(0));
+	TestEqual(TEXT("The skipped tail should stay reserved"), Ring.GetUsedBytes(), static_cast<uint64>(1000));
+	TestEqual(TEXT("A full ring should not allocate"), Ring.Allocate(1, 1, 3), FRealtimeMeshRingAllocator::InvalidOffset);
+
+	Ring.Release(2);
+	TestEqual(TEXT("Releasing frame 2 should free only its region, the skipped tail belongs to frame 3"), Ring.GetUsedBytes(), static_cast<uint64>(600));
+	TestEqual(TEXT("Allocation should continue after the wrapped region"), Ring.Allocate(400, 1, 4), static_cast<uint64>(400));
+	TestEqual(TEXT("Allocation crossing the end with no room at the start should fail"), Ring.Allocate(300, 1, 4), FRealtimeMeshRingAllocator::InvalidOffset);
+
+	Ring.Release(4);
+	TestTrue(TEXT("Releasing every fence should empty the ring"), Ring.IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRingAllocatorFenceReuseTest,
+	"RealtimeMeshComponent.GPUAllocator.Ring.FenceReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRingAllocatorFenceReuseTest::RunTest(const FString& Parameters)
+{
+	// Three frames in flight, one region each
+	FRealtimeMeshRingAllocator Ring(300);
+
+	TestEqual(TEXT("Frame 1 region"), Ring.Allocate(100, 4, 1), static_cast<uint64>(0));
+	TestEqual(TEXT("Frame 2 region"), Ring.Allocate(100, 4, 2), static_cast<uint64>(100));
+	TestEqual(TEXT("Frame 3 region"), Ring.Allocate(100, 4, 3), static_cast<uint64>(200));
+	TestEqual(TEXT("Each frame should have its own block"), Ring.GetNumPendingFences(), 3);
+
+	// The GPU may still read every region, none can be handed out again
+	TestEqual(TEXT("No region should be reused before its fence is released"), Ring.Allocate(100, 4, 4), FRealtimeMeshRingAllocator::InvalidOffset);
+
+	Ring.Release(1);
+	TestEqual(TEXT("Frame 1's region should be reused once released"), Ring.Allocate(100, 4, 4), static_cast<uint64>(0));
+	TestEqual(TEXT("Frame 2's region is still in flight"), Ring.Allocate(100, 4, 5), FRealtimeMeshRingAllocator::InvalidOffset);
+
+	Ring.Release(3);
+	TestEqual(TEXT("Releasing up to frame 3 should leave only frame 4"), Ring.GetNumPendingFences(), 1);
+	TestEqual(TEXT("Frame 5 region"), Ring.Allocate(100, 4, 5), static_cast<uint64>(100));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRingAllocatorRetainTest,
+	"RealtimeMeshComponent.GPUAllocator.Ring.Retain",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRingAllocatorRetainTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshRingAllocator Ring(300);
+
+	TestEqual(TEXT("Frame 1 region"), Ring.Allocate(100, 1, 1), static_cast<uint64>(0));
+	TestEqual(TEXT("Frame 2 region"), Ring.Allocate(100, 1, 2), static_cast<uint64>(100));
+
+	// Frame 2's region is still drawn from in frame 6, so it has to outlive frame 1's
+	Ring.RetainNewest(6);
+	Ring.Release(5);
+	TestEqual(TEXT("Only the older region should be released"), Ring.GetNumPendingFences(), 1);
+	TestEqual(TEXT("The retained region should not be handed out"), Ring.Allocate(200, 1, 6), FRealtimeMeshRingAllocator::InvalidOffset);
+	TestEqual(TEXT("The released region should be reused"), Ring.Allocate(100, 1, 6), static_cast<uint64>(200));
+
+	// Retaining never moves a fence back
+	Ring.RetainNewest(3);
+	Ring.Release(5);
+	TestEqual(TEXT("Retaining an earlier fence should be ignored"), Ring.GetNumPendingFences(), 1);
+
+	Ring.Release(6);
+	TestTrue(TEXT("Releasing the retained fence should free everything"), Ring.IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshRingAllocatorOverflowTest,
+	"RealtimeMeshComponent.GPUAllocator.Ring.Overflow",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshRingAllocatorOverflowTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshRingAllocator Ring(256);
+
+	TestEqual(TEXT("Allocation larger than the ring should fail"), Ring.Allocate(257, 1, 1), FRealtimeMeshRingAllocator::InvalidOffset);
+	TestEqual(TEXT("Empty allocation should fail"), Ring.Allocate(0, 1, 1), FRealtimeMeshRingAllocator::InvalidOffset);
+	TestTrue(TEXT("Failed allocations should not reserve anything"), Ring.IsEmpty());
+
+	TestEqual(TEXT("Allocation of the whole ring"), Ring.Allocate(256, 1, 1), static_cast<uint64>(0));
+	TestEqual(TEXT("Nothing fits in a full ring"), Ring.Allocate(1, 1, 2), FRealtimeMeshRingAllocator::InvalidOffset);
+
+	// Alignment padding can push an allocation past the end even when enough bytes are free
+	Ring.Release(1);
+	TestEqual(TEXT("Small allocation"), Ring.Allocate(8, 1, 2), static_cast<uint64>(0));
+	TestEqual(TEXT("Allocation that fits only without padding should fail"), Ring.Allocate(248, 16, 2), FRealtimeMeshRingAllocator::InvalidOffset);
+
+	Ring.Reset(512);
+	TestEqual(TEXT("Reset should resize the ring"), Ring.GetCapacity(), static_cast<uint64>(512));
+	TestTrue(TEXT("Reset should drop every allocation"), Ring.IsEmpty());
+	TestEqual(TEXT("Allocation that didn't fit before"), Ring.Allocate(257, 1, 3), static_cast<uint64>(0));
+
+	return true;
+}
+
+//==============================================================================
+// Buffer Pool Tests
+//==============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshBufferPoolSizeClassTest,
+	"RealtimeMeshComponent.GPUAllocator.Pool.SizeClasses",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshBufferPoolSizeClassTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("Tiny sizes should use the smallest class"), FRealtimeMeshBufferPoolPolicy::GetSizeClass(1), FRealtimeMeshBufferPoolPolicy::MinSizeClass);
+	TestEqual(TEXT("The smallest class should fit exactly"), FRealtimeMeshBufferPoolPolicy::GetSizeClass(256), static_cast<uint64>(256));
+	TestEqual(TEXT("Sizes should round up to a quarter step"), FRealtimeMeshBufferPoolPolicy::GetSizeClass(257), static_cast<uint64>(320));
+	TestEqual(TEXT("1000 bytes should use the 1KB class"), FRealtimeMeshBufferPoolPolicy::GetSizeClass(1000), static_cast<uint64>(1024));
+	TestEqual(TEXT("1100 bytes should use the 1.25KB class"), FRealtimeMeshBufferPoolPolicy::GetSizeClass(1100), static_cast<uint64>(1280));
+
+	bool bAllWithinBounds = true;
+	for (uint64 Size = FRealtimeMeshBufferPoolPolicy::MinSizeClass; Size < 1024 * 1024; Size = Size * 9 / 8 + 7)
+	{
+		const uint64 SizeClass = FRealtimeMeshBufferPoolPolicy::GetSizeClass(Size);
+		bAllWithinBounds &= SizeClass >= Size && SizeClass * 4 <= Size * 5 + 4 && FRealtimeMeshBufferPoolPolicy::GetSizeClass(SizeClass) == SizeClass;
+	}
+	TestTrue(TEXT("Size classes should hold the size with at most 25% waste"), bAllWithinBounds);
+
+	FRealtimeMeshBufferPoolPolicy Policy;
+	Policy.Slack = 0.25f;
+	TestEqual(TEXT("Slack should be added before rounding"), Policy.GetPooledSize(1000), static_cast<uint64>(1280));
+	Policy.Slack = 0.0f;
+	TestEqual(TEXT("Without slack only the size class rounding remains"), Policy.GetPooledSize(1000), static_cast<uint64>(1024));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshBufferPoolCapacityReuseTest,
+	"RealtimeMeshComponent.GPUAllocator.Pool.CapacityReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshBufferPoolCapacityReuseTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshBufferPoolPolicy Policy;
+	Policy.Slack = 0.25f;
+	const uint64 Capacity = Policy.GetPooledSize(1000);
+
+	TestTrue(TEXT("The original size should fit"), Policy.CanReuseCapacity(1000, Capacity));
+	TestTrue(TEXT("Growing into the slack should fit"), Policy.CanReuseCapacity(1200, Capacity));
+	TestTrue(TEXT("Growing to the capacity should fit"), Policy.CanReuseCapacity(Capacity, Capacity));
+	TestFalse(TEXT("Growing past the capacity should not fit"), Policy.CanReuseCapacity(Capacity + 1, Capacity));
+	TestTrue(TEXT("Shrinking a little should keep the buffer"), Policy.CanReuseCapacity(800, Capacity));
+	TestFalse(TEXT("Shrinking to a fraction should move to a smaller buffer"), Policy.CanReuseCapacity(200, Capacity));
+	TestFalse(TEXT("Empty streams should not keep a buffer"), Policy.CanReuseCapacity(0, Capacity));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshBufferPoolReuseDelayTest,
+	"RealtimeMeshComponent.GPUAllocator.Pool.ReuseDelay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshBufferPoolReuseDelayTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshBufferPoolPolicy Policy;
+	Policy.ReuseDelayFrames = 3;
+	TRealtimeMeshBufferPool<int32> Pool(Policy);
+
+	FRealtimeMeshBufferPoolKey Key;
+	int32 Handle = INDEX_NONE;
+	TestFalse(TEXT("An empty pool should miss"), Pool.Acquire(1, 12, 1000, 10, Key, Handle));
+	TestEqual(TEXT("The key should carry the pooled size"), Key.Size, Policy.GetPooledSize(1000));
+
+	Pool.Release(Key, 1000, 42, 10);
+	TestEqual(TEXT("The released buffer should be free"), Pool.GetStats().NumFree, 1);
+
+	FRealtimeMeshBufferPoolKey NewKey;
+	TestFalse(TEXT("A buffer the GPU may still read should not be reused"), Pool.Acquire(1, 12, 1000, 12, NewKey, Handle));
+	TestTrue(TEXT("The buffer should be reused once the delay passed"), Pool.Acquire(1, 12, 1020, 13, NewKey, Handle));
+	TestEqual(TEXT("The released handle should be handed out"), Handle, 42);
+	TestTrue(TEXT("A similar size should share the size class"), NewKey == Key);
+	TestEqual(TEXT("The pool should be empty again"), Pool.GetStats().NumFree, 0);
+
+	// Anything else that differs keeps buffers apart
+	Pool.Release(NewKey, 1020, 42, 13);
+	TestFalse(TEXT("A different stride should not reuse the buffer"), Pool.Acquire(1, 16, 1000, 100, NewKey, Handle));
+	TestFalse(TEXT("A different usage should not reuse the buffer"), Pool.Acquire(2, 12, 1000, 100, NewKey, Handle));
+	TestFalse(TEXT("A different size class should not reuse the buffer"), Pool.Acquire(1, 12, 4000, 100, NewKey, Handle));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshBufferPoolStatsTest,
+	"RealtimeMeshComponent.GPUAllocator.Pool.Stats",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshBufferPoolStatsTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshBufferPoolPolicy Policy;
+	Policy.Slack = 0.25f;
+	Policy.ReuseDelayFrames = 1;
+	Policy.MaxIdleFrames = 100;
+	TRealtimeMeshBufferPool<int32> Pool(Policy);
+
+	FRealtimeMeshBufferPoolKey Key;
+	int32 Handle = INDEX_NONE;
+	Pool.Acquire(1, 4, 1000, 0, Key, Handle);
+	TestEqual(TEXT("In use bytes should be the full capacity"), Pool.GetStats().InUseBytes, static_cast<uint64>(1280));
+	TestEqual(TEXT("The slack should count as waste"), Pool.GetStats().GetWastedBytes(), static_cast<uint64>(280));
+
+	Pool.UpdateDataSize(1000, 1200);
+	TestEqual(TEXT("Growing into the slack should reduce the waste"), Pool.GetStats().GetWastedBytes(), static_cast<uint64>(80));
+
+	Pool.Release(Key, 1200, 1, 0);
+	TestEqual(TEXT("Nothing should be in use after the release"), Pool.GetStats().InUseBytes, static_cast<uint64>(0));
+	TestEqual(TEXT("Free buffers should count as waste"), Pool.GetStats().GetWastedBytes(), static_cast<uint64>(1280));
+
+	Pool.Acquire(1, 4, 1000, 5, Key, Handle);
+	TestEqual(TEXT("One hit"), Pool.GetStats().NumHits, static_cast<uint64>(1));
+	TestEqual(TEXT("One miss"), Pool.GetStats().NumMisses, static_cast<uint64>(1));
+	TestEqual(TEXT("Hit rate should be a half"), Pool.GetStats().GetHitRate(), 0.5f);
+
+	// Idle buffers are dropped after MaxIdleFrames
+	Pool.Release(Key, 1000, 1, 10);
+	TestEqual(TEXT("Recently released buffers should be kept"), Pool.Trim(110), 0);
+	TestEqual(TEXT("Buffers idle too long should be dropped"), Pool.Trim(111), 1);
+	TestEqual(TEXT("Nothing should be left free"), Pool.GetStats().NumFree, 0);
+	TestEqual(TEXT("Nothing should be left wasted"), Pool.GetStats().GetWastedBytes(), static_cast<uint64>(0));
+	TestEqual(TEXT("The trim should be counted"), Pool.GetStats().NumTrimmed, static_cast<uint64>(1));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,6 +2,7 @@
 
 #include "Misc/AutomationTest.h"
 #include "Interface/Core/RealtimeMeshDataStream.h"
+#include "Interface/Core/RealtimeMeshInterleavedLayout.h"
 
 using namespace RealtimeMesh;
 
@@ -422,6 +423,143 @@ bool FRealtimeMeshStreamCopyMoveTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStreamSharedStorageTest,
+	"RealtimeMeshComponent.Streams.Stream.SharedStorage",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStreamSharedStorageTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStreamKey Key(ERealtimeMeshStreamType::Vertex, FName("Position"));
+	const TArray<FVector3f> TestData = {
+		FVector3f(1.0f, 2.0f, 3.0f),
+		FVector3f(4.0f, 5.0f, 6.0f)
+	};
+
+	// Copying shared storage should reference the same bytes
+	{
+		FRealtimeMeshStream Original(Key, GetRealtimeMeshBufferLayout<FVector3f>());
+		Original.Append(TestData);
+		Original.ConvertToSharedStorage();
+		TestTrue(TEXT("Stream should be shared after conversion"), Original.IsSharedStorage());
+
+		const uint64 BytesCopiedBefore = FRealtimeMeshStream::GetTotalBytesCopied();
+		FRealtimeMeshStream Copy(Original);
+		FRealtimeMeshStream Assigned;
+		Assigned = Original;
+		TestEqual(TEXT("Copies of shared storage should not copy any bytes"), FRealtimeMeshStream::GetTotalBytesCopied(), BytesCopiedBefore);
+
+		TestTrue(TEXT("Copy should share storage with original"), Copy.SharesStorageWith(Original));
+		TestTrue(TEXT("Assigned copy should share storage with original"), Assigned.SharesStorageWith(Original));
+		TestEqual(TEXT("Copy should reference the same data"), AsConst(Copy).GetData(), AsConst(Original).GetData());
+		TestEqual(TEXT("Resource data should reference the shared data"), Copy.GetResourceData(), static_cast<const void*>(AsConst(Original).GetData()));
+		TestEqual(TEXT("Copy should read the same values"), *AsConst(Copy).GetDataAtVertex<FVector3f>(1), FVector3f(4.0f, 5.0f, 6.0f));
+	}
+
+	// Mutating a copy should detach it and leave the original untouched
+	{
+		FRealtimeMeshStream Original(Key, GetRealtimeMeshBufferLayout<FVector3f>());
+		Original.Append(TestData);
+		Original.ConvertToSharedStorage();
+
+		FRealtimeMeshStream Copy(Original);
+		*Copy.GetDataAtVertex<FVector3f>(0) = FVector3f(7.0f, 8.0f, 9.0f);
+
+		TestFalse(TEXT("Mutated copy should no longer be shared"), Copy.IsSharedStorage());
+		TestTrue(TEXT("Original should still be shared"), Original.IsSharedStorage());
+		TestEqual(TEXT("Mutated copy should have new value"), *AsConst(Copy).GetDataAtVertex<FVector3f>(0), FVector3f(7.0f, 8.0f, 9.0f));
+		TestEqual(TEXT("Mutated copy should keep other values"), *AsConst(Copy).GetDataAtVertex<FVector3f>(1), FVector3f(4.0f, 5.0f, 6.0f));
+		TestEqual(TEXT("Original should keep old value"), *AsConst(Original).GetDataAtVertex<FVector3f>(0), FVector3f(1.0f, 2.0f, 3.0f));
+
+		Original.Add(FVector3f(10.0f, 11.0f, 12.0f));
+		TestEqual(TEXT("Original should grow after detaching"), Original.Num(), 3);
+		TestEqual(TEXT("Copy should not grow with original"), Copy.Num(), 2);
+	}
+
+	// The last reference to shared storage should take the allocation back without copying
+	{
+		FRealtimeMeshStream Original(Key, GetRealtimeMeshBufferLayout<FVector3f>());
+		Original.SetNumZeroed(100);
+		Original.ConvertToSharedStorage();
+		const uint8* SharedData = AsConst(Original).GetData();
+
+		{
+			FRealtimeMeshStream Copy(Original);
+		}
+
+		const uint64 BytesCopiedBefore = FRealtimeMeshStream::GetTotalBytesCopied();
+		Original.ZeroRange(0, 10);
+		TestFalse(TEXT("Stream should no longer be shared"), Original.IsSharedStorage());
+		TestEqual(TEXT("Unique stream should reclaim the shared allocation"), AsConst(Original).GetData(), SharedData);
+		TestEqual(TEXT("Reclaiming should not copy"), FRealtimeMeshStream::GetTotalBytesCopied(), BytesCopiedBefore);
+	}
+
+	// Emptying, converting and moving shared storage
+	{
+		FRealtimeMeshStream Original(Key, GetRealtimeMeshBufferLayout<FVector3f>());
+		Original.Append(TArray<FVector3f>({ FVector3f(1.0f, 2.0f, 3.0f) }));
+		Original.ConvertToSharedStorage();
+
+		FRealtimeMeshStream Converted(Original);
+		TestTrue(TEXT("Should convert shared stream"), Converted.ConvertTo<FVector3d>());
+		TestEqual(TEXT("Converted value should match"), *AsConst(Converted).GetDataAtVertex<FVector3d>(0), FVector3d(1.0, 2.0, 3.0));
+		TestTrue(TEXT("Original should still be readable"), *AsConst(Original).GetDataAtVertex<FVector3f>(0) == FVector3f(1.0f, 2.0f, 3.0f));
+
+		FRealtimeMeshStream Emptied(Original);
+		Emptied.Empty();
+		TestEqual(TEXT("Emptied copy should be empty"), Emptied.Num(), 0);
+		TestEqual(TEXT("Original should keep its data"), Original.Num(), 1);
+
+		FRealtimeMeshStream Moved(MoveTemp(Original));
+		TestTrue(TEXT("Moved stream should carry shared storage"), Moved.IsSharedStorage());
+		TestFalse(TEXT("Moved from stream should not be shared"), Original.IsSharedStorage());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshStreamDirtyRangeTest,
+	"RealtimeMeshComponent.Streams.Stream.DirtyRange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshStreamDirtyRangeTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStreamKey Key(ERealtimeMeshStreamType::Vertex, FName("Position"));
+	FRealtimeMeshStream Stream(Key, GetRealtimeMeshBufferLayout<FVector3f>());
+	Stream.SetNumZeroed(100);
+	Stream.ClearDirtyRange();
+
+	TestFalse(TEXT("Cleared stream should not be dirty"), Stream.HasDirtyRange());
+	TestTrue(TEXT("Cleared stream dirty range should be empty"), Stream.GetDirtyRange().IsEmpty());
+
+	// Range writers should mark what they touch
+	const TArray<FVector3f> NewData = { FVector3f(1.0f, 2.0f, 3.0f), FVector3f(4.0f, 5.0f, 6.0f) };
+	Stream.SetRange(10, GetRealtimeMeshBufferLayout<FVector3f>(), reinterpret_cast<const uint8*>(NewData.GetData()), NewData.Num());
+	TestTrue(TEXT("SetRange should mark the stream dirty"), Stream.HasDirtyRange());
+	TestEqual(TEXT("SetRange dirty range"), Stream.GetDirtyRange(), TRange<int32>(10, 12));
+
+	// Ranges should merge to their hull
+	Stream.ZeroRange(40, 5);
+	TestEqual(TEXT("Merged dirty range"), Stream.GetDirtyRange(), TRange<int32>(10, 45));
+
+	Stream.SetGenerated<FVector3f>(5, 2, [](int32 Index) { return FVector3f(Index); });
+	TestEqual(TEXT("SetGenerated should extend the dirty range"), Stream.GetDirtyRange(), TRange<int32>(5, 45));
+
+	// Manual marking for direct writes
+	Stream.ClearDirtyRange();
+	*Stream.GetDataAtVertex<FVector3f>(90) = FVector3f(9.0f);
+	TestFalse(TEXT("Direct writes should not be tracked"), Stream.HasDirtyRange());
+	Stream.MarkRangeDirty(90, 1);
+	TestEqual(TEXT("Manually marked range"), Stream.GetDirtyRange(), TRange<int32>(90, 91));
+
+	// Dirty range is clamped to the stream size and travels with copies
+	FRealtimeMeshStream Copy(Stream);
+	TestEqual(TEXT("Copy should keep the dirty range"), Copy.GetDirtyRange(), TRange<int32>(90, 91));
+	Copy.SetNumUninitialized(50);
+	TestTrue(TEXT("Dirty range past the end should be clamped away"), Copy.GetDirtyRange().IsEmpty());
+
+	return true;
+}
+
 // ===========================================================================================
 // FRealtimeMeshStream Data Management Tests
 // ===========================================================================================
@@ -1081,3 +1219,131 @@ bool FRealtimeMeshStreamSetGetStreamKeysTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ===========================================================================================
+// FRealtimeMeshInterleavedLayout Tests
+// ===========================================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInterleavedLayoutOffsetsTest,
+	"RealtimeMeshComponent.Streams.Interleaved.StrideAndOffsets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInterleavedLayoutOffsetsTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStreamSet Streams;
+	Streams.AddStream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>()).SetNumZeroed(4);
+	Streams.AddStream(FRealtimeMeshStreams::Tangents, GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsNormalPrecision>()).SetNumZeroed(4);
+	Streams.AddStream(FRealtimeMeshStreams::TexCoords, GetRealtimeMeshBufferLayout<FVector2DHalf>()).SetNumZeroed(4);
+	Streams.AddStream(FRealtimeMeshStreams::Color, GetRealtimeMeshBufferLayout<FColor>()).SetNumZeroed(4);
+
+	// Index streams are never packed
+	Streams.AddStream(FRealtimeMeshStreams::Triangles, GetRealtimeMeshBufferLayout<TIndex3<uint32>>()).SetNumZeroed(2);
+
+	const FRealtimeMeshInterleavedLayout Layout = FRealtimeMeshInterleavedLayout::Create(Streams);
+	TestTrue(TEXT("Layout is valid"), Layout.IsValid());
+	TestEqual(TEXT("Four streams packed"), Layout.GetElements().Num(), 4);
+	TestEqual(TEXT("Stride is the sum of the elements"), Layout.GetStride(), 12u + 8u + 4u + 4u);
+	TestEqual(TEXT("NumVertices"), Layout.GetNumVertices(), 4);
+
+	const FRealtimeMeshInterleavedElement* Position = Layout.Find(FRealtimeMeshStreams::Position);
+	const FRealtimeMeshInterleavedElement* Tangents = Layout.Find(FRealtimeMeshStreams::Tangents);
+	const FRealtimeMeshInterleavedElement* TexCoords = Layout.Find(FRealtimeMeshStreams::TexCoords);
+	const FRealtimeMeshInterleavedElement* Color = Layout.Find(FRealtimeMeshStreams::Color);
+	if (TestNotNull(TEXT("Position packed"), Position) && TestNotNull(TEXT("Tangents packed"), Tangents) &&
+		TestNotNull(TEXT("TexCoords packed"), TexCoords) && TestNotNull(TEXT("Color packed"), Color))
+	{
+		TestEqual(TEXT("Position offset"), Position->Offset, 0u);
+		TestEqual(TEXT("Tangents offset"), Tangents->Offset, 12u);
+		TestEqual(TEXT("TexCoords offset"), TexCoords->Offset, 20u);
+		TestEqual(TEXT("Color offset"), Color->Offset, 24u);
+		TestTrue(TEXT("Tangents keep their layout"), Tangents->Layout == GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsNormalPrecision>());
+	}
+	TestNull(TEXT("Triangles not packed"), Layout.Find(FRealtimeMeshStreams::Triangles));
+
+	const FRealtimeMeshBufferLayout BufferLayout = Layout.GetBufferLayout();
+	TestTrue(TEXT("Packed layout is rows of uint32"), BufferLayout.GetElementType() == GetRealtimeMeshDataElementType<uint32>());
+	TestEqual(TEXT("Packed layout covers the stride"), BufferLayout.GetNumElements(), 7);
+
+	// Without positions there is nothing to draw from
+	{
+		FRealtimeMeshStreamSet NoPositions;
+		NoPositions.AddStream(FRealtimeMeshStreams::Tangents, GetRealtimeMeshBufferLayout<FRealtimeMeshTangentsNormalPrecision>()).SetNumZeroed(4);
+		TestFalse(TEXT("Layout without positions is invalid"), FRealtimeMeshInterleavedLayout::Create(NoPositions).IsValid());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshInterleavedLayoutPackTest,
+	"RealtimeMeshComponent.Streams.Interleaved.Pack",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshInterleavedLayoutPackTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshStreamSet Streams;
+	FRealtimeMeshStream& Positions = Streams.AddStream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>());
+	FRealtimeMeshStream& TexCoords = Streams.AddStream(FRealtimeMeshStreams::TexCoords, GetRealtimeMeshBufferLayout<FVector2f>());
+	FRealtimeMeshStream& Colors = Streams.AddStream(FRealtimeMeshStreams::Color, GetRealtimeMeshBufferLayout<FColor>());
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		Positions.Add(FVector3f(Index, Index * 10.0f, Index * 100.0f));
+		TexCoords.Add(FVector2f(Index * 0.5f, 1.0f));
+	}
+	// One extra texcoord that no vertex can use, and a single color for the whole mesh
+	TexCoords.Add(FVector2f(9.0f, 9.0f));
+	Colors.Add(FColor::Red);
+
+	const FRealtimeMeshInterleavedLayout Layout = FRealtimeMeshInterleavedLayout::Create(Streams);
+	TestEqual(TEXT("Trimmed to the shortest stream"), Layout.GetNumVertices(), 3);
+	TestEqual(TEXT("Stride"), Layout.GetStride(), 12u + 8u + 4u);
+
+	FRealtimeMeshStream Packed;
+	if (!TestTrue(TEXT("Pack succeeds"), Layout.Pack(Streams, Packed)))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Packed stream key"), Packed.GetStreamKey() == FRealtimeMeshStreams::Interleaved);
+	TestEqual(TEXT("Packed rows"), Packed.Num(), 3);
+	TestEqual(TEXT("Packed stride"), static_cast<uint32>(Packed.GetStride()), Layout.GetStride());
+
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		const uint8* Row = AsConst(Packed).GetData() + Index * Layout.GetStride();
+
+		FVector3f Position;
+		FVector2f TexCoord;
+		FColor Color;
+		FMemory::Memcpy(&Position, Row + Layout.Find(FRealtimeMeshStreams::Position)->Offset, sizeof(Position));
+		FMemory::Memcpy(&TexCoord, Row + Layout.Find(FRealtimeMeshStreams::TexCoords)->Offset, sizeof(TexCoord));
+		FMemory::Memcpy(&Color, Row + Layout.Find(FRealtimeMeshStreams::Color)->Offset, sizeof(Color));
+
+		TestEqual(*FString::Printf(TEXT("Row %d position"), Index), Position, FVector3f(Index, Index * 10.0f, Index * 100.0f));
+		TestEqual(*FString::Printf(TEXT("Row %d texcoord"), Index), TexCoord, FVector2f(Index * 0.5f, 1.0f));
+		TestTrue(*FString::Printf(TEXT("Row %d single color repeated"), Index), Color == FColor::Red);
+	}
+
+	// A range packs the same rows as the full pack
+	{
+		FRealtimeMeshStream PackedRows;
+		if (TestTrue(TEXT("Pack range succeeds"), Layout.PackRange(Streams, 1, 2, PackedRows)))
+		{
+			TestEqual(TEXT("Packed range rows"), PackedRows.Num(), 2);
+			TestEqual(TEXT("Packed range matches the full pack"),
+				FMemory::Memcmp(AsConst(PackedRows).GetData(), AsConst(Packed).GetData() + Layout.GetStride(), 2 * Layout.GetStride()), 0);
+		}
+
+		FRealtimeMeshStream Unused;
+		TestFalse(TEXT("Pack range past the packed rows fails"), Layout.PackRange(Streams, 2, 2, Unused));
+	}
+
+	// Streams changed since the layout was made are rejected
+	{
+		FRealtimeMeshStreamSet Changed;
+		Changed.AddStream(FRealtimeMeshStreams::Position, GetRealtimeMeshBufferLayout<FVector3f>()).SetNumZeroed(3);
+		FRealtimeMeshStream Unused;
+		TestFalse(TEXT("Pack with missing streams fails"), Layout.Pack(Changed, Unused));
+	}
+
+	return true;
+}
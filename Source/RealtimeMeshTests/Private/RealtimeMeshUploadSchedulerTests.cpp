@@ -0,0 +1,162 @@
+// Copyright (c) 2015-2025 TriAxis Games, L.L.C. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "RenderProxy/RealtimeMeshUploadScheduler.h"
+
+using namespace RealtimeMesh;
+
+// Test flags for editor-only tests
+#if WITH_DEV_AUTOMATION_TESTS
+
+//==============================================================================
+// Upload Scheduler Tests
+//==============================================================================
+
+namespace RealtimeMeshUploadSchedulerTests
+{
+	static FRealtimeMeshUploadScheduler::FOwner MakeOwner(float Priority, std::initializer_list<uint64> BatchBytes, uint32 FramesWaited = 0)
+	{
+		FRealtimeMeshUploadScheduler::FOwner Owner;
+		Owner.Priority = Priority;
+		for (const uint64 Bytes : BatchBytes)
+		{
+			Owner.Batches.Add({ Bytes, FramesWaited });
+		}
+		return Owner;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadSchedulerDisabledTest,
+	"RealtimeMeshComponent.UploadScheduler.Disabled",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadSchedulerDisabledTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshUploadSchedulerTests;
+
+	FRealtimeMeshUploadScheduler Scheduler;
+	Scheduler.BeginFrame(1, 0, 0);
+	TestFalse(TEXT("A budget of 0 should disable the scheduler"), Scheduler.IsEnabled());
+
+	const TArray<FRealtimeMeshUploadScheduler::FOwner> Owners = { MakeOwner(0.0f, { 1000000, 1000000 }), MakeOwner(0.0f, { 5000000 }) };
+	const TArray<int32> Granted = Scheduler.Schedule(Owners);
+	TestEqual(TEXT("Every batch of the first owner should be granted"), Granted[0], 2);
+	TestEqual(TEXT("Every batch of the second owner should be granted"), Granted[1], 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadSchedulerBudgetTest,
+	"RealtimeMeshComponent.UploadScheduler.Budget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadSchedulerBudgetTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshUploadScheduler Scheduler;
+	Scheduler.BeginFrame(1, 1000, 0);
+
+	TestTrue(TEXT("First batch should fit"), Scheduler.TryConsume({ 400, 0 }));
+	TestTrue(TEXT("Second batch should fit"), Scheduler.TryConsume({ 400, 0 }));
+	TestFalse(TEXT("Third batch should exceed the budget"), Scheduler.TryConsume({ 400, 0 }));
+	TestEqual(TEXT("A batch that doesn't fit shouldn't be charged"), Scheduler.GetUsedBytes(), static_cast<uint64>(800));
+	TestTrue(TEXT("A smaller batch can still use what's left"), Scheduler.TryConsume({ 200, 0 }));
+	TestEqual(TEXT("Budget should be used up"), Scheduler.GetRemainingBytes(), static_cast<uint64>(0));
+
+	// The same frame keeps counting against the same budget
+	Scheduler.BeginFrame(1, 1000, 0);
+	TestFalse(TEXT("Nothing should fit later in the same frame"), Scheduler.TryConsume({ 1, 0 }));
+
+	Scheduler.BeginFrame(2, 1000, 0);
+	TestEqual(TEXT("A new frame should start with the full budget"), Scheduler.GetRemainingBytes(), static_cast<uint64>(1000));
+	TestTrue(TEXT("Batches should fit again in the new frame"), Scheduler.TryConsume({ 1000, 0 }));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadSchedulerOversizedTest,
+	"RealtimeMeshComponent.UploadScheduler.Oversized",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadSchedulerOversizedTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshUploadScheduler Scheduler;
+	Scheduler.BeginFrame(1, 1000, 0);
+
+	// A batch larger than the whole budget would never fit, so the first batch of a frame always goes through
+	TestTrue(TEXT("Oversized batch should be granted as the first of the frame"), Scheduler.TryConsume({ 5000, 0 }));
+	TestFalse(TEXT("Anything after it should wait"), Scheduler.TryConsume({ 1, 0 }));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadSchedulerPriorityTest,
+	"RealtimeMeshComponent.UploadScheduler.Priority",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadSchedulerPriorityTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshUploadSchedulerTests;
+
+	FRealtimeMeshUploadScheduler Scheduler;
+	Scheduler.BeginFrame(1, 1000, 0);
+
+	const TArray<FRealtimeMeshUploadScheduler::FOwner> Owners = { MakeOwner(0.0f, { 600 }), MakeOwner(10.0f, { 600 }), MakeOwner(5.0f, { 400 }) };
+	const TArray<int32> Granted = Scheduler.Schedule(Owners);
+	TestEqual(TEXT("Lowest priority owner should wait"), Granted[0], 0);
+	TestEqual(TEXT("Highest priority owner should go first"), Granted[1], 1);
+	TestEqual(TEXT("Middle priority owner should use what's left"), Granted[2], 1);
+
+	// With equal priorities the owner that has waited longest goes first
+	Scheduler.BeginFrame(2, 1000, 0);
+	const TArray<FRealtimeMeshUploadScheduler::FOwner> WaitingOwners = { MakeOwner(0.0f, { 600 }, 1), MakeOwner(0.0f, { 600 }, 4) };
+	const TArray<int32> WaitingGranted = Scheduler.Schedule(WaitingOwners);
+	TestEqual(TEXT("Newer work should wait"), WaitingGranted[0], 0);
+	TestEqual(TEXT("Older work should go first"), WaitingGranted[1], 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadSchedulerOrderTest,
+	"RealtimeMeshComponent.UploadScheduler.Order",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadSchedulerOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace RealtimeMeshUploadSchedulerTests;
+
+	FRealtimeMeshUploadScheduler Scheduler;
+	Scheduler.BeginFrame(1, 1000, 0);
+
+	// The second batch doesn't fit, so the small third batch of the same owner has to wait behind it
+	const TArray<FRealtimeMeshUploadScheduler::FOwner> Owners = { MakeOwner(1.0f, { 500, 800, 100 }), MakeOwner(0.0f, { 300, 300 }) };
+	const TArray<int32> Granted = Scheduler.Schedule(Owners);
+	TestEqual(TEXT("Batches of an owner should be granted in order"), Granted[0], 1);
+	TestEqual(TEXT("Another owner's smaller batches can fill the rest"), Granted[1], 1);
+	TestEqual(TEXT("Used bytes should only count the granted batches"), Scheduler.GetUsedBytes(), static_cast<uint64>(800));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRealtimeMeshUploadSchedulerMaxDeferTest,
+	"RealtimeMeshComponent.UploadScheduler.MaxDefer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRealtimeMeshUploadSchedulerMaxDeferTest::RunTest(const FString& Parameters)
+{
+	FRealtimeMeshUploadScheduler Scheduler;
+	Scheduler.BeginFrame(1, 1000, 10);
+
+	TestTrue(TEXT("First batch should fit"), Scheduler.TryConsume({ 1000, 0 }));
+	TestFalse(TEXT("A batch that hasn't waited long enough should wait"), Scheduler.TryConsume({ 500, 9 }));
+	TestTrue(TEXT("A batch that has waited MaxDeferFrames should go regardless"), Scheduler.TryConsume({ 500, 10 }));
+	TestEqual(TEXT("Forced batches should still be charged"), Scheduler.GetUsedBytes(), static_cast<uint64>(1500));
+
+	// Without a limit a batch can wait as long as needed
+	Scheduler.BeginFrame(2, 1000, 0);
+	TestTrue(TEXT("First batch should fit"), Scheduler.TryConsume({ 1000, 0 }));
+	TestFalse(TEXT("Without MaxDeferFrames nothing is forced"), Scheduler.TryConsume({ 500, 1000 }));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
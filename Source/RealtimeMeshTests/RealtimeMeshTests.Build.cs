@@ -32,5 +32,8 @@ public class RealtimeMeshTests : ModuleRules
                 "RealtimeMeshComponent",
             }
         );
+
+        // Reference for the MikkTSpace tangent generation tests
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "MikkTSpace");
     }
 }
\ No newline at end of file